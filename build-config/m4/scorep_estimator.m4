@@ -3,7 +3,7 @@ dnl -*- mode: autoconf -*-
 dnl
 dnl This file is part of the Score-P software (http://www.score-p.org)
 dnl
-dnl Copyright (c) 2013-2014
+dnl Copyright (c) 2013-2014, 2026,
 dnl Forschungszentrum Juelich GmbH, Germany
 dnl
 dnl This software may be modified and distributed under the terms of
@@ -13,20 +13,13 @@ dnl
 
 dnl file build-config/m4/scorep_estimator.m4
 
+dnl scorep-score links OTF2's event size estimator. As a frontend tool it
+dnl uses the frontend OTF2 library, i.e., otf2-config is called without a
+dnl --target argument.
 AC_DEFUN([SCOREP_ESTIMATOR], [
+AC_REQUIRE([SCOREP_VENDOR_EXTERNALS_OTF2_FLAGS])
 
-AS_IF([test "x${scorep_otf2_bindir}" = x],
-      [# internal OTF2
-       adl_RECURSIVE_EVAL([${bindir}], [otf2_estimator_bindir])
-       AC_DEFINE_UNQUOTED([OTF2_ESTIMATOR_INSTALL],
-           ["${otf2_estimator_bindir}/otf2-estimator"],
-           [The otf2-estimator tool])],
-      [test -x "${scorep_otf2_bindir}/otf2-estimator"],
-      [# external OTF2
-       AC_DEFINE_UNQUOTED([OTF2_ESTIMATOR_INSTALL],
-           ["${scorep_otf2_bindir}/otf2-estimator"],
-           [The otf2-estimator tool])],
-      [AC_MSG_ERROR([No otf2-estimator found. Need OTF2 version 1.4 or later.])
-      ])
-
+AS_IF([test "x${scorep_otf2_bindir}" != x && \
+       test ! -x "${scorep_otf2_bindir}/otf2-config"],
+      [AC_MSG_ERROR([No otf2-config found. Need OTF2 version 1.4 or later.])])
 ])
@@ -6,7 +6,7 @@ dnl
 dnl Copyright (c) 2016-2017, 2023, 2025,
 dnl Technische Universitaet Dresden, Germany
 dnl
-dnl Copyright (c) 2022,
+dnl Copyright (c) 2022, 2026,
 dnl Forschungszentrum Juelich GmbH, Germany
 dnl
 dnl This software may be modified and distributed under the terms of
@@ -50,11 +50,27 @@ AS_IF([test "x${scorep_memory_support}" = "xyes"],
         [scorep_memory_support="no"
          AS_VAR_APPEND([scorep_memory_summary_reason], [", missing malloc.h header"])])])
 
+# check math library, needed for the sampled allocation recording
+scorep_memory_libm=
+AS_IF([test "x${scorep_memory_support}" = "xyes"],
+    [scorep_memory_save_LIBS=${LIBS}
+     AC_SEARCH_LIBS([expm1],
+        [m],
+        [AS_CASE([${ac_cv_search_expm1}],
+             [no*], [],
+             [scorep_memory_libm="${ac_cv_search_expm1}"])],
+        [scorep_memory_support="no"
+         AS_VAR_APPEND([scorep_memory_summary_reason], [", missing math library"])])
+     LIBS=${scorep_memory_save_LIBS}])
+AC_SUBST([SCOREP_MEMORY_LIBM], [${scorep_memory_libm}])
+
 # setting output variables/defines
 AC_SCOREP_COND_HAVE([MEMORY_SUPPORT],
                     [test "x${scorep_memory_support}" = "xyes"],
-                    [Define if memory tracking is supported.])
+                    [Define if memory tracking is supported.],
+                    [scorep_memory_summary_reason="${scorep_memory_libm:+, using ${scorep_memory_libm}}"])
 
 AFS_SUMMARY_POP([Memory tracking support], [${scorep_memory_support}${scorep_memory_summary_reason}])
 AS_UNSET([scorep_memory_summary_reason])
+AS_UNSET([scorep_memory_save_LIBS])
 ])
@@ -15,7 +15,7 @@
 ## Copyright (c) 2009-2013,
 ## University of Oregon, Eugene, USA
 ##
-## Copyright (c) 2009-2013, 2015, 2022,
+## Copyright (c) 2009-2013, 2015, 2022, 2026,
 ## Forschungszentrum Juelich GmbH, Germany
 ##
 ## Copyright (c) 2009-2013,
@@ -35,6 +35,7 @@ AC_DEFUN([SCOREP_METRICS_CHECK], [
     _SCOREP_METRICS_CHECK_LIBPAPI
     _SCOREP_METRICS_CHECK_RUSAGE
     _SCOREP_METRICS_CHECK_PERF
+    _SCOREP_METRICS_CHECK_PROC
 ]) # AC_DEFUN(SCOREP_METRICS_CHECK)
 
 AC_DEFUN_ONCE([_SCOREP_METRICS_CHECK_LIBPAPI], [
@@ -301,3 +302,27 @@ AC_SCOREP_COND_HAVE([METRIC_PERF],
 AFS_SUMMARY([metric perf support], [${scorep_have_perf_support}${metric_perf_summary_reason}])
 AS_UNSET([metric_perf_summary_reason])
 ])
+
+
+
+AC_DEFUN_ONCE([_SCOREP_METRICS_CHECK_PROC], [
+AC_REQUIRE([SCOREP_CHECK_PTHREAD])dnl
+
+dnl Do not check for prerequisite of metric proc on the frontend.
+AS_IF([test "x$ac_scorep_backend" = xno], [AC_MSG_ERROR([cannot check for metric proc on frontend.])])
+
+scorep_have_proc_support="no"
+metric_proc_summary_reason=
+AS_CASE([${host_os}],
+    [linux*], [AS_IF([test "x${scorep_have_pthread}" = x1],
+                  [scorep_have_proc_support="yes"],
+                  [metric_proc_summary_reason=", missing pthread header or library"])],
+    [metric_proc_summary_reason=", Linux only"])
+
+AC_SCOREP_COND_HAVE([METRIC_PROC],
+                    [test "x${scorep_have_proc_support}" = "xyes"],
+                    [Defined if the /proc and cgroup metric source is available.])
+
+AFS_SUMMARY([metric proc support], [${scorep_have_proc_support}${metric_proc_summary_reason}])
+AS_UNSET([metric_proc_summary_reason])
+])
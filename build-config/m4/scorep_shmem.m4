@@ -6,7 +6,7 @@
 ## Copyright (c) 2013-2014, 2016-2017, 2019, 2024-2025,
 ## Technische Universitaet Dresden, Germany
 ##
-## Copyright (c) 2015,
+## Copyright (c) 2015, 2026,
 ## Forschungszentrum Juelich GmbH, Germany
 ##
 ## This software may be modified and distributed under the terms of
@@ -987,12 +987,18 @@ AC_DEFUN([_SCOREP_SHMEM_COMPLIANCE], [
          [shmem_wait_until],          [long*, addr, int, cmp, long, value],
          [VOLATILE],                  [volatile long*, addr, int, cmp, long, value])
 
-    dnl _SHMEM_CMP_EQ was the old name, replaced with SHMEM_CMP_EQ in 1.3
+    dnl _SHMEM_CMP_EQ and _SHMEM_CMP_GT were the old names, replaced with
+    dnl SHMEM_CMP_EQ and SHMEM_CMP_GT in 1.3
     AC_CHECK_DECL([SHMEM_CMP_EQ], [], [
         AC_CHECK_DECL([_SHMEM_CMP_EQ],
             [AC_DEFINE([SHMEM_CMP_EQ], [_SHMEM_CMP_EQ], [Legacy SHMEM declaration.])], [],
             [@%:@include <shmem.h>])],
         [@%:@include <shmem.h>])
+    AC_CHECK_DECL([SHMEM_CMP_GT], [], [
+        AC_CHECK_DECL([_SHMEM_CMP_GT],
+            [AC_DEFINE([SHMEM_CMP_GT], [_SHMEM_CMP_GT], [Legacy SHMEM declaration.])], [],
+            [@%:@include <shmem.h>])],
+        [@%:@include <shmem.h>])
 
     AC_LANG_POP([C])
 ])
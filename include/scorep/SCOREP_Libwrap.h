@@ -4,6 +4,9 @@
  * Copyright (c) 2013-2015, 2017, 2020, 2025,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license. See the COPYING file in the package base
  * directory for details.
@@ -32,7 +35,8 @@ extern "C"
 #define SCOREP_LIBWRAP_VERSION 2
 
 /** @brief Opaque handle to the original function.
- * Must be compatible with gotcha_wrappee_handle_t */
+ * Points to the cached function pointer, followed by data private to the
+ * library wrapping service. */
 typedef void* SCOREP_Libwrap_OriginalHandle;
 
 /** @brief Keeps all necessary information of the library wrapping object. */
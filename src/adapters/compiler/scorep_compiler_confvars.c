@@ -0,0 +1,51 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ * @file
+ *
+ *
+ */
+
+#include <config.h>
+
+#define SCOREP_DEBUG_MODULE_NAME COMPILER
+#include <UTILS_Debug.h>
+
+#include <SCOREP_Config.h>
+#include <SCOREP_Subsystem.h>
+
+#include "scorep_compiler_confvars.inc.c"
+
+/** Registers the required configuration variables of the compiler adapter
+    to the measurement system.
+ */
+static SCOREP_ErrorCode
+compiler_subsystem_register( size_t subsystemId )
+{
+    UTILS_DEBUG( "Register environment variables" );
+
+    return SCOREP_ConfigRegisterCond( "compiler",
+                                      scorep_compiler_confvars,
+                                      HAVE_BACKEND_SCOREP_COMPILER_INSTRUMENTATION );
+}
+
+
+/** Struct which contains the adapter initialization and finalization functions for the
+    compiler adapter.
+ */
+const SCOREP_Subsystem SCOREP_Subsystem_CompilerAdapter =
+{
+    .subsystem_name     = "COMPILER Adapter / Version 1.0 (config variables only)",
+    .subsystem_register = &compiler_subsystem_register
+};
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ * @file
+ *
+ *
+ */
+
+bool     scorep_compiler_throttling;
+uint64_t scorep_compiler_throttling_visits;
+uint64_t scorep_compiler_throttling_ticks;
+
+/*
+ *  Configuration variables for the compiler adapter.
+ */
+static const SCOREP_ConfigVariable scorep_compiler_confvars[] = {
+    {
+        "throttling",
+        SCOREP_CONFIG_TYPE_BOOL,
+        &scorep_compiler_throttling,
+        NULL,
+        "false",
+        "Throttle frequently visited, short compiler-instrumented regions",
+        "If enabled, compiler-instrumented regions that were visited at least "
+        "SCOREP_COMPILER_THROTTLING_VISITS times on a location and whose mean "
+        "inclusive duration is below SCOREP_COMPILER_THROTTLING_TICKS are no "
+        "longer recorded on this location. The names of throttled regions are "
+        "reported in the location property COMPILER_THROTTLED_REGIONS."
+    },
+    {
+        "throttling_visits",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_compiler_throttling_visits,
+        NULL,
+        "100000",
+        "Minimal number of visits before a region is considered for throttling",
+        ""
+    },
+    {
+        "throttling_ticks",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_compiler_throttling_ticks,
+        NULL,
+        "1000",
+        "Mean inclusive duration in timer ticks below which a region is throttled",
+        "The unit depends on the used timer, see SCOREP_TIMER. For the "
+        "\'tsc\' timer one tick corresponds to one cycle of the time-stamp "
+        "counter, for \'clock_gettime\' to one nanosecond."
+    },
+    SCOREP_CONFIG_TERMINATOR
+};
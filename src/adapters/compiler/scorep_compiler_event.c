@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022-2024,
+ * Copyright (c) 2022-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -27,6 +27,8 @@
 #include <SCOREP_Definitions.h>
 #include <SCOREP_Filtering.h>
 
+#include "scorep_compiler_throttling.h"
+
 /* Compile as many APIs as possible. */
 
 #if HAVE( SCOREP_COMPILER_INSTRUMENTATION_NEEDS_ADDR2LINE )
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2020-2022,
+ * Copyright (c) 2009-2013, 2020-2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2012,
@@ -80,7 +80,7 @@ SCOREP_COMPILER_CYG_PROFILE_FUNC_ENTER( void* func,
                      SCOREP_RegionHandle_GetName( region ),
                      SCOREP_RegionHandle_GetFileName( region ),
                      SCOREP_RegionHandle_GetBeginLine( region ) );
-        SCOREP_EnterRegion( region );
+        scorep_compiler_enter_region( region );
     }
     else
     {
@@ -125,7 +125,7 @@ SCOREP_COMPILER_CYG_PROFILE_FUNC_EXIT( void* func,
                          SCOREP_RegionHandle_GetName( region ),
                          SCOREP_RegionHandle_GetFileName( region ),
                          SCOREP_RegionHandle_GetBeginLine( region ) );
-            SCOREP_ExitRegion( region );
+            scorep_compiler_exit_region( region );
         }
         else
         {
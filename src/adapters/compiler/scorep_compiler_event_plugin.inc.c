@@ -4,7 +4,7 @@
  * Copyright (c) 2012-2013, 2015-2016, 2020,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2022-2024,
+ * Copyright (c) 2022-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -66,7 +66,7 @@ scorep_plugin_enter_region( SCOREP_RegionHandle regionHandle )
      */
     if ( SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterRegion( regionHandle );
+        scorep_compiler_enter_region( regionHandle );
     }
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
@@ -82,7 +82,7 @@ scorep_plugin_exit_region( SCOREP_RegionHandle regionHandle )
      */
     if ( SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_ExitRegion( regionHandle );
+        scorep_compiler_exit_region( regionHandle );
     }
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2021-2024,
+ * Copyright (c) 2009-2015, 2021-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -36,10 +36,25 @@
 
 #include <SCOREP_Subsystem.h>
 #include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Config.h>
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Events.h>
+#include <SCOREP_Location.h>
+#include <SCOREP_Memory.h>
 
 #define SCOREP_DEBUG_MODULE_NAME COMPILER
 #include <UTILS_Debug.h>
 
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scorep_compiler_throttling.h"
+
+#include "scorep_compiler_confvars.inc.c"
+
+size_t scorep_compiler_subsystem_id;
+
 
 #if HAVE( SCOREP_COMPILER_INSTRUMENTATION_PLUGIN )
 #include "scorep_compiler_mgmt_plugin.inc.c"
@@ -50,6 +65,17 @@
 #endif /* HAVE( SCOREP_COMPILER_INSTRUMENTATION_NEEDS_ADDR2LINE ) */
 
 
+static SCOREP_ErrorCode
+compiler_subsystem_register( size_t subsystemId )
+{
+    UTILS_DEBUG( "Register environment variables" );
+
+    scorep_compiler_subsystem_id = subsystemId;
+
+    return SCOREP_ConfigRegister( "compiler", scorep_compiler_confvars );
+}
+
+
 static SCOREP_ErrorCode
 compiler_subsystem_init( void )
 {
@@ -68,9 +94,151 @@ compiler_subsystem_init( void )
 }
 
 
+static SCOREP_ErrorCode
+compiler_subsystem_init_location( SCOREP_Location* location,
+                                  SCOREP_Location* parent )
+{
+    if ( !scorep_compiler_throttling
+         || SCOREP_Location_GetType( location ) != SCOREP_LOCATION_TYPE_CPU_THREAD )
+    {
+        return SCOREP_SUCCESS;
+    }
+
+    scorep_compiler_throttling_data* data =
+        SCOREP_Location_AllocForMisc( location, sizeof( *data ) );
+    memset( data, 0, sizeof( *data ) );
+    SCOREP_Location_SetSubsystemData( location, scorep_compiler_subsystem_id, data );
+
+    return SCOREP_SUCCESS;
+}
+
+
+bool
+scorep_compiler_throttling_grow_table( SCOREP_Location*                 location,
+                                       scorep_compiler_throttling_data* data )
+{
+    uint32_t table_size = data->table_size == 0
+                          ? SCOREP_COMPILER_THROTTLING_INITIAL_TABLE_SIZE
+                          : 2 * data->table_size;
+    if ( table_size > SCOREP_COMPILER_THROTTLING_MAX_TABLE_SIZE )
+    {
+        return false;
+    }
+
+    scorep_compiler_throttling_entry* entries =
+        SCOREP_Location_AllocForMisc( location, table_size * sizeof( *entries ) );
+    memset( entries, 0, table_size * sizeof( *entries ) );
+    for ( uint32_t i = 0; i < data->table_size; i++ )
+    {
+        if ( data->entries[ i ].region != SCOREP_INVALID_REGION )
+        {
+            *scorep_compiler_throttling_find_slot( entries, table_size,
+                                                   data->entries[ i ].region ) = data->entries[ i ];
+        }
+    }
+
+    /* Misc memory cannot be freed, the old table is wasted. As the table
+     * grows geometrically, this is at most its final size. */
+    data->entries    = entries;
+    data->table_size = table_size;
+    return true;
+}
+
+
+bool
+scorep_compiler_throttling_grow_stack( SCOREP_Location*                 location,
+                                       scorep_compiler_throttling_data* data )
+{
+    uint32_t stack_depth = data->stack_depth == 0
+                           ? SCOREP_COMPILER_THROTTLING_INITIAL_STACK_DEPTH
+                           : 2 * data->stack_depth;
+    if ( stack_depth > SCOREP_COMPILER_THROTTLING_MAX_STACK_DEPTH )
+    {
+        return false;
+    }
+
+    scorep_compiler_throttling_frame* stack =
+        SCOREP_Location_AllocForMisc( location, stack_depth * sizeof( *stack ) );
+    if ( data->stack_depth != 0 )
+    {
+        memcpy( stack, data->stack, data->stack_depth * sizeof( *stack ) );
+    }
+
+    data->stack       = stack;
+    data->stack_depth = stack_depth;
+    return true;
+}
+
+
+/**
+ * Adds the names of all regions throttled on @a location as location
+ * property COMPILER_THROTTLED_REGIONS, separated by newlines.
+ */
+static bool
+report_throttled_regions( SCOREP_Location* location,
+                          void*            arg )
+{
+    scorep_compiler_throttling_data* data =
+        SCOREP_Location_GetSubsystemData( location, scorep_compiler_subsystem_id );
+    if ( !data || data->number_of_throttled_regions == 0 )
+    {
+        return false;
+    }
+
+    size_t length = 0;
+    for ( uint32_t i = 0; i < data->table_size; i++ )
+    {
+        if ( data->entries[ i ].throttled )
+        {
+            length += strlen( SCOREP_RegionHandle_GetName( data->entries[ i ].region ) ) + 1;
+        }
+    }
+
+    char* names = malloc( length );
+    UTILS_ASSERT( names );
+    char* pos = names;
+    for ( uint32_t i = 0; i < data->table_size; i++ )
+    {
+        if ( data->entries[ i ].throttled )
+        {
+            const char* name = SCOREP_RegionHandle_GetName( data->entries[ i ].region );
+            if ( pos != names )
+            {
+                *pos++ = '\n';
+            }
+            strcpy( pos, name );
+            pos += strlen( name );
+        }
+    }
+
+    UTILS_DEBUG( "Location %" PRIu64 " throttled %" PRIu32 " regions",
+                 SCOREP_Location_GetId( location ),
+                 data->number_of_throttled_regions );
+    SCOREP_Location_AddLocationProperty( location, "COMPILER_THROTTLED_REGIONS", 0, names );
+    free( names );
+
+    return false;
+}
+
+
+static SCOREP_ErrorCode
+compiler_subsystem_pre_unify( void )
+{
+    if ( scorep_compiler_throttling )
+    {
+        SCOREP_Location_ForAll( report_throttled_regions, NULL );
+    }
+
+    return SCOREP_SUCCESS;
+}
+
+
 /* Implementation of the compiler adapter initialization/finalization struct */
 const SCOREP_Subsystem SCOREP_Subsystem_CompilerAdapter =
 {
-    .subsystem_name = "COMPILER",
-    .subsystem_init = &compiler_subsystem_init,
+    .subsystem_name          = "COMPILER",
+    .subsystem_register      = &compiler_subsystem_register,
+    .subsystem_init          = &compiler_subsystem_init,
+    .subsystem_init_location = &compiler_subsystem_init_location,
+    .subsystem_pre_unify     = &compiler_subsystem_pre_unify,
 };
@@ -0,0 +1,267 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+#ifndef SCOREP_COMPILER_THROTTLING_H
+#define SCOREP_COMPILER_THROTTLING_H
+
+/**
+ * @file
+ *
+ * @brief Runtime throttling of frequently visited, short compiler-instrumented
+ * regions.
+ *
+ * Each CPU location keeps a small open-addressing table with the visit count
+ * and the accumulated inclusive duration of the compiler regions it recorded.
+ * Once a region was visited SCOREP_COMPILER_THROTTLING_VISITS times and its
+ * mean inclusive duration is below SCOREP_COMPILER_THROTTLING_TICKS, further
+ * enters of this region on this location are not passed to the measurement
+ * system anymore.
+ *
+ * The durations are derived from the last timestamp of the location taken by
+ * SCOREP_EnterRegion/SCOREP_ExitRegion, thus throttling does not read the
+ * timer itself. Each table entry counts the enters of its region that were
+ * skipped because of throttling and are still open on this location, the
+ * same number of exits is skipped. This keeps enter and exit events balanced
+ * if a region gets throttled while instances of it are active, e.g., for
+ * recursive regions.
+ *
+ * The table and the stack of enter timestamps are allocated on the first
+ * compiler event of a location and grow on demand, thus locations without
+ * compiler-instrumented code do not pay for them.
+ */
+
+#include <SCOREP_Events.h>
+#include <SCOREP_Location.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** Initial number of table entries per location, needs to be a power of two. */
+#define SCOREP_COMPILER_THROTTLING_INITIAL_TABLE_SIZE 64
+
+/** Maximal number of table entries per location, needs to be a power of two.
+ *  The table is kept at most half full, further regions are never throttled. */
+#define SCOREP_COMPILER_THROTTLING_MAX_TABLE_SIZE 2048
+
+/** Initial depth of the per-location stack of enter timestamps. */
+#define SCOREP_COMPILER_THROTTLING_INITIAL_STACK_DEPTH 32
+
+/** Maximal depth of the per-location stack of enter timestamps. Deeper nested
+ *  regions are still recorded, but do not contribute to the statistics. */
+#define SCOREP_COMPILER_THROTTLING_MAX_STACK_DEPTH 256
+
+typedef struct
+{
+    SCOREP_RegionHandle region;
+    bool                throttled;
+    uint32_t            skipped_enters;
+    uint64_t            visits;
+    uint64_t            ticks;
+} scorep_compiler_throttling_entry;
+
+typedef struct
+{
+    SCOREP_RegionHandle region;
+    uint64_t            timestamp;
+} scorep_compiler_throttling_frame;
+
+typedef struct
+{
+    uint32_t                          depth;
+    uint32_t                          stack_depth;
+    uint32_t                          table_size;
+    uint32_t                          number_of_entries;
+    uint32_t                          number_of_throttled_regions;
+    scorep_compiler_throttling_frame* stack;
+    scorep_compiler_throttling_entry* entries;
+} scorep_compiler_throttling_data;
+
+
+extern bool     scorep_compiler_throttling;
+extern uint64_t scorep_compiler_throttling_visits;
+extern uint64_t scorep_compiler_throttling_ticks;
+extern size_t   scorep_compiler_subsystem_id;
+
+
+/**
+ * Doubles the table of @a data, or allocates the initial one.
+ * @return False if the table has already its maximal size.
+ */
+bool
+scorep_compiler_throttling_grow_table( SCOREP_Location*                 location,
+                                       scorep_compiler_throttling_data* data );
+
+
+/**
+ * Doubles the stack of enter timestamps of @a data, or allocates the initial
+ * one.
+ * @return False if the stack has already its maximal depth.
+ */
+bool
+scorep_compiler_throttling_grow_stack( SCOREP_Location*                 location,
+                                       scorep_compiler_throttling_data* data );
+
+
+/**
+ * Returns the slot of @a region in a table of @a tableSize entries, i.e.,
+ * the slot holding @a region or the empty slot where it would be inserted.
+ */
+static inline scorep_compiler_throttling_entry*
+scorep_compiler_throttling_find_slot( scorep_compiler_throttling_entry* entries,
+                                      uint32_t                          tableSize,
+                                      SCOREP_RegionHandle               region )
+{
+    uint32_t index = ( uint32_t )region * UINT32_C( 0x9E3779B1 );
+    while ( true )
+    {
+        index &= tableSize - 1;
+        if ( entries[ index ].region == region
+             || entries[ index ].region == SCOREP_INVALID_REGION )
+        {
+            return &entries[ index ];
+        }
+        index++;
+    }
+}
+
+
+/**
+ * Returns the table entry for @a region, inserts it if not yet present.
+ * Returns NULL if the table is full, such regions are never throttled.
+ */
+static inline scorep_compiler_throttling_entry*
+scorep_compiler_throttling_get_entry( SCOREP_Location*                 location,
+                                      scorep_compiler_throttling_data* data,
+                                      SCOREP_RegionHandle              region )
+{
+    if ( data->table_size == 0
+         && !scorep_compiler_throttling_grow_table( location, data ) )
+    {
+        return NULL;
+    }
+
+    scorep_compiler_throttling_entry* entry =
+        scorep_compiler_throttling_find_slot( data->entries, data->table_size, region );
+    if ( entry->region == region )
+    {
+        return entry;
+    }
+
+    if ( 2 * ( data->number_of_entries + 1 ) > data->table_size )
+    {
+        if ( !scorep_compiler_throttling_grow_table( location, data ) )
+        {
+            return NULL;
+        }
+        entry = scorep_compiler_throttling_find_slot( data->entries, data->table_size, region );
+    }
+    entry->region = region;
+    data->number_of_entries++;
+    return entry;
+}
+
+
+static inline scorep_compiler_throttling_data*
+scorep_compiler_throttling_get_data( SCOREP_Location* location )
+{
+    if ( !scorep_compiler_throttling )
+    {
+        return NULL;
+    }
+    return SCOREP_Location_GetSubsystemData( location, scorep_compiler_subsystem_id );
+}
+
+
+/**
+ * Enters @a region, unless it got throttled on the current location.
+ */
+static inline void
+scorep_compiler_enter_region( SCOREP_RegionHandle region )
+{
+    SCOREP_Location*                 location = SCOREP_Location_GetCurrentCPULocation();
+    scorep_compiler_throttling_data* data     = scorep_compiler_throttling_get_data( location );
+    if ( !data )
+    {
+        SCOREP_EnterRegion( region );
+        return;
+    }
+
+    scorep_compiler_throttling_entry* entry =
+        scorep_compiler_throttling_get_entry( location, data, region );
+    if ( entry && entry->throttled )
+    {
+        entry->skipped_enters++;
+        return;
+    }
+
+    SCOREP_EnterRegion( region );
+
+    if ( data->depth < data->stack_depth
+         || scorep_compiler_throttling_grow_stack( location, data ) )
+    {
+        data->stack[ data->depth ].region    = region;
+        data->stack[ data->depth ].timestamp = SCOREP_Location_GetLastTimestamp( location );
+    }
+    data->depth++;
+}
+
+
+/**
+ * Exits @a region, unless its enter was skipped because of throttling.
+ * Updates the statistics of @a region and decides whether to throttle it.
+ */
+static inline void
+scorep_compiler_exit_region( SCOREP_RegionHandle region )
+{
+    SCOREP_Location*                 location = SCOREP_Location_GetCurrentCPULocation();
+    scorep_compiler_throttling_data* data     = scorep_compiler_throttling_get_data( location );
+    if ( !data )
+    {
+        SCOREP_ExitRegion( region );
+        return;
+    }
+
+    scorep_compiler_throttling_entry* entry =
+        scorep_compiler_throttling_get_entry( location, data, region );
+    if ( entry && entry->skipped_enters > 0 )
+    {
+        /* The matching enter was skipped. */
+        entry->skipped_enters--;
+        return;
+    }
+
+    SCOREP_ExitRegion( region );
+
+    if ( data->depth == 0 )
+    {
+        return;
+    }
+    data->depth--;
+    if ( !entry || entry->throttled
+         || data->depth >= data->stack_depth
+         || data->stack[ data->depth ].region != region )
+    {
+        return;
+    }
+
+    entry->visits++;
+    entry->ticks += SCOREP_Location_GetLastTimestamp( location )
+                    - data->stack[ data->depth ].timestamp;
+    if ( entry->visits >= scorep_compiler_throttling_visits
+         && entry->ticks < entry->visits * scorep_compiler_throttling_ticks )
+    {
+        entry->throttled = true;
+        data->number_of_throttled_regions++;
+    }
+}
+
+#endif /* SCOREP_COMPILER_THROTTLING_H */
@@ -7,6 +7,9 @@
  * Copyright (c) 2021,
  * Deutsches Zentrum fuer Luft- und Raumfahrt, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license.  See the COPYING file in the package base
  * directory for details.
@@ -112,7 +115,7 @@ SCOREP_LIBWRAP_WRAPPER( close )( int fd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_close );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_close ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                        &fd );
@@ -160,7 +163,7 @@ SCOREP_LIBWRAP_WRAPPER( closedir )( DIR* dirp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_closedir );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_closedir ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_INVALID_IO_HANDLE;
         int                   fd     = dirfd( dirp );
@@ -214,7 +217,7 @@ SCOREP_LIBWRAP_WRAPPER( creat )( const char* pathname, mode_t mode )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_creat );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_creat ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_POSIX,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -268,7 +271,7 @@ SCOREP_LIBWRAP_WRAPPER( creat64 )( const char* pathname, mode_t mode )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_creat64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_creat64 ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_POSIX,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -321,7 +324,7 @@ SCOREP_LIBWRAP_WRAPPER( dup )( int oldfd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_dup );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_dup ) );
 
         SCOREP_IoHandleHandle old_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &oldfd );
 
@@ -380,7 +383,7 @@ SCOREP_LIBWRAP_WRAPPER( dup2 )( int oldfd, int newfd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_dup2 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_dup2 ) );
 
         SCOREP_IoHandleHandle new_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &newfd );
         SCOREP_IoHandleHandle old_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &oldfd );
@@ -459,7 +462,7 @@ SCOREP_LIBWRAP_WRAPPER( dup3 )( int oldfd, int newfd, int flags )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_dup3 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_dup3 ) );
 
         SCOREP_IoHandleHandle new_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &newfd );
         SCOREP_IoHandleHandle old_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &oldfd );
@@ -525,7 +528,7 @@ SCOREP_LIBWRAP_WRAPPER( fcntl )( int fd, int cmd, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fcntl );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fcntl ) );
     }
 
     int                   int_arg;
@@ -751,7 +754,7 @@ SCOREP_LIBWRAP_WRAPPER( fdatasync )( int fd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fdatasync );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fdatasync ) );
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
         if ( io_handle != SCOREP_INVALID_IO_HANDLE )
         {
@@ -795,7 +798,7 @@ SCOREP_LIBWRAP_WRAPPER( fsync )( int fd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fsync );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fsync ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
         if ( io_handle != SCOREP_INVALID_IO_HANDLE )
@@ -840,7 +843,7 @@ SCOREP_LIBWRAP_WRAPPER( lockf )( int fd, int cmd, off_t len )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_lockf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_lockf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
         if ( handle != SCOREP_INVALID_IO_HANDLE && cmd == F_ULOCK )
@@ -892,7 +895,7 @@ SCOREP_LIBWRAP_WRAPPER( lseek )( int fd, off_t offset, int whence )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_lseek );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_lseek ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
 
@@ -928,7 +931,7 @@ SCOREP_LIBWRAP_WRAPPER( lseek64 )( int fd, scorep_off64_t offset, int whence )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_lseek64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_lseek64 ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
 
@@ -964,7 +967,7 @@ SCOREP_LIBWRAP_WRAPPER( open )( const char* pathname, int flags, ... /* mode_t m
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_open );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_open ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_POSIX,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -1043,7 +1046,7 @@ SCOREP_LIBWRAP_WRAPPER( open64 )( const char* pathname, int flags, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_open64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_open64 ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_POSIX,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -1120,7 +1123,7 @@ SCOREP_LIBWRAP_WRAPPER( openat )( int dirfd, const char* pathname, int flags, ..
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_openat );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_openat ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_POSIX,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -1212,7 +1215,7 @@ SCOREP_LIBWRAP_WRAPPER( pread )( int fd, void* buf, size_t count, off_t offset )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pread );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pread ) );
 
         /*
          * Reads up to 'count' bytes from file descriptor 'fd' at offset 'offset' (from the start of the file) into the buffer starting at 'buf'.
@@ -1264,7 +1267,7 @@ SCOREP_LIBWRAP_WRAPPER( pread64 )( int fd, void* buf, size_t count, scorep_off64
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pread64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pread64 ) );
 
         /*
          * Reads up to 'count' bytes from file descriptor 'fd' at offset 'offset' (from the start of the file) into the buffer starting at 'buf'.
@@ -1316,7 +1319,7 @@ SCOREP_LIBWRAP_WRAPPER( preadv )( int fd, const struct iovec* iov, int iovcnt, o
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_preadv );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_preadv ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1362,7 +1365,7 @@ SCOREP_LIBWRAP_WRAPPER( preadv2 )( int fd, const struct iovec* iov, int iovcnt,
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_preadv2 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_preadv2 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1408,7 +1411,7 @@ SCOREP_LIBWRAP_WRAPPER( preadv64 )( int fd, const struct iovec* iov, int iovcnt,
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_preadv64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_preadv64 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1454,7 +1457,7 @@ SCOREP_LIBWRAP_WRAPPER( preadv64v2 )( int fd, const struct iovec* iov, int iovcn
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_preadv64v2 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_preadv64v2 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1500,7 +1503,7 @@ SCOREP_LIBWRAP_WRAPPER( pselect )( int nfds, fd_set* readfds, fd_set* writefds,
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pselect );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pselect ) );
         SCOREP_ENTER_WRAPPED_REGION();
         ret = SCOREP_LIBWRAP_ORIGINAL( pselect )(
             nfds, readfds, writefds, exceptfds, timeout, sigmask );
@@ -1524,7 +1527,7 @@ SCOREP_LIBWRAP_WRAPPER( pwrite )( int fd, const void* buf, size_t count, off_t o
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwrite );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwrite ) );
 
         /*
          * Writes up to 'count' bytes from the buffer starting at 'buf' to the file descriptor 'fd' at offset 'offset'.
@@ -1576,7 +1579,7 @@ SCOREP_LIBWRAP_WRAPPER( pwrite64 )( int fd, const void* buf, size_t count, score
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwrite64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwrite64 ) );
 
         /*
          * Writes up to 'count' bytes from the buffer starting at 'buf' to the file descriptor 'fd' at offset 'offset'.
@@ -1628,7 +1631,7 @@ SCOREP_LIBWRAP_WRAPPER( pwritev )( int fd, const struct iovec* iov, int iovcnt,
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwritev );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwritev ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1674,7 +1677,7 @@ SCOREP_LIBWRAP_WRAPPER( pwritev2 )( int fd, const struct iovec* iov, int iovcnt,
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwritev2 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwritev2 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1728,7 +1731,7 @@ SCOREP_LIBWRAP_WRAPPER( pwritev64 )( int fd, const struct iovec* iov, int iovcnt
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwritev64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwritev64 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1774,7 +1777,7 @@ SCOREP_LIBWRAP_WRAPPER( pwritev64v2 )( int fd, const struct iovec* iov, int iovc
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_pwritev64v2 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_pwritev64v2 ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1828,7 +1831,7 @@ SCOREP_LIBWRAP_WRAPPER( read )( int fd, void* buf, size_t count )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_read );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_read ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1874,7 +1877,7 @@ SCOREP_LIBWRAP_WRAPPER( readv )( int fd, const struct iovec* iov, int iovcnt )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_readv );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_readv ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -1920,7 +1923,7 @@ SCOREP_LIBWRAP_WRAPPER( select )( int nfds, fd_set* readfds, fd_set* writefds, f
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_select );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_select ) );
         SCOREP_ENTER_WRAPPED_REGION();
         ret = SCOREP_LIBWRAP_ORIGINAL( select )( nfds, readfds, writefds, exceptfds, timeout );
         SCOREP_EXIT_WRAPPED_REGION();
@@ -1941,7 +1944,7 @@ SCOREP_LIBWRAP_WRAPPER( sync )( void )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_sync );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_sync ) );
 
         SCOREP_IoMgmt_PushHandle( scorep_posix_io_sync_all_handle );
 
@@ -1980,7 +1983,7 @@ SCOREP_LIBWRAP_WRAPPER( syncfs )( int fd )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_syncfs );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_syncfs ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &fd );
@@ -2026,7 +2029,7 @@ SCOREP_LIBWRAP_WRAPPER( unlink )( const char* pathname )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_unlink );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_unlink ) );
 
         SCOREP_IoFileHandle file_handle = SCOREP_IoMgmt_GetIoFileHandle( pathname );
 
@@ -2058,7 +2061,7 @@ SCOREP_LIBWRAP_WRAPPER( unlinkat )( int dirfd, const char* pathname, int flags )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_unlinkat );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_unlinkat ) );
 
         char                  file_path[ PATH_MAX ];
         SCOREP_IoFileHandle   file_handle      = SCOREP_INVALID_IO_FILE;
@@ -2113,7 +2116,7 @@ SCOREP_LIBWRAP_WRAPPER( write )( int fd, const void* buf, size_t count )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_write );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_write ) );
 
         SCOREP_IoFileHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                      &fd );
@@ -2158,7 +2161,7 @@ SCOREP_LIBWRAP_WRAPPER( writev )( int fd, const struct iovec* iov, int iovcnt )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_writev );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_writev ) );
 
         SCOREP_IoFileHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                      &fd );
@@ -56,7 +56,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_cancel )( int fd, struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_cancel );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_cancel ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                        &fd );
@@ -99,7 +99,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_error )( const struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_error );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_error ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                        &( aiocbp->aio_fildes ) );
@@ -147,7 +147,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_fsync )( int op, struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_fsync );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_fsync ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_INVALID_IO_HANDLE;
 
@@ -181,7 +181,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_read )( struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_read );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_read ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &( aiocbp->aio_fildes ) );
@@ -228,7 +228,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_return )( struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_return );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_return ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                        &( aiocbp->aio_fildes ) );
@@ -268,7 +268,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_suspend )( const struct aiocb* const aiocb_list[], i
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_suspend );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_suspend ) );
         SCOREP_ENTER_WRAPPED_REGION();
         ret = SCOREP_LIBWRAP_ORIGINAL( aio_suspend )( aiocb_list, nitems, timeout );
         SCOREP_EXIT_WRAPPED_REGION();
@@ -290,7 +290,7 @@ SCOREP_LIBWRAP_WRAPPER( aio_write )( struct aiocb* aiocbp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_aio_write );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_aio_write ) );
 
         SCOREP_IoHandleHandle io_handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_POSIX,
                                                                           &( aiocbp->aio_fildes ) );
@@ -339,7 +339,7 @@ SCOREP_LIBWRAP_WRAPPER( lio_listio )( int mode, struct aiocb* const aiocb_list[]
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) && ( aio_translate_mode( mode, &io_operation_flags ) != -1 ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_lio_listio );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_lio_listio ) );
 
         struct aiocb*          aiocbp;
         SCOREP_IoHandleHandle  handle;
@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2020, 2023, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -190,7 +190,7 @@ SCOREP_LIBWRAP_WRAPPER( fclose )( FILE* fp )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fclose );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fclose ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_RemoveHandle( SCOREP_IO_PARADIGM_ISOC,
                                                                    &fp );
@@ -256,7 +256,7 @@ SCOREP_LIBWRAP_WRAPPER( fdopen )( int fd, const char* mode )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fdopen );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fdopen ) );
 
         SCOREP_IoHandleHandle fd_handle = SCOREP_IoMgmt_GetIoHandle( SCOREP_IO_PARADIGM_POSIX, &fd );
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_ISOC,
@@ -305,7 +305,7 @@ SCOREP_LIBWRAP_WRAPPER( fflush )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fflush );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fflush ) );
 
         SCOREP_IoHandleHandle io_handle;
         if ( stream == NULL )
@@ -360,7 +360,7 @@ SCOREP_LIBWRAP_WRAPPER( fgetc )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fgetc );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fgetc ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -405,7 +405,7 @@ SCOREP_LIBWRAP_WRAPPER( fgetpos )( FILE* stream, fpos_t* pos )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fgetpos );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fgetpos ) );
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         SCOREP_ENTER_WRAPPED_REGION();
         ret = SCOREP_LIBWRAP_ORIGINAL( fgetpos )( stream, pos );
@@ -429,7 +429,7 @@ SCOREP_LIBWRAP_WRAPPER( fgets )( char* s, int size, FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fgets );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fgets ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -473,7 +473,7 @@ SCOREP_LIBWRAP_WRAPPER( flockfile )( FILE* filehandle )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_flockfile );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_flockfile ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &filehandle );
 
@@ -526,7 +526,7 @@ SCOREP_LIBWRAP_WRAPPER( fopen )( const char* path, const char* mode )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fopen );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fopen ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_ISOC,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -618,7 +618,7 @@ SCOREP_LIBWRAP_WRAPPER( fopen64 )( const char* path, const char* mode )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fopen64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fopen64 ) );
 
         SCOREP_IoMgmt_BeginHandleCreation( SCOREP_IO_PARADIGM_ISOC,
                                            SCOREP_IO_HANDLE_FLAG_NONE,
@@ -682,7 +682,7 @@ SCOREP_LIBWRAP_WRAPPER( fputc )( int c, FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fputc );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fputc ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -727,7 +727,7 @@ SCOREP_LIBWRAP_WRAPPER( fprintf )( FILE* stream, const char* format, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fprintf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fprintf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -780,7 +780,7 @@ SCOREP_LIBWRAP_WRAPPER( fputs )( const char* s, FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fputs );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fputs ) );
 
         uint64_t              length = ( uint64_t )strlen( s );
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
@@ -826,7 +826,7 @@ SCOREP_LIBWRAP_WRAPPER( fread )( void* ptr, size_t size, size_t nmemb, FILE* str
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fread );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fread ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -871,7 +871,7 @@ SCOREP_LIBWRAP_WRAPPER( freopen )( const char* path, const char* mode, FILE* str
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_freopen );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_freopen ) );
 
         // Case: stream will be closed by freopen
         SCOREP_IoHandleHandle old_handle = SCOREP_IoMgmt_RemoveHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
@@ -944,7 +944,7 @@ SCOREP_LIBWRAP_WRAPPER( fscanf )( FILE* stream, const char* format, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fscanf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fscanf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -998,7 +998,7 @@ SCOREP_LIBWRAP_WRAPPER( fseek )( FILE* stream, long offset, int whence )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fseek );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fseek ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1036,7 +1036,7 @@ SCOREP_LIBWRAP_WRAPPER( fseeko )( FILE* stream, off_t offset, int whence )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fseeko );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fseeko ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1072,7 +1072,7 @@ SCOREP_LIBWRAP_WRAPPER( fseeko64 )( FILE* stream, scorep_off64_t offset, int whe
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fseeko64 );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fseeko64 ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1109,7 +1109,7 @@ SCOREP_LIBWRAP_WRAPPER( fsetpos )( FILE* stream, const fpos_t* pos )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fsetpos );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fsetpos ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1147,7 +1147,7 @@ SCOREP_LIBWRAP_WRAPPER( ftell )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_ftell );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_ftell ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1175,7 +1175,7 @@ SCOREP_LIBWRAP_WRAPPER( ftello )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_ftello );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_ftello ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1203,7 +1203,7 @@ SCOREP_LIBWRAP_WRAPPER( ftrylockfile )( FILE* filehandle )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_ftrylockfile );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_ftrylockfile ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &filehandle );
 
@@ -1242,7 +1242,7 @@ SCOREP_LIBWRAP_WRAPPER( funlockfile )( FILE* filehandle )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_funlockfile );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_funlockfile ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &filehandle );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1273,7 +1273,7 @@ SCOREP_LIBWRAP_WRAPPER( fwrite )( const void* ptr, size_t size, size_t nmemb, FI
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_fwrite );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_fwrite ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1319,7 +1319,7 @@ SCOREP_LIBWRAP_WRAPPER( getc )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_getc );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_getc ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1364,7 +1364,7 @@ SCOREP_LIBWRAP_WRAPPER( getchar )( void )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_getchar );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_getchar ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdin );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1409,7 +1409,7 @@ SCOREP_LIBWRAP_WRAPPER( gets )( char* s )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_gets );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_gets ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdin );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1454,7 +1454,7 @@ SCOREP_LIBWRAP_WRAPPER( printf )( const char* format, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_printf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_printf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdout );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1505,7 +1505,7 @@ SCOREP_LIBWRAP_WRAPPER( putchar )( int c )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_putchar );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_putchar ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdout );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -1550,7 +1550,7 @@ SCOREP_LIBWRAP_WRAPPER( puts )( const char* s )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_puts );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_puts ) );
 
         uint64_t              length = ( uint64_t )strlen( s ) + 1 /* terminating null byte */;
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdout );
@@ -1596,7 +1596,7 @@ SCOREP_LIBWRAP_WRAPPER( remove )( const char* pathname )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_remove );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_remove ) );
 
         SCOREP_IoFileHandle file_handle = SCOREP_IoMgmt_GetIoFileHandle( pathname );
 
@@ -1627,7 +1627,7 @@ SCOREP_LIBWRAP_WRAPPER( rewind )( FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_rewind );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_rewind ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1662,7 +1662,7 @@ SCOREP_LIBWRAP_WRAPPER( scanf )( const char* format, ... )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_scanf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_scanf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, stdin );
 
@@ -1716,7 +1716,7 @@ SCOREP_LIBWRAP_WRAPPER( ungetc )( int c, FILE* stream )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_ungetc );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_ungetc ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1744,7 +1744,7 @@ SCOREP_LIBWRAP_WRAPPER( vfprintf )( FILE* stream, const char* format, va_list ap
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_vfprintf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_vfprintf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1790,7 +1790,7 @@ SCOREP_LIBWRAP_WRAPPER( vfscanf )( FILE* stream, const char* format, va_list ap
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_vfscanf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_vfscanf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stream );
 
@@ -1836,7 +1836,7 @@ SCOREP_LIBWRAP_WRAPPER( vscanf )( const char* format, va_list ap )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_vscanf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_vscanf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdin );
 
@@ -1882,7 +1882,7 @@ SCOREP_LIBWRAP_WRAPPER( vprintf )( const char* format, va_list ap )
 
     if ( trigger && SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
     {
-        SCOREP_EnterWrappedRegion( scorep_posix_io_region_vprintf );
+        SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_posix_io_region_vprintf ) );
 
         SCOREP_IoHandleHandle handle = SCOREP_IoMgmt_GetAndPushHandle( SCOREP_IO_PARADIGM_ISOC, &stdout );
         if ( handle != SCOREP_INVALID_IO_HANDLE )
@@ -4,6 +4,9 @@
  * Copyright (c) 2020, 2022, 2025,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license. See the COPYING file in the package base
  * directory for details.
@@ -47,9 +50,27 @@ extern size_t scorep_kokkos_subsystem_id;
 SCOREP_RmaWindowHandle
 scorep_kokkos_get_rma_win( void );
 
+/* Log2 of the number of entries in the per-location region cache. */
+#define SCOREP_KOKKOS_REGION_CACHE_SHIFT 6
+#define SCOREP_KOKKOS_REGION_CACHE_SIZE  ( 1 << SCOREP_KOKKOS_REGION_CACHE_SHIFT )
+
+/*
+ * Maps the label pointer passed by Kokkos to the resolved region handle,
+ * or SCOREP_FILTERED_REGION. As Kokkos may pass the same pointer with a
+ * different content, the hit is confirmed against @a label_copy.
+ */
+typedef struct scorep_kokkos_region_cache_entry
+{
+    const char*         label;
+    const char*         label_copy;
+    uint32_t            group;
+    SCOREP_RegionHandle region;
+} scorep_kokkos_region_cache_entry;
+
 typedef struct scorep_kokkos_cpu_location_data
 {
-    bool active_deep_copy;
+    bool                             active_deep_copy;
+    scorep_kokkos_region_cache_entry region_cache[ SCOREP_KOKKOS_REGION_CACHE_SIZE ];
 } scorep_kokkos_cpu_location_data;
 
 typedef struct scorep_kokkos_gpu_location_data
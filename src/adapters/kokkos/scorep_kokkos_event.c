@@ -4,7 +4,7 @@
  * Copyright (c) 2020, 2022, 2024-2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -34,6 +34,7 @@
 #define SCOREP_DEBUG_MODULE_NAME KOKKOS
 #include <UTILS_Debug.h>
 
+#include <UTILS_Atomic.h>
 #include <UTILS_CStr.h>
 #include <UTILS_Mutex.h>
 
@@ -185,6 +186,7 @@ get_region( scorep_kokkos_group group,
         node                         = SCOREP_Memory_AllocForMisc( sizeof( *node ) );
         node->region                 = region_handle;
         node->hash                   = hash;
+        node->group                  = group;
         node->next                   = kokkos_regions_hashtab[ id ];
         kokkos_regions_hashtab[ id ] = node;
     }
@@ -310,6 +312,151 @@ decode_parallel_region_name( const char** name )
     return result;
 }
 
+/*
+ * The key of the label node is the label as passed by Kokkos and its Kokkos
+ * group, the value is the region handle resolved from it, or
+ * SCOREP_FILTERED_REGION. Thus demangling and filtering is done only once per
+ * distinct label. Nodes are never removed, lookups do not need the mutex,
+ * which only serializes insertions.
+ */
+typedef struct scorep_kokkos_label_node
+{
+    struct scorep_kokkos_label_node* next;   /**< bucket for collision */
+    const char*                      label;  /**< copy of the label */
+    SCOREP_RegionHandle              region; /**< resolved region handle */
+    uint32_t                         hash;   /**< hash of label for faster comparison */
+    scorep_kokkos_group              group;  /**< ID of group for the label, also part of comparsion */
+} scorep_kokkos_label_node;
+
+#define KOKKOS_LABEL_HASH_SHIFT 10
+#define KOKKOS_LABEL_HASH_MASK  hashmask( KOKKOS_LABEL_HASH_SHIFT )
+#define KOKKOS_LABEL_HASH_SIZE  hashsize( KOKKOS_LABEL_HASH_SHIFT )
+
+static scorep_kokkos_label_node* kokkos_labels_hashtab[ KOKKOS_LABEL_HASH_SIZE ];
+static UTILS_Mutex               kokkos_labels_hashtab_mutex;
+
+static scorep_kokkos_label_node*
+find_label_node( scorep_kokkos_label_node* node,
+                 scorep_kokkos_group       group,
+                 const char*               label,
+                 uint32_t                  hash )
+{
+    while ( node )
+    {
+        if ( hash == node->hash
+             && group == node->group
+             && strcmp( node->label, label ) == 0 )
+        {
+            return node;
+        }
+        node = node->next;
+    }
+    return NULL;
+}
+
+/*
+ * Demangles and filters @a label, returns the region handle for it or
+ * SCOREP_FILTERED_REGION.
+ */
+static SCOREP_RegionHandle
+resolve_region( scorep_kokkos_group group,
+                const char*         label )
+{
+    const char* mangled_name = NULL;
+    const char* region_name  = label;
+    if ( group == scorep_kokkos_parallel_for
+         || group == scorep_kokkos_parallel_scan
+         || group == scorep_kokkos_parallel_reduce )
+    {
+        mangled_name = label;
+        region_name  = decode_parallel_region_name( &mangled_name );
+    }
+
+    SCOREP_RegionHandle region = SCOREP_FILTERED_REGION;
+    if ( SCOREP_Filtering_MatchFunction( region_name, mangled_name ) )
+    {
+        UTILS_DEBUG( "[Kokkos] %s %s filtered",
+                     scorep_kokkos_group_name( group ), region_name );
+    }
+    else
+    {
+        region = get_region( group, region_name, mangled_name );
+    }
+
+    if ( mangled_name )
+    {
+        free( ( char* )region_name );
+    }
+    return region;
+}
+
+static const scorep_kokkos_label_node*
+get_label_node( scorep_kokkos_group group,
+                const char*         label )
+{
+    uint32_t                   hash   = jenkins_hash( label, strlen( label ), 0 );
+    scorep_kokkos_label_node** bucket = &kokkos_labels_hashtab[ hash & KOKKOS_LABEL_HASH_MASK ];
+
+    scorep_kokkos_label_node* node =
+        find_label_node( UTILS_Atomic_LoadN_void_ptr( bucket, UTILS_ATOMIC_ACQUIRE ),
+                         group, label, hash );
+    if ( node )
+    {
+        return node;
+    }
+
+    UTILS_MutexLock( &kokkos_labels_hashtab_mutex );
+
+    node = find_label_node( *bucket, group, label, hash );
+    if ( !node )
+    {
+        size_t label_length = strlen( label ) + 1;
+        node = SCOREP_Memory_AllocForMisc( sizeof( *node ) + label_length );
+        memcpy( ( char* )( node + 1 ), label, label_length );
+        node->label  = ( const char* )( node + 1 );
+        node->region = resolve_region( group, label );
+        node->hash   = hash;
+        node->group  = group;
+        node->next   = *bucket;
+        UTILS_Atomic_StoreN_void_ptr( bucket, node, UTILS_ATOMIC_RELEASE );
+    }
+
+    UTILS_MutexUnlock( &kokkos_labels_hashtab_mutex );
+
+    return node;
+}
+
+/*
+ * Returns the region handle for @a label, or SCOREP_FILTERED_REGION. Repeated
+ * calls with the same label pointer are served from the per-location cache.
+ */
+static SCOREP_RegionHandle
+lookup_region( scorep_kokkos_group group,
+               const char*         label )
+{
+    SCOREP_Location*                 location = SCOREP_Location_GetCurrentCPULocation();
+    scorep_kokkos_cpu_location_data* data     =
+        SCOREP_Location_GetSubsystemData( location, scorep_kokkos_subsystem_id );
+
+    uint32_t index = ( ( uint32_t )( uintptr_t )label * UINT32_C( 0x9E3779B1 ) + group )
+                     >> ( 32 - SCOREP_KOKKOS_REGION_CACHE_SHIFT );
+    scorep_kokkos_region_cache_entry* entry = &data->region_cache[ index ];
+    if ( entry->label == label
+         && entry->group == group
+         && strcmp( entry->label_copy, label ) == 0 )
+    {
+        return entry->region;
+    }
+
+    const scorep_kokkos_label_node* node = get_label_node( group, label );
+    entry->label      = label;
+    entry->label_copy = node->label;
+    entry->group      = group;
+    entry->region     = node->region;
+
+    return node->region;
+}
+
 static void
 recording_setup( void )
 {
@@ -458,29 +605,13 @@ kokkosp_begin_parallel_for( const char*    name,
         return;
     }
 
-    const char* region_name = decode_parallel_region_name( &name );
-    if ( SCOREP_Filtering_MatchFunction( region_name, name ) )
-    {
-        if ( name )
-        {
-            free( ( char* )region_name );
-        }
-        UTILS_DEBUG( "[Kokkos] parallel_for %s filtered\n", name );
-        *kID = SCOREP_FILTERED_REGION;
-        SCOREP_IN_MEASUREMENT_DECREMENT();
-        return;
-    }
-
-    SCOREP_RegionHandle region = get_region( scorep_kokkos_parallel_for,
-                                             region_name, name );
-    if ( name )
+    SCOREP_RegionHandle region = lookup_region( scorep_kokkos_parallel_for, name );
+    *kID = ( uint64_t )region;
+    if ( region != SCOREP_FILTERED_REGION )
     {
-        free( ( char* )region_name );
+        SCOREP_EnterRegion( region );
     }
 
-    *kID = ( uint64_t )region;
-    SCOREP_EnterRegion( region );
-
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
 
@@ -528,29 +659,13 @@ kokkosp_begin_parallel_scan( const char*    name,
         return;
     }
 
-    const char* region_name = decode_parallel_region_name( &name );
-    if ( SCOREP_Filtering_MatchFunction( region_name, name ) )
-    {
-        if ( name )
-        {
-            free( ( char* )region_name );
-        }
-        UTILS_DEBUG( "[Kokkos] parallel_scan %s filtered\n", name );
-        *kID = SCOREP_FILTERED_REGION;
-        SCOREP_IN_MEASUREMENT_DECREMENT();
-        return;
-    }
-
-    SCOREP_RegionHandle region = get_region( scorep_kokkos_parallel_scan,
-                                             region_name, name );
-    if ( name )
+    SCOREP_RegionHandle region = lookup_region( scorep_kokkos_parallel_scan, name );
+    *kID = ( uint64_t )region;
+    if ( region != SCOREP_FILTERED_REGION )
     {
-        free( ( char* )region_name );
+        SCOREP_EnterRegion( region );
     }
 
-    *kID = ( uint64_t )region;
-    SCOREP_EnterRegion( region );
-
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
 
@@ -597,29 +712,13 @@ kokkosp_begin_parallel_reduce( const char*    name,
         return;
     }
 
-    const char* region_name = decode_parallel_region_name( &name );
-    if ( SCOREP_Filtering_MatchFunction( region_name, name ) )
-    {
-        if ( name )
-        {
-            free( ( char* )region_name );
-        }
-        UTILS_DEBUG( "[Kokkos] parallel_reduce %s filtered\n", name );
-        *kID = SCOREP_FILTERED_REGION;
-        SCOREP_IN_MEASUREMENT_DECREMENT();
-        return;
-    }
-
-    SCOREP_RegionHandle region = get_region( scorep_kokkos_parallel_reduce,
-                                             region_name, name );
-    if ( name )
+    SCOREP_RegionHandle region = lookup_region( scorep_kokkos_parallel_reduce, name );
+    *kID = ( uint64_t )region;
+    if ( region != SCOREP_FILTERED_REGION )
     {
-        free( ( char* )region_name );
+        SCOREP_EnterRegion( region );
     }
 
-    *kID = ( uint64_t )region;
-    SCOREP_EnterRegion( region );
-
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
 
@@ -850,16 +949,14 @@ kokkosp_push_profile_region( const char* name )
         return;
     }
 
-    if ( SCOREP_Filtering_MatchFunction( name, NULL ) )
+    SCOREP_RegionHandle region = lookup_region( scorep_kokkos_profile_region, name );
+    if ( region == SCOREP_FILTERED_REGION )
     {
         SCOREP_Task_Enter( SCOREP_Location_GetCurrentCPULocation(), SCOREP_FILTERED_REGION );
         SCOREP_IN_MEASUREMENT_DECREMENT();
         return;
     }
 
-    SCOREP_RegionHandle region = get_region( scorep_kokkos_profile_region,
-                                             name, NULL );
-
     SCOREP_EnterRegion( region );
 
     SCOREP_IN_MEASUREMENT_DECREMENT();
@@ -939,14 +1036,7 @@ kokkosp_create_profile_section( const char* name,
         return;
     }
 
-    if ( SCOREP_Filtering_MatchFunction( name, NULL ) )
-    {
-        *sectionId = SCOREP_FILTERED_REGION;
-        SCOREP_IN_MEASUREMENT_DECREMENT();
-        return;
-    }
-
-    *sectionId = get_region( scorep_kokkos_profile_section, name, NULL );
+    *sectionId = lookup_region( scorep_kokkos_profile_section, name );
 
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
@@ -4,6 +4,9 @@
  * Copyright (c) 2020, 2022-2023, 2025,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license. See the COPYING file in the package base
  * directory for details.
@@ -37,6 +40,7 @@
 
 #include <stdbool.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "scorep_kokkos_confvars.inc.c"
 
@@ -75,7 +79,7 @@ static void
 init_host_location( SCOREP_Location* location )
 {
     scorep_kokkos_cpu_location_data* data = SCOREP_Memory_AllocForMisc( sizeof( *data ) );
-    data->active_deep_copy = false;
+    memset( data, 0, sizeof( *data ) );
     SCOREP_Location_SetSubsystemData( location, scorep_kokkos_subsystem_id, data );
 }
 
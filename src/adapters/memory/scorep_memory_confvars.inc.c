@@ -5,7 +5,7 @@
  * Copyright (c) 2016,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016,
+ * Copyright (c) 2016, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -23,6 +23,8 @@
 
 bool scorep_memory_recording;
 
+uint64_t scorep_memory_sampling_interval;
+
 /*
  *  Configuration variables for the MEMORY adapter.
  */
@@ -36,5 +38,28 @@ static const SCOREP_ConfigVariable scorep_memory_confvars[] = {
         "Memory recording",
         "Memory (de)allocations are recorded via the libc/C++ API."
     },
+    {
+        "sampling_interval",
+        SCOREP_CONFIG_TYPE_SIZE,
+        &scorep_memory_sampling_interval,
+        NULL,
+        "0",
+        "Mean number of allocated bytes between two recorded allocations",
+        "If not zero, only a sample of the memory allocations is recorded. "
+        "Each thread records on average one allocation per given number of "
+        "allocated bytes, an allocation of `s` bytes is recorded with "
+        "probability `1 - exp(-s/interval)`. Deallocations are recorded only "
+        "for recorded allocations.\n"
+        "\n"
+        "Recorded allocations are extrapolated to the bytes they represent, "
+        "the memory metrics and the allocation and deallocation sizes are "
+        "thus estimates. The relative standard error of the memory in use is "
+        "about `sqrt(interval / memory in use)`, e.g., 1% for 1 MiB with an "
+        "interval of 100 bytes. The exact numbers of allocations, allocated "
+        "bytes, and deallocations are recorded per location as location "
+        "properties.\n"
+        "\n"
+        "With zero, all memory (de)allocations are recorded."
+    },
     SCOREP_CONFIG_TERMINATOR
 };
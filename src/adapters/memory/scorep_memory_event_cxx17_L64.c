@@ -0,0 +1,23 @@
+/**
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ */
+
+/**
+ * Implementation of all __wrap_* functions used by the memory library wrapper
+ */
+
+#include <config.h>
+
+#include "scorep_memory_event_functions.h"
+
+SCOREP_MEMORY_WRAP_MALLOC_ALIGNED( _ZnwmSt11align_val_t, NEW_ALIGNED )
+SCOREP_MEMORY_WRAP_MALLOC_ALIGNED( _ZnamSt11align_val_t, NEW_ARRAY_ALIGNED )
+SCOREP_MEMORY_WRAP_FREE_SIZE_ALIGNED( _ZdlPvmSt11align_val_t, DELETE_SIZE_ALIGNED )
+SCOREP_MEMORY_WRAP_FREE_SIZE_ALIGNED( _ZdaPvmSt11align_val_t, DELETE_ARRAY_SIZE_ALIGNED )
@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2017, 2019, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016-2017,
+ * Copyright (c) 2016-2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -23,6 +23,7 @@
 
 #include "scorep_memory_mgmt.h"
 #include "scorep_memory_attributes.h"
+#include "scorep_memory_sampling.h"
 
 #include <SCOREP_InMeasurement.h>
 #include <SCOREP_RuntimeManagement.h>
@@ -31,6 +32,24 @@
 #define SCOREP_DEBUG_MODULE_NAME MEMORY
 #include <UTILS_Debug.h>
 
+/**
+ * Call into the allocator from a recorded heap wrapper. The wrapped call is
+ * marked via scorep_memory_in_allocator, to not record the memory mappings
+ * of the allocator a second time.
+ * @{
+ */
+#define SCOREP_MEMORY_ENTER_ALLOCATOR() \
+    SCOREP_ENTER_WRAPPED_REGION(); \
+    bool scorep_memory_in_allocator_save = scorep_memory_in_allocator; \
+    scorep_memory_in_allocator = true
+
+#define SCOREP_MEMORY_EXIT_ALLOCATOR() \
+    scorep_memory_in_allocator = scorep_memory_in_allocator_save; \
+    SCOREP_EXIT_WRAPPED_REGION()
+/**
+ * @}
+ */
+
 /* *INDENT-OFF* */
 #define SCOREP_MEMORY_WRAP_MALLOC( FUNCTION, REGION ) \
 void* \
@@ -38,7 +57,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( size_t size ) \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_alloc( size ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         return SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( size ); \
@@ -49,15 +69,13 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( size_t size ) \
     scorep_memory_attributes_add_enter_alloc_size( size ); \
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     void* result = SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( size ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     if ( result ) \
     { \
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric, \
-                                        ( uint64_t )result, \
-                                        size ); \
+        scorep_memory_handle_alloc( ( uint64_t )result, size ); \
     } \
 \
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
@@ -76,7 +94,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void* ptr ) \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_free( ptr ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr ); \
@@ -91,13 +110,12 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void* ptr ) \
     void* allocation = NULL; \
     if ( ptr ) \
     { \
-        SCOREP_AllocMetric_AcquireAlloc( scorep_memory_metric, \
-                                         ( uint64_t )ptr, &allocation ); \
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation ); \
     } \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     uint64_t dealloc_size = 0; \
     if ( ptr ) \
@@ -123,7 +141,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_free( ptr ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size ); \
@@ -139,13 +158,12 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
     void* allocation = NULL; \
     if ( ptr ) \
     { \
-        SCOREP_AllocMetric_AcquireAlloc( scorep_memory_metric, \
-                                         ( uint64_t )ptr, &allocation ); \
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation ); \
     } \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     uint64_t dealloc_size = 0; \
     if ( ptr ) \
@@ -171,7 +189,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( size_t nmemb, \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_alloc( nmemb * size ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         return SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( nmemb, size ); \
@@ -182,15 +201,13 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( size_t nmemb, \
     scorep_memory_attributes_add_enter_alloc_size( nmemb * size ); \
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     void* result = SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( nmemb, size ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     if ( result ) \
     { \
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric, \
-                                        ( uint64_t )result, \
-                                        nmemb * size ); \
+        scorep_memory_handle_alloc( ( uint64_t )result, nmemb * size ); \
     } \
 \
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
@@ -211,7 +228,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_realloc( ptr, size ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         return SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size ); \
@@ -230,22 +248,19 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
     void* allocation = NULL; \
     if ( ptr ) \
     { \
-        SCOREP_AllocMetric_AcquireAlloc( scorep_memory_metric, \
-                                         ( uint64_t )ptr, &allocation ); \
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation ); \
     } \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     void* result = SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     /* \
      * If ptr is a null pointer, then it is like malloc. \
      */ \
     if ( ptr == NULL && result ) \
     { \
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric, \
-                                        ( uint64_t )result, \
-                                        size ); \
+        scorep_memory_handle_alloc( ( uint64_t )result, size ); \
         scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
     } \
     /* \
@@ -259,17 +274,22 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
         scorep_memory_attributes_add_exit_dealloc_size( dealloc_size ); \
     } \
     /* Otherwise it is a realloc, treat as realloc on success, ... */ \
-    else if ( result ) \
+    else if ( result && allocation ) \
     { \
         uint64_t dealloc_size = 0; \
-        SCOREP_AllocMetric_HandleRealloc( scorep_memory_metric, \
-                                          ( uint64_t )result, \
-                                          size, \
-                                          allocation, \
-                                          &dealloc_size ); \
+        scorep_memory_handle_realloc( ( uint64_t )result, \
+                                      size, \
+                                      allocation, \
+                                      &dealloc_size ); \
         scorep_memory_attributes_add_exit_dealloc_size( dealloc_size ); \
         scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
     } \
+    /* ... as allocation if ptr was not recorded, ... */ \
+    else if ( result ) \
+    { \
+        scorep_memory_handle_alloc( ( uint64_t )result, size ); \
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
+    } \
     /* ... otherwise, realloc failed, ptr is not touched. * \
      */ \
     else \
@@ -294,7 +314,8 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void** ptr, \
 { \
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
     if ( !trigger || \
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ) \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_alloc( size ) ) \
     { \
         SCOREP_IN_MEASUREMENT_DECREMENT(); \
         return SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, alignment, size ); \
@@ -305,15 +326,13 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void** ptr, \
     scorep_memory_attributes_add_enter_alloc_size( size ); \
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
  \
-    SCOREP_ENTER_WRAPPED_REGION(); \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
     int result = SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, alignment, size ); \
-    SCOREP_EXIT_WRAPPED_REGION(); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
  \
     if ( result == 0 && *ptr ) \
     { \
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric, \
-                                        ( uint64_t )*ptr, \
-                                        size ); \
+        scorep_memory_handle_alloc( ( uint64_t )*ptr, size ); \
     } \
 \
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )*ptr ); \
@@ -325,4 +344,135 @@ SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void** ptr, \
 }
 /* *INDENT-ON* */
 
+/* *INDENT-OFF* */
+#define SCOREP_MEMORY_WRAP_MALLOC_ALIGNED( FUNCTION, REGION ) \
+void* \
+SCOREP_LIBWRAP_WRAPPER( FUNCTION )( size_t size, \
+                                    size_t alignment ) \
+{ \
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
+    if ( !trigger || \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_alloc( size ) ) \
+    { \
+        SCOREP_IN_MEASUREMENT_DECREMENT(); \
+        return SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( size, alignment ); \
+    } \
+ \
+    UTILS_DEBUG_ENTRY( "%zu, %zu", size, alignment ); \
+ \
+    scorep_memory_attributes_add_enter_alloc_size( size ); \
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+ \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
+    void* result = SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( size, alignment ); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
+ \
+    if ( result ) \
+    { \
+        scorep_memory_handle_alloc( ( uint64_t )result, size ); \
+    } \
+\
+    scorep_memory_attributes_add_exit_return_address( ( uint64_t )result ); \
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+ \
+    UTILS_DEBUG_EXIT( "%zu, %zu, %p", size, alignment, result ); \
+    SCOREP_IN_MEASUREMENT_DECREMENT(); \
+    return result; \
+}
+/* *INDENT-ON* */
+
+/* *INDENT-OFF* */
+#define SCOREP_MEMORY_WRAP_FREE_ALIGNED( FUNCTION, REGION ) \
+void \
+SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
+                                    size_t alignment ) \
+{ \
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
+    if ( !trigger || \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_free( ptr ) ) \
+    { \
+        SCOREP_IN_MEASUREMENT_DECREMENT(); \
+        SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, alignment ); \
+        return; \
+    } \
+ \
+    UTILS_DEBUG_ENTRY( "%p, %zu", ptr, alignment ); \
+ \
+    scorep_memory_attributes_add_enter_argument_address( ( uint64_t )ptr ); \
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+\
+    void* allocation = NULL; \
+    if ( ptr ) \
+    { \
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation ); \
+    } \
+ \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
+    SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, alignment ); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
+ \
+    uint64_t dealloc_size = 0; \
+    if ( ptr ) \
+    { \
+        SCOREP_AllocMetric_HandleFree( scorep_memory_metric, \
+                                       allocation, &dealloc_size ); \
+    } \
+\
+    scorep_memory_attributes_add_exit_dealloc_size( dealloc_size ); \
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+ \
+    UTILS_DEBUG_EXIT(); \
+    SCOREP_IN_MEASUREMENT_DECREMENT(); \
+}
+/* *INDENT-ON* */
+
+/* *INDENT-OFF* */
+#define SCOREP_MEMORY_WRAP_FREE_SIZE_ALIGNED( FUNCTION, REGION ) \
+void \
+SCOREP_LIBWRAP_WRAPPER( FUNCTION )( void*  ptr, \
+                                    size_t size, \
+                                    size_t alignment ) \
+{ \
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT(); \
+    if ( !trigger || \
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) || \
+         !scorep_memory_record_free( ptr ) ) \
+    { \
+        SCOREP_IN_MEASUREMENT_DECREMENT(); \
+        SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size, alignment ); \
+        return; \
+    } \
+ \
+    UTILS_DEBUG_ENTRY( "%p, %zu, %zu", ptr, size, alignment ); \
+ \
+    scorep_memory_attributes_add_enter_argument_address( ( uint64_t )ptr ); \
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+\
+    void* allocation = NULL; \
+    if ( ptr ) \
+    { \
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation ); \
+    } \
+ \
+    SCOREP_MEMORY_ENTER_ALLOCATOR(); \
+    SCOREP_LIBWRAP_ORIGINAL( FUNCTION )( ptr, size, alignment ); \
+    SCOREP_MEMORY_EXIT_ALLOCATOR(); \
+ \
+    uint64_t dealloc_size = 0; \
+    if ( ptr ) \
+    { \
+        SCOREP_AllocMetric_HandleFree( scorep_memory_metric, \
+                                       allocation, &dealloc_size ); \
+    } \
+\
+    scorep_memory_attributes_add_exit_dealloc_size( dealloc_size ); \
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_##REGION ] ); \
+ \
+    UTILS_DEBUG_EXIT(); \
+    SCOREP_IN_MEASUREMENT_DECREMENT(); \
+}
+/* *INDENT-ON* */
+
 #endif /* SCOREP_MEMORY_EVENT_FUNCTIONS_H */
@@ -1,7 +1,7 @@
 /**
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2017-2018,
+ * Copyright (c) 2017-2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2025,
@@ -35,7 +35,8 @@ SCOREP_LIBWRAP_WRAPPER( hbw_posix_memalign_psize )( void** ptr,
 {
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
     if ( !trigger ||
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         !scorep_memory_record_alloc( size ) )
     {
         SCOREP_IN_MEASUREMENT_DECREMENT();
         return SCOREP_LIBWRAP_ORIGINAL( hbw_posix_memalign_psize )( ptr, alignment, size, pagesize );
@@ -46,15 +47,13 @@ SCOREP_LIBWRAP_WRAPPER( hbw_posix_memalign_psize )( void** ptr,
     scorep_memory_attributes_add_enter_alloc_size( size );
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_HBW_POSIX_MEMALIGN_PSIZE ] );
 
-    SCOREP_ENTER_WRAPPED_REGION();
+    SCOREP_MEMORY_ENTER_ALLOCATOR();
     int result = SCOREP_LIBWRAP_ORIGINAL( hbw_posix_memalign_psize )( ptr, alignment, size, pagesize );
-    SCOREP_EXIT_WRAPPED_REGION();
+    SCOREP_MEMORY_EXIT_ALLOCATOR();
 
     if ( result == 0 && *ptr )
     {
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric,
-                                        ( uint64_t )*ptr,
-                                        size );
+        scorep_memory_handle_alloc( ( uint64_t )*ptr, size );
     }
 
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )*ptr );
@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2017, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016,
+ * Copyright (c) 2016, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -20,6 +20,8 @@
 
 #include "scorep_memory_event_functions.h"
 
+#include <stdint.h>
+
 SCOREP_MEMORY_WRAP_MALLOC( malloc, MALLOC )
 SCOREP_MEMORY_WRAP_FREE( free, FREE )
 SCOREP_MEMORY_WRAP_MALLOC( valloc, VALLOC )
@@ -34,7 +36,8 @@ SCOREP_LIBWRAP_WRAPPER( memalign )( size_t alignment,
 {
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
     if ( !trigger ||
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         !scorep_memory_record_alloc( size ) )
     {
         SCOREP_IN_MEASUREMENT_DECREMENT();
         return SCOREP_LIBWRAP_ORIGINAL( memalign )( alignment, size );
@@ -45,15 +48,13 @@ SCOREP_LIBWRAP_WRAPPER( memalign )( size_t alignment,
     scorep_memory_attributes_add_enter_alloc_size( size );
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_MEMALIGN ] );
 
-    SCOREP_ENTER_WRAPPED_REGION();
+    SCOREP_MEMORY_ENTER_ALLOCATOR();
     void* result = SCOREP_LIBWRAP_ORIGINAL( memalign )( alignment, size );
-    SCOREP_EXIT_WRAPPED_REGION();
+    SCOREP_MEMORY_EXIT_ALLOCATOR();
 
     if ( result )
     {
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric,
-                                        ( uint64_t )result,
-                                        size );
+        scorep_memory_handle_alloc( ( uint64_t )result, size );
     }
 
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
@@ -63,3 +64,79 @@ SCOREP_LIBWRAP_WRAPPER( memalign )( size_t alignment,
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return result;
 }
+
+
+void*
+SCOREP_LIBWRAP_WRAPPER( reallocarray )( void*  ptr,
+                                        size_t nmemb,
+                                        size_t size )
+{
+    /* On overflow, reallocarray fails without touching ptr. */
+    bool   overflow = size != 0 && nmemb > SIZE_MAX / size;
+    size_t total    = nmemb * size;
+
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
+    if ( !trigger ||
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         overflow ||
+         !scorep_memory_record_realloc( ptr, total ) )
+    {
+        SCOREP_IN_MEASUREMENT_DECREMENT();
+        return SCOREP_LIBWRAP_ORIGINAL( reallocarray )( ptr, nmemb, size );
+    }
+
+    UTILS_DEBUG_ENTRY( "%p, %zu, %zu", ptr, nmemb, size );
+
+    /* See SCOREP_MEMORY_WRAP_REALLOC for the attributes and the cases below. */
+    scorep_memory_attributes_add_enter_alloc_size( total );
+    scorep_memory_attributes_add_enter_argument_address( ( uint64_t )ptr );
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_REALLOCARRAY ] );
+
+    void* allocation = NULL;
+    if ( ptr )
+    {
+        scorep_memory_acquire_alloc( ( uint64_t )ptr, &allocation );
+    }
+
+    SCOREP_MEMORY_ENTER_ALLOCATOR();
+    void* result = SCOREP_LIBWRAP_ORIGINAL( reallocarray )( ptr, nmemb, size );
+    SCOREP_MEMORY_EXIT_ALLOCATOR();
+
+    if ( ptr == NULL && result )
+    {
+        scorep_memory_handle_alloc( ( uint64_t )result, total );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else if ( ptr != NULL && total == 0 )
+    {
+        uint64_t dealloc_size = 0;
+        SCOREP_AllocMetric_HandleFree( scorep_memory_metric,
+                                       allocation, &dealloc_size );
+        scorep_memory_attributes_add_exit_dealloc_size( dealloc_size );
+    }
+    else if ( result && allocation )
+    {
+        uint64_t dealloc_size = 0;
+        scorep_memory_handle_realloc( ( uint64_t )result,
+                                      total,
+                                      allocation,
+                                      &dealloc_size );
+        scorep_memory_attributes_add_exit_dealloc_size( dealloc_size );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else if ( result )
+    {
+        scorep_memory_handle_alloc( ( uint64_t )result, total );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else
+    {
+        scorep_memory_attributes_add_exit_return_address( 0 );
+    }
+
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_REALLOCARRAY ] );
+
+    UTILS_DEBUG_EXIT( "%p, %zu, %zu, %p", ptr, nmemb, size, result );
+    SCOREP_IN_MEASUREMENT_DECREMENT();
+    return result;
+}
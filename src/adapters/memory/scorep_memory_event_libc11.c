@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2017, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016,
+ * Copyright (c) 2016, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -26,7 +26,8 @@ SCOREP_LIBWRAP_WRAPPER( aligned_alloc )( size_t alignment,
 {
     bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
     if ( !trigger ||
-         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         !scorep_memory_record_alloc( size ) )
     {
         SCOREP_IN_MEASUREMENT_DECREMENT();
         return SCOREP_LIBWRAP_ORIGINAL( aligned_alloc )( alignment, size );
@@ -37,15 +38,13 @@ SCOREP_LIBWRAP_WRAPPER( aligned_alloc )( size_t alignment,
     scorep_memory_attributes_add_enter_alloc_size( size );
     SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_ALIGNED_ALLOC ] );
 
-    SCOREP_ENTER_WRAPPED_REGION();
+    SCOREP_MEMORY_ENTER_ALLOCATOR();
     void* result = SCOREP_LIBWRAP_ORIGINAL( aligned_alloc )( alignment, size );
-    SCOREP_EXIT_WRAPPED_REGION();
+    SCOREP_MEMORY_EXIT_ALLOCATOR();
 
     if ( result )
     {
-        SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric,
-                                        ( uint64_t )result,
-                                        size );
+        scorep_memory_handle_alloc( ( uint64_t )result, size );
     }
 
     scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
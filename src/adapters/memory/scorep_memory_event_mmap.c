@@ -0,0 +1,190 @@
+/**
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ */
+
+/**
+ * Implementation of __wrap_* functions for memory mappings used by the memory library wrapper
+ *
+ * Only anonymous mappings are recorded, mappings of files are I/O and not
+ * part of the heap. A mapping is treated as one allocation starting at the
+ * address returned by mmap, unmapping parts of it other than its start is
+ * not recorded. Mappings made by the heap allocator inside a recorded
+ * malloc, new, etc. belong to that allocation and are not recorded.
+ */
+
+#include <config.h>
+
+#include "scorep_memory_event_functions.h"
+
+#include <sys/mman.h>
+#include <stdarg.h>
+
+
+void*
+SCOREP_LIBWRAP_WRAPPER( mmap )( void*  addr,
+                                size_t length,
+                                int    prot,
+                                int    flags,
+                                int    fd,
+                                off_t  offset )
+{
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
+    if ( !trigger ||
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         scorep_memory_in_allocator ||
+         !( flags & MAP_ANONYMOUS ) ||
+         !scorep_memory_record_alloc( length ) )
+    {
+        SCOREP_IN_MEASUREMENT_DECREMENT();
+        return SCOREP_LIBWRAP_ORIGINAL( mmap )( addr, length, prot, flags, fd, offset );
+    }
+
+    UTILS_DEBUG_ENTRY( "%p, %zu, %d, %d", addr, length, prot, flags );
+
+    scorep_memory_attributes_add_enter_alloc_size( length );
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_MMAP ] );
+
+    SCOREP_ENTER_WRAPPED_REGION();
+    void* result = SCOREP_LIBWRAP_ORIGINAL( mmap )( addr, length, prot, flags, fd, offset );
+    SCOREP_EXIT_WRAPPED_REGION();
+
+    if ( result != MAP_FAILED )
+    {
+        scorep_memory_handle_alloc( ( uint64_t )result, length );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else
+    {
+        scorep_memory_attributes_add_exit_return_address( 0 );
+    }
+
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_MMAP ] );
+
+    UTILS_DEBUG_EXIT( "%p, %zu, %d, %d, %p", addr, length, prot, flags, result );
+    SCOREP_IN_MEASUREMENT_DECREMENT();
+    return result;
+}
+
+
+void*
+SCOREP_LIBWRAP_WRAPPER( mremap )( void*  oldAddress,
+                                  size_t oldSize,
+                                  size_t newSize,
+                                  int    flags,
+                                  ... /* void* newAddress */ )
+{
+    void* new_address = NULL;
+    if ( flags & MREMAP_FIXED )
+    {
+        va_list va;
+        va_start( va, flags );
+        new_address = va_arg( va, void* );
+        va_end( va );
+    }
+
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
+    if ( !trigger ||
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         scorep_memory_in_allocator ||
+         !scorep_memory_record_remap( oldAddress, newSize ) )
+    {
+        SCOREP_IN_MEASUREMENT_DECREMENT();
+        return SCOREP_LIBWRAP_ORIGINAL( mremap )( oldAddress, oldSize, newSize, flags, new_address );
+    }
+
+    UTILS_DEBUG_ENTRY( "%p, %zu, %zu, %d", oldAddress, oldSize, newSize, flags );
+
+    /* See SCOREP_MEMORY_WRAP_REALLOC for the attributes. */
+    scorep_memory_attributes_add_enter_alloc_size( newSize );
+    scorep_memory_attributes_add_enter_argument_address( ( uint64_t )oldAddress );
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_MREMAP ] );
+
+    void* allocation = NULL;
+    scorep_memory_acquire_alloc( ( uint64_t )oldAddress, &allocation );
+
+    SCOREP_ENTER_WRAPPED_REGION();
+    void* result = SCOREP_LIBWRAP_ORIGINAL( mremap )( oldAddress, oldSize, newSize, flags, new_address );
+    SCOREP_EXIT_WRAPPED_REGION();
+
+    if ( result != MAP_FAILED && allocation )
+    {
+        uint64_t dealloc_size = 0;
+        scorep_memory_handle_realloc( ( uint64_t )result,
+                                      newSize,
+                                      allocation,
+                                      &dealloc_size );
+        scorep_memory_attributes_add_exit_dealloc_size( dealloc_size );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else if ( result != MAP_FAILED )
+    {
+        scorep_memory_handle_alloc( ( uint64_t )result, newSize );
+        scorep_memory_attributes_add_exit_return_address( ( uint64_t )result );
+    }
+    else
+    {
+        /* The old mapping is not touched, track it again with the size it
+         * accounted for. */
+        if ( allocation )
+        {
+            scorep_memory_handle_realloc( ( uint64_t )oldAddress,
+                                          SCOREP_AllocMetric_GetAllocationSize( allocation ),
+                                          allocation,
+                                          NULL );
+        }
+        scorep_memory_attributes_add_exit_return_address( 0 );
+    }
+
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_MREMAP ] );
+
+    UTILS_DEBUG_EXIT( "%p, %zu, %zu, %d, %p", oldAddress, oldSize, newSize, flags, result );
+    SCOREP_IN_MEASUREMENT_DECREMENT();
+    return result;
+}
+
+
+int
+SCOREP_LIBWRAP_WRAPPER( munmap )( void*  addr,
+                                  size_t length )
+{
+    bool trigger = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
+    if ( !trigger ||
+         !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) ||
+         scorep_memory_in_allocator ||
+         length == 0 ||
+         !scorep_memory_record_unmap( addr ) )
+    {
+        SCOREP_IN_MEASUREMENT_DECREMENT();
+        return SCOREP_LIBWRAP_ORIGINAL( munmap )( addr, length );
+    }
+
+    UTILS_DEBUG_ENTRY( "%p, %zu", addr, length );
+
+    scorep_memory_attributes_add_enter_argument_address( ( uint64_t )addr );
+    SCOREP_EnterWrappedRegion( scorep_memory_regions[ SCOREP_MEMORY_MUNMAP ] );
+
+    void* allocation = NULL;
+    scorep_memory_acquire_alloc( ( uint64_t )addr, &allocation );
+
+    SCOREP_ENTER_WRAPPED_REGION();
+    int result = SCOREP_LIBWRAP_ORIGINAL( munmap )( addr, length );
+    SCOREP_EXIT_WRAPPED_REGION();
+
+    uint64_t dealloc_size = 0;
+    SCOREP_AllocMetric_HandleFree( scorep_memory_metric,
+                                   allocation, &dealloc_size );
+
+    scorep_memory_attributes_add_exit_dealloc_size( dealloc_size );
+    SCOREP_ExitRegion( scorep_memory_regions[ SCOREP_MEMORY_MUNMAP ] );
+
+    UTILS_DEBUG_EXIT( "%p, %zu, %d", addr, length, result );
+    SCOREP_IN_MEASUREMENT_DECREMENT();
+    return result;
+}
@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2017, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016,
+ * Copyright (c) 2016, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -25,6 +25,7 @@
 
 #include "scorep_memory_mgmt.h"
 #include "scorep_memory_attributes.h"
+#include "scorep_memory_sampling.h"
 
 #include <SCOREP_RuntimeManagement.h>
 #include <SCOREP_Location.h>
@@ -55,7 +56,9 @@ SCOREP_RegionHandle scorep_memory_regions[ SCOREP_MEMORY_REGION_SENTINEL ];
 static void enable_memory_wrappers( void );
 /* *INDENT-ON* */
 
-static size_t memory_subsystem_id;
+size_t scorep_memory_subsystem_id;
+
+THREAD_LOCAL_STORAGE_SPECIFIER bool scorep_memory_in_allocator;
 
 static SCOREP_LibwrapHandle*          memory_libwrap_handle;
 static const SCOREP_LibwrapAttributes memory_libwrap_attributes =
@@ -72,7 +75,7 @@ memory_subsystem_register( size_t subsystemId )
 {
     UTILS_DEBUG( "Register environment variables" );
 
-    memory_subsystem_id = subsystemId;
+    scorep_memory_subsystem_id = subsystemId;
 
     return SCOREP_ConfigRegister( "memory", scorep_memory_confvars );
 }
@@ -96,6 +99,21 @@ memory_subsystem_init( void )
 }
 
 
+static SCOREP_ErrorCode
+memory_subsystem_init_location( SCOREP_Location* location,
+                                SCOREP_Location* parent )
+{
+    if ( scorep_memory_recording
+         && scorep_memory_sampling_interval != 0
+         && SCOREP_Location_GetType( location ) == SCOREP_LOCATION_TYPE_CPU_THREAD )
+    {
+        scorep_memory_sampling_init_location( location );
+    }
+
+    return SCOREP_SUCCESS;
+}
+
+
 static void
 memory_subsystem_end( void )
 {
@@ -104,6 +122,10 @@ memory_subsystem_end( void )
     if ( scorep_memory_recording )
     {
         SCOREP_AllocMetric_ReportLeaked( scorep_memory_metric );
+        if ( scorep_memory_sampling_interval != 0 )
+        {
+            scorep_memory_sampling_report();
+        }
     }
 
     UTILS_DEBUG_EXIT();
@@ -160,9 +182,10 @@ enable_memory_wrappers( void )
 /* Implementation of the memory adapter initialization/finalization struct */
 const SCOREP_Subsystem SCOREP_Subsystem_MemoryAdapter =
 {
-    .subsystem_name     = "MEMORY",
-    .subsystem_register = &memory_subsystem_register,
-    .subsystem_init     = &memory_subsystem_init,
-    .subsystem_end      = &memory_subsystem_end,
-    .subsystem_finalize = &memory_subsystem_finalize
+    .subsystem_name          = "MEMORY",
+    .subsystem_register      = &memory_subsystem_register,
+    .subsystem_init          = &memory_subsystem_init,
+    .subsystem_init_location = &memory_subsystem_init_location,
+    .subsystem_end           = &memory_subsystem_end,
+    .subsystem_finalize      = &memory_subsystem_finalize
 };
@@ -4,7 +4,7 @@
  * Copyright (c) 2016, 2019, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2017,
+ * Copyright (c) 2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -27,6 +27,7 @@
 #include <SCOREP_AllocMetric.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <sys/types.h>
 
 
 /*
@@ -46,26 +47,36 @@
 
 
 #define SCOREP_MEMORY_REGIONS \
-    SCOREP_MEMORY_REGION( MALLOC,                   ALLOCATE,   "malloc" ) \
-    SCOREP_MEMORY_REGION( REALLOC,                  REALLOCATE, "realloc" ) \
-    SCOREP_MEMORY_REGION( CALLOC,                   ALLOCATE,   "calloc" ) \
-    SCOREP_MEMORY_REGION( FREE,                     DEALLOCATE, "free" ) \
-    SCOREP_MEMORY_REGION( MEMALIGN,                 ALLOCATE,   "memalign" ) \
-    SCOREP_MEMORY_REGION( POSIX_MEMALIGN,           ALLOCATE,   "posix_memalign" ) \
-    SCOREP_MEMORY_REGION( VALLOC,                   ALLOCATE,   "valloc" ) \
-    SCOREP_MEMORY_REGION( ALIGNED_ALLOC,            ALLOCATE,   "aligned_alloc" ) \
-    SCOREP_MEMORY_REGION( NEW,                      ALLOCATE,   "operator new(size_t)" ) \
-    SCOREP_MEMORY_REGION( DELETE,                   DEALLOCATE, "operator delete(void*)" ) \
-    SCOREP_MEMORY_REGION( DELETE_SIZE,              DEALLOCATE, "operator delete(void*,size_t)" ) \
-    SCOREP_MEMORY_REGION( NEW_ARRAY,                ALLOCATE,   "operator new[](size_t)" ) \
-    SCOREP_MEMORY_REGION( DELETE_ARRAY,             DEALLOCATE, "operator delete[](void*)" ) \
-    SCOREP_MEMORY_REGION( DELETE_ARRAY_SIZE,        DEALLOCATE, "operator delete[](void*,size_t)" ) \
-    SCOREP_MEMORY_REGION( HBW_MALLOC,               ALLOCATE,   "hbw_malloc" ) \
-    SCOREP_MEMORY_REGION( HBW_REALLOC,              REALLOCATE, "hbw_realloc" ) \
-    SCOREP_MEMORY_REGION( HBW_CALLOC,               ALLOCATE,   "hbw_calloc" ) \
-    SCOREP_MEMORY_REGION( HBW_FREE,                 DEALLOCATE, "hbw_free" ) \
-    SCOREP_MEMORY_REGION( HBW_POSIX_MEMALIGN,       ALLOCATE,   "hbw_posix_memalign" ) \
-    SCOREP_MEMORY_REGION( HBW_POSIX_MEMALIGN_PSIZE, ALLOCATE,   "hbw_posix_memalign_psize" )
+    SCOREP_MEMORY_REGION( MALLOC,                    ALLOCATE,   "malloc" ) \
+    SCOREP_MEMORY_REGION( REALLOC,                   REALLOCATE, "realloc" ) \
+    SCOREP_MEMORY_REGION( CALLOC,                    ALLOCATE,   "calloc" ) \
+    SCOREP_MEMORY_REGION( FREE,                      DEALLOCATE, "free" ) \
+    SCOREP_MEMORY_REGION( MEMALIGN,                  ALLOCATE,   "memalign" ) \
+    SCOREP_MEMORY_REGION( POSIX_MEMALIGN,            ALLOCATE,   "posix_memalign" ) \
+    SCOREP_MEMORY_REGION( VALLOC,                    ALLOCATE,   "valloc" ) \
+    SCOREP_MEMORY_REGION( ALIGNED_ALLOC,             ALLOCATE,   "aligned_alloc" ) \
+    SCOREP_MEMORY_REGION( REALLOCARRAY,              REALLOCATE, "reallocarray" ) \
+    SCOREP_MEMORY_REGION( MMAP,                      ALLOCATE,   "mmap" ) \
+    SCOREP_MEMORY_REGION( MREMAP,                    REALLOCATE, "mremap" ) \
+    SCOREP_MEMORY_REGION( MUNMAP,                    DEALLOCATE, "munmap" ) \
+    SCOREP_MEMORY_REGION( NEW,                       ALLOCATE,   "operator new(size_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE,                    DEALLOCATE, "operator delete(void*)" ) \
+    SCOREP_MEMORY_REGION( DELETE_SIZE,               DEALLOCATE, "operator delete(void*,size_t)" ) \
+    SCOREP_MEMORY_REGION( NEW_ARRAY,                 ALLOCATE,   "operator new[](size_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE_ARRAY,              DEALLOCATE, "operator delete[](void*)" ) \
+    SCOREP_MEMORY_REGION( DELETE_ARRAY_SIZE,         DEALLOCATE, "operator delete[](void*,size_t)" ) \
+    SCOREP_MEMORY_REGION( NEW_ALIGNED,               ALLOCATE,   "operator new(size_t,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE_ALIGNED,            DEALLOCATE, "operator delete(void*,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE_SIZE_ALIGNED,       DEALLOCATE, "operator delete(void*,size_t,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( NEW_ARRAY_ALIGNED,         ALLOCATE,   "operator new[](size_t,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE_ARRAY_ALIGNED,      DEALLOCATE, "operator delete[](void*,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( DELETE_ARRAY_SIZE_ALIGNED, DEALLOCATE, "operator delete[](void*,size_t,std::align_val_t)" ) \
+    SCOREP_MEMORY_REGION( HBW_MALLOC,                ALLOCATE,   "hbw_malloc" ) \
+    SCOREP_MEMORY_REGION( HBW_REALLOC,               REALLOCATE, "hbw_realloc" ) \
+    SCOREP_MEMORY_REGION( HBW_CALLOC,                ALLOCATE,   "hbw_calloc" ) \
+    SCOREP_MEMORY_REGION( HBW_FREE,                  DEALLOCATE, "hbw_free" ) \
+    SCOREP_MEMORY_REGION( HBW_POSIX_MEMALIGN,        ALLOCATE,   "hbw_posix_memalign" ) \
+    SCOREP_MEMORY_REGION( HBW_POSIX_MEMALIGN_PSIZE,  ALLOCATE,   "hbw_posix_memalign_psize" )
 
 
 typedef enum scorep_memory_region_types
@@ -97,4 +108,15 @@ extern bool scorep_memory_recording;
 extern SCOREP_AllocMetric* scorep_memory_metric;
 
 
+extern size_t scorep_memory_subsystem_id;
+
+
+/**
+ * Set while a recorded heap allocation or deallocation calls into the
+ * allocator. Memory mappings the allocator makes on behalf of the heap are
+ * part of the recorded allocation and are not recorded again.
+ */
+extern THREAD_LOCAL_STORAGE_SPECIFIER bool scorep_memory_in_allocator;
+
+
 #endif /* SCOREP_MEMORY_MGMT_H */
@@ -0,0 +1,331 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * @brief Byte-sampled recording of memory (de)allocations.
+ */
+
+#include <config.h>
+
+#include "scorep_memory_sampling.h"
+#include "scorep_memory_mgmt.h"
+
+#include <SCOREP_Location.h>
+#include <SCOREP_Memory.h>
+#include <SCOREP_Events.h>
+#include <SCOREP_AllocMetric.h>
+
+#define SCOREP_DEBUG_MODULE_NAME MEMORY
+#include <UTILS_Debug.h>
+#include <UTILS_Atomic.h>
+
+#include <inttypes.h>
+#include <math.h>
+
+
+typedef struct memory_sampling_data
+{
+    uint64_t bytes_until_sample;
+    uint64_t random_state;
+    uint64_t allocations;
+    uint64_t allocated_bytes;
+    uint64_t deallocations;
+} memory_sampling_data;
+
+
+/*
+ * Counts the recorded allocations per hash of their address. A free of an
+ * address with a zero count was not recorded, which spares the look-up in the
+ * memory metric for the vast majority of frees.
+ */
+#define RECORDED_ADDRESSES_BITS 15
+static uint32_t recorded_addresses[ 1 << RECORDED_ADDRESSES_BITS ];
+
+
+static inline uint32_t*
+recorded_address_count( uint64_t addr )
+{
+    return &recorded_addresses[ ( ( addr >> 4 ) * UINT64_C( 0x9e3779b97f4a7c15 ) )
+                                >> ( 64 - RECORDED_ADDRESSES_BITS ) ];
+}
+
+
+static inline bool
+is_recorded( uint64_t addr )
+{
+    return UTILS_Atomic_LoadN_uint32( recorded_address_count( addr ),
+                                      UTILS_ATOMIC_RELAXED ) != 0
+           && SCOREP_AllocMetric_AddrExists( scorep_memory_metric, addr );
+}
+
+
+/* xorshift64* */
+static inline uint64_t
+next_random( memory_sampling_data* data )
+{
+    data->random_state ^= data->random_state >> 12;
+    data->random_state ^= data->random_state << 25;
+    data->random_state ^= data->random_state >> 27;
+    return data->random_state * UINT64_C( 0x2545f4914f6cdd1d );
+}
+
+
+/* Exponentially distributed distance to the next sample point. */
+static uint64_t
+next_sample_distance( memory_sampling_data* data )
+{
+    /* uniform in (0, 1] */
+    double u = ( ( next_random( data ) >> 11 ) + 1 ) * 0x1p-53;
+    return ( uint64_t )( -log( u ) * ( double )scorep_memory_sampling_interval ) + 1;
+}
+
+
+/* Number of bytes a recorded allocation of @a size bytes accounts for. */
+static size_t
+sample_weight( size_t size )
+{
+    if ( scorep_memory_sampling_interval == 0 || size == 0 )
+    {
+        return size;
+    }
+    return ( size_t )( ( double )size
+                       / -expm1( -( double )size / ( double )scorep_memory_sampling_interval )
+                       + 0.5 );
+}
+
+
+void
+scorep_memory_sampling_init_location( SCOREP_Location* location )
+{
+    memory_sampling_data* data = SCOREP_Location_AllocForMisc( location, sizeof( *data ) );
+    data->random_state = ( ( uint64_t )SCOREP_Location_GetId( location ) + 1 )
+                         * UINT64_C( 0x9e3779b97f4a7c15 );
+    data->bytes_until_sample = next_sample_distance( data );
+    data->allocations        = 0;
+    data->allocated_bytes    = 0;
+    data->deallocations      = 0;
+
+    SCOREP_Location_SetSubsystemData( location, scorep_memory_subsystem_id, data );
+}
+
+
+static bool
+report_location( SCOREP_Location* location,
+                 void*            arg )
+{
+    memory_sampling_data* data =
+        SCOREP_Location_GetSubsystemData( location, scorep_memory_subsystem_id );
+    if ( data )
+    {
+        SCOREP_Location_AddLocationProperty( location, "MEMORY_ALLOCATIONS", 21,
+                                             "%" PRIu64, data->allocations );
+        SCOREP_Location_AddLocationProperty( location, "MEMORY_ALLOCATED_BYTES", 21,
+                                             "%" PRIu64, data->allocated_bytes );
+        SCOREP_Location_AddLocationProperty( location, "MEMORY_DEALLOCATIONS", 21,
+                                             "%" PRIu64, data->deallocations );
+    }
+    return false;
+}
+
+
+void
+scorep_memory_sampling_report( void )
+{
+    SCOREP_Location_ForAll( report_location, NULL );
+}
+
+
+static inline memory_sampling_data*
+get_data( void )
+{
+    return SCOREP_Location_GetSubsystemData( SCOREP_Location_GetCurrentCPULocation(),
+                                             scorep_memory_subsystem_id );
+}
+
+
+static bool
+sample( memory_sampling_data* data,
+        size_t                size )
+{
+    data->allocations++;
+    data->allocated_bytes += size;
+
+    if ( size < data->bytes_until_sample )
+    {
+        data->bytes_until_sample -= size;
+        return false;
+    }
+
+    /* The allocation contains at least one sample point, skip all others in
+     * it. Due to the memorylessness of the exponential distribution, the
+     * distance to the next one starts at the end of the allocation. */
+    data->bytes_until_sample = next_sample_distance( data );
+    return true;
+}
+
+
+bool
+scorep_memory_sampling_record_alloc( size_t size )
+{
+    memory_sampling_data* data = get_data();
+    if ( !data )
+    {
+        return true;
+    }
+    return size != 0 && sample( data, size );
+}
+
+
+bool
+scorep_memory_sampling_record_free( void* ptr )
+{
+    if ( ptr == NULL )
+    {
+        return false;
+    }
+
+    memory_sampling_data* data = get_data();
+    if ( data )
+    {
+        data->deallocations++;
+    }
+    return is_recorded( ( uint64_t )ptr );
+}
+
+
+bool
+scorep_memory_sampling_record_realloc( void*  ptr,
+                                       size_t size )
+{
+    memory_sampling_data* data = get_data();
+    if ( data && ptr && size == 0 )
+    {
+        data->deallocations++;
+    }
+
+    if ( ptr && is_recorded( ( uint64_t )ptr ) )
+    {
+        if ( data && size != 0 )
+        {
+            data->allocations++;
+            data->allocated_bytes += size;
+        }
+        return true;
+    }
+
+    if ( !data )
+    {
+        return true;
+    }
+    return size != 0 && sample( data, size );
+}
+
+
+bool
+scorep_memory_record_unmap( void* addr )
+{
+    if ( scorep_memory_sampling_interval == 0 )
+    {
+        return SCOREP_AllocMetric_AddrExists( scorep_memory_metric, ( uint64_t )addr );
+    }
+    if ( !is_recorded( ( uint64_t )addr ) )
+    {
+        return false;
+    }
+
+    memory_sampling_data* data = get_data();
+    if ( data )
+    {
+        data->deallocations++;
+    }
+    return true;
+}
+
+
+bool
+scorep_memory_record_remap( void*  addr,
+                            size_t size )
+{
+    if ( scorep_memory_sampling_interval == 0 )
+    {
+        return SCOREP_AllocMetric_AddrExists( scorep_memory_metric, ( uint64_t )addr );
+    }
+    if ( !is_recorded( ( uint64_t )addr ) )
+    {
+        return false;
+    }
+
+    memory_sampling_data* data = get_data();
+    if ( data )
+    {
+        data->allocations++;
+        data->allocated_bytes += size;
+    }
+    return true;
+}
+
+
+void
+scorep_memory_handle_alloc( uint64_t addr,
+                            size_t   size )
+{
+    SCOREP_AllocMetric_HandleAlloc( scorep_memory_metric, addr, sample_weight( size ) );
+    if ( scorep_memory_sampling_interval != 0 )
+    {
+        UTILS_Atomic_AddFetch_uint32( recorded_address_count( addr ), 1,
+                                      UTILS_ATOMIC_RELAXED );
+    }
+}
+
+
+void
+scorep_memory_acquire_alloc( uint64_t addr,
+                             void**   allocation )
+{
+    if ( scorep_memory_sampling_interval == 0 )
+    {
+        SCOREP_AllocMetric_AcquireAlloc( scorep_memory_metric, addr, allocation );
+        return;
+    }
+
+    /* A reallocation of an allocation which was not recorded may be sampled. */
+    *allocation = NULL;
+    if ( is_recorded( addr ) )
+    {
+        SCOREP_AllocMetric_AcquireAlloc( scorep_memory_metric, addr, allocation );
+    }
+    if ( *allocation )
+    {
+        UTILS_Atomic_SubFetch_uint32( recorded_address_count( addr ), 1,
+                                      UTILS_ATOMIC_RELAXED );
+    }
+}
+
+
+void
+scorep_memory_handle_realloc( uint64_t  resultAddr,
+                              size_t    size,
+                              void*     allocation,
+                              uint64_t* prevSize )
+{
+    /* The reallocation of a recorded allocation is recorded with probability
+     * one, thus it accounts for its size only. */
+    SCOREP_AllocMetric_HandleRealloc( scorep_memory_metric, resultAddr,
+                                      size, allocation, prevSize );
+    if ( scorep_memory_sampling_interval != 0 )
+    {
+        UTILS_Atomic_AddFetch_uint32( recorded_address_count( resultAddr ), 1,
+                                      UTILS_ATOMIC_RELAXED );
+    }
+}
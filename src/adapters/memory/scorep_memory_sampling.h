@@ -0,0 +1,154 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+#ifndef SCOREP_MEMORY_SAMPLING_H
+#define SCOREP_MEMORY_SAMPLING_H
+
+/**
+ * @file
+ *
+ * @brief Byte-sampled recording of memory (de)allocations.
+ *
+ * With a sampling interval of N bytes, sample points are placed at
+ * exponentially distributed distances with mean N into the stream of bytes
+ * allocated by a thread. An allocation of s bytes that contains a sample
+ * point is recorded, which happens with probability p(s) = 1 - exp(-s/N).
+ * A recorded allocation accounts for s / p(s) bytes in the memory metric,
+ * which makes the metric an unbiased estimate of the heap usage. A
+ * deallocation is recorded if and only if its allocation was recorded. A
+ * reallocation of a recorded allocation is always recorded and accounts for
+ * its new size unscaled.
+ *
+ * The exact number of allocations, allocated bytes, and deallocations is
+ * counted per location regardless of sampling.
+ */
+
+#include <SCOREP_Location.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Mean number of allocated bytes between two recorded allocations. Zero if
+ * all allocations are recorded.
+ */
+extern uint64_t scorep_memory_sampling_interval;
+
+
+void
+scorep_memory_sampling_init_location( SCOREP_Location* location );
+
+
+void
+scorep_memory_sampling_report( void );
+
+
+bool
+scorep_memory_sampling_record_alloc( size_t size );
+
+
+bool
+scorep_memory_sampling_record_free( void* ptr );
+
+
+bool
+scorep_memory_sampling_record_realloc( void*  ptr,
+                                       size_t size );
+
+
+/**
+ * Decides whether to record an allocation of @a size bytes.
+ */
+static inline bool
+scorep_memory_record_alloc( size_t size )
+{
+    return scorep_memory_sampling_interval == 0
+           || scorep_memory_sampling_record_alloc( size );
+}
+
+
+/**
+ * Decides whether to record the deallocation of @a ptr.
+ */
+static inline bool
+scorep_memory_record_free( void* ptr )
+{
+    return scorep_memory_sampling_interval == 0
+           || scorep_memory_sampling_record_free( ptr );
+}
+
+
+/**
+ * Decides whether to record the reallocation of @a ptr to @a size bytes. A
+ * reallocation of a recorded allocation is always recorded, any other is
+ * sampled like an allocation.
+ */
+static inline bool
+scorep_memory_record_realloc( void*  ptr,
+                              size_t size )
+{
+    return scorep_memory_sampling_interval == 0
+           || scorep_memory_sampling_record_realloc( ptr, size );
+}
+
+
+/**
+ * Decides whether to record the unmapping of @a addr. Only recorded mappings
+ * are recorded, mappings of files or those made outside of the measurement
+ * are not known to the memory metric.
+ */
+bool
+scorep_memory_record_unmap( void* addr );
+
+
+/**
+ * Decides whether to record the remapping of @a addr to @a size bytes. Like
+ * for an unmapping, only recorded mappings are recorded.
+ */
+bool
+scorep_memory_record_remap( void*  addr,
+                            size_t size );
+
+
+/**
+ * Passes a recorded allocation to the memory metric, with the size it
+ * accounts for.
+ */
+void
+scorep_memory_handle_alloc( uint64_t addr,
+                            size_t   size );
+
+
+/**
+ * Takes the allocation at @a addr out of the memory metric, or sets
+ * @a allocation to NULL if it is not known.
+ */
+void
+scorep_memory_acquire_alloc( uint64_t addr,
+                             void**   allocation );
+
+
+/**
+ * Passes a recorded reallocation of @a allocation to the memory metric. As the
+ * reallocation is recorded with probability one, it accounts for @a size
+ * bytes.
+ */
+void
+scorep_memory_handle_realloc( uint64_t  resultAddr,
+                              size_t    size,
+                              void*     allocation,
+                              uint64_t* prevSize );
+
+
+#endif /* SCOREP_MEMORY_SAMPLING_H */
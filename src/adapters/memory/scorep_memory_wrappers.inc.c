@@ -10,6 +10,13 @@ SCOREP_MEMORY_WRAPPER( void*, memalign,       ( size_t, size_t ) );
 SCOREP_MEMORY_WRAPPER( int,   posix_memalign, ( void**, size_t, size_t ) );
 SCOREP_MEMORY_WRAPPER( void*, valloc,         ( size_t ) );
 SCOREP_MEMORY_WRAPPER( void*, aligned_alloc,  ( size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void*, reallocarray,   ( void*, size_t, size_t ) );
+
+/* anonymous memory mappings */
+
+SCOREP_MEMORY_WRAPPER( void*, mmap,   ( void*, size_t, int, int, int, off_t ) );
+SCOREP_MEMORY_WRAPPER( void*, mremap, ( void*, size_t, size_t, int, ... ) );
+SCOREP_MEMORY_WRAPPER( int,   munmap, ( void*, size_t ) );
 
 /* allocation functions of hbwmalloc hbw_* */
 
@@ -33,6 +40,20 @@ SCOREP_MEMORY_WRAPPER( void,  _ZdaPv,  ( void* ) );
 SCOREP_MEMORY_WRAPPER( void,  _ZdaPvm, ( void*, size_t ) );
 SCOREP_MEMORY_WRAPPER( void,  _ZdaPvj, ( void*, size_t ) );
 
+/* Declaration of the mangled real functions new and delete with alignment (C++17),
+ * std::align_val_t is passed as size_t */
+
+SCOREP_MEMORY_WRAPPER( void*, _ZnwmSt11align_val_t,   ( size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void*, _ZnwjSt11align_val_t,   ( size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdlPvSt11align_val_t,  ( void*, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdlPvmSt11align_val_t, ( void*, size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdlPvjSt11align_val_t, ( void*, size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void*, _ZnamSt11align_val_t,   ( size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void*, _ZnajSt11align_val_t,   ( size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdaPvSt11align_val_t,  ( void*, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdaPvmSt11align_val_t, ( void*, size_t, size_t ) );
+SCOREP_MEMORY_WRAPPER( void,  _ZdaPvjSt11align_val_t, ( void*, size_t, size_t ) );
+
 /* Declaration of the mangled real functions new and delete (old PGI/EDG C++ ABI) */
 
 SCOREP_MEMORY_WRAPPER( void*, __nw__FUi,  ( size_t ) );
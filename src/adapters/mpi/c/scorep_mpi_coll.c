@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022-2023, 2025,
+ * Copyright (c) 2022-2023, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -13,29 +13,219 @@
 #include <config.h>
 
 #include <scorep_mpi_coll.h>
+#include <scorep_mpi_communicator_mgmt.h>
 
 #include <stdbool.h>
 
-static inline bool
-is_intracomm( MPI_Comm comm )
+
+/*
+ * Properties of a communicator used by the byte calculations. They are read
+ * from the definition payload if the caller passes one, and queried from MPI
+ * otherwise, i.e., for communicators which are not tracked.
+ */
+typedef struct
+{
+    bool is_intercomm;
+    int  local_rank;
+    int  comm_size;
+    int  remote_comm_size;
+} comm_properties;
+
+static inline void
+get_comm_properties( MPI_Comm                                  comm,
+                     const scorep_mpi_comm_definition_payload* commPayload,
+                     comm_properties*                          properties )
 {
+    if ( commPayload )
+    {
+        properties->is_intercomm = commPayload->is_intercomm;
+        properties->local_rank   = commPayload->local_rank;
+        properties->comm_size    = commPayload->comm_size;
+        /* The high bit of remote_comm_size encodes the high/low flag of the
+         * merged inter communicator. */
+        properties->remote_comm_size = commPayload->remote_comm_size & ~( UINT32_C( 1 ) << 31 );
+        return;
+    }
+
     int is_intercomm;
     PMPI_Comm_test_inter( comm, &is_intercomm );
-    return !is_intercomm;
+    properties->is_intercomm = is_intercomm;
+    PMPI_Comm_rank( comm, &properties->local_rank );
+    PMPI_Comm_size( comm, &properties->comm_size );
+    properties->remote_comm_size = 0;
+    if ( is_intercomm )
+    {
+        PMPI_Comm_remote_size( comm, &properties->remote_comm_size );
+    }
 }
 
+/* Number of processes a process exchanges data with in collectives. */
 static inline int
-is_cart_topo( MPI_Comm comm )
+num_peers( const comm_properties* properties )
+{
+    return properties->is_intercomm
+           ? properties->remote_comm_size
+           : properties->comm_size;
+}
+
+
+void
+scorep_mpi_topo_get( MPI_Comm comm,
+                     int      localRank,
+                     int*     topology,
+                     int*     indegree,
+                     int*     outdegree,
+                     int*     ndims )
 {
-    int topo_type = MPI_UNDEFINED;
-    PMPI_Topo_test( comm, &topo_type );
-    return topo_type == MPI_CART;
+    *indegree  = 0;
+    *outdegree = 0;
+    *ndims     = 0;
+
+    *topology = MPI_UNDEFINED;
+    PMPI_Topo_test( comm, topology );
+    switch ( *topology )
+    {
+        case MPI_GRAPH:
+            PMPI_Graph_neighbors_count( comm, localRank, indegree );
+            *outdegree = *indegree;
+            break;
+        case MPI_CART:
+            PMPI_Cartdim_get( comm, ndims );
+            *indegree  = 2 * *ndims;
+            *outdegree = 2 * *ndims;
+            break;
+        case MPI_DIST_GRAPH:
+        {
+            int weighted;
+            PMPI_Dist_graph_neighbors_count( comm, indegree, outdegree, &weighted );
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static inline void
+get_topology( MPI_Comm                                  comm,
+              const scorep_mpi_comm_definition_payload* commPayload,
+              int*                                      topology,
+              int*                                      indegree,
+              int*                                      outdegree )
+{
+    if ( commPayload )
+    {
+        *topology  = commPayload->topology;
+        *indegree  = commPayload->indegree;
+        *outdegree = commPayload->outdegree;
+        return;
+    }
+
+    int local_rank;
+    int ndims;
+    PMPI_Comm_rank( comm, &local_rank );
+    scorep_mpi_topo_get( comm, local_rank, topology, indegree, outdegree, &ndims );
+}
+
+/* Number of neighbors in a cartesian topology which are not MPI_PROC_NULL. */
+static inline int
+num_cart_neighbors( MPI_Comm                                  comm,
+                    const scorep_mpi_comm_definition_payload* commPayload )
+{
+    if ( commPayload )
+    {
+        return commPayload->num_cart_neighbors;
+    }
+
+    int num_neighbors = 0;
+    int ndims;
+    PMPI_Cartdim_get( comm, &ndims );
+    for ( int dim = 0; dim < ndims; ++dim )
+    {
+        int neighbor_ranks[ 2 ];
+        PMPI_Cart_shift( comm, dim, 1, &neighbor_ranks[ 0 ], &neighbor_ranks[ 1 ] );
+        num_neighbors += ( neighbor_ranks[ 0 ] != MPI_PROC_NULL )
+                         + ( neighbor_ranks[ 1 ] != MPI_PROC_NULL );
+    }
+    return num_neighbors;
+}
+
+void
+scorep_mpi_topo_num_neighbors( MPI_Comm                                  comm,
+                               const scorep_mpi_comm_definition_payload* commPayload,
+                               int*                                      indegree,
+                               int*                                      outdegree )
+{
+    int topology;
+    get_topology( comm, commPayload, &topology, indegree, outdegree );
+}
+
+
+/*
+ * Sizes of common predefined datatypes. Handles of derived datatypes may be
+ * reused after they were freed, thus only the predefined ones are cached.
+ * The most frequently used types come first.
+ */
+static struct
+{
+    MPI_Datatype type;
+    int          size;
+} predefined_type_sizes[ 24 ];
+static int number_of_predefined_type_sizes;
+
+void
+scorep_mpi_coll_init( void )
+{
+    const MPI_Datatype types[] =
+    {
+        MPI_DOUBLE, MPI_INT, MPI_BYTE, MPI_CHAR, MPI_FLOAT, MPI_LONG,
+        MPI_UNSIGNED, MPI_UNSIGNED_LONG, MPI_LONG_LONG_INT, MPI_UNSIGNED_CHAR,
+        MPI_SHORT, MPI_UNSIGNED_SHORT, MPI_LONG_DOUBLE, MPI_DOUBLE_INT,
+        MPI_2INT, MPI_FLOAT_INT, MPI_LONG_INT, MPI_DOUBLE_PRECISION,
+        MPI_INTEGER, MPI_REAL, MPI_CHARACTER, MPI_LOGICAL, MPI_COMPLEX,
+        MPI_DOUBLE_COMPLEX
+    };
+
+    number_of_predefined_type_sizes = 0;
+    for ( size_t i = 0; i < sizeof( types ) / sizeof( types[ 0 ] ); i++ )
+    {
+        /* Fortran types are null if the MPI library lacks Fortran support */
+        if ( types[ i ] == MPI_DATATYPE_NULL )
+        {
+            continue;
+        }
+        predefined_type_sizes[ number_of_predefined_type_sizes ].type = types[ i ];
+        PMPI_Type_size( types[ i ], &predefined_type_sizes[ number_of_predefined_type_sizes ].size );
+        number_of_predefined_type_sizes++;
+    }
+}
+
+static inline bool
+predefined_type_size( MPI_Datatype type, int* size )
+{
+    for ( int i = 0; i < number_of_predefined_type_sizes; i++ )
+    {
+        if ( predefined_type_sizes[ i ].type == type )
+        {
+            *size = predefined_type_sizes[ i ].size;
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline void
+type_size( MPI_Datatype type, int* size )
+{
+    if ( !predefined_type_size( type, size ) )
+    {
+        PMPI_Type_size( type, size );
+    }
 }
 
 
 #define COUNT_T int
 #define COUNT_FUN( name ) name
-#define TYPE_SIZE_FUN PMPI_Type_size
+#define TYPE_SIZE_FUN type_size
 
 #include "scorep_mpi_coll.inc.c"
 
@@ -47,13 +237,26 @@ is_cart_topo( MPI_Comm comm )
  * Large counts
  */
 #if HAVE( MPI_4_0_SYMBOL_PMPI_TYPE_SIZE_C )
-#define TYPE_SIZE_FUN PMPI_Type_size_c
+#define LARGE_TYPE_SIZE_FUN PMPI_Type_size_c
 #elif HAVE( MPI_3_0_SYMBOL_PMPI_TYPE_SIZE_X )
-#define TYPE_SIZE_FUN PMPI_Type_size_x
+#define LARGE_TYPE_SIZE_FUN PMPI_Type_size_x
 #endif
 
-#if defined( TYPE_SIZE_FUN )
+#if defined( LARGE_TYPE_SIZE_FUN )
+
+static inline void
+type_size_large( MPI_Datatype type, MPI_Count* size )
+{
+    int predefined_size;
+    if ( predefined_type_size( type, &predefined_size ) )
+    {
+        *size = predefined_size;
+        return;
+    }
+    LARGE_TYPE_SIZE_FUN( type, size );
+}
 
+#define TYPE_SIZE_FUN type_size_large
 #define COUNT_T MPI_Count
 #define COUNT_FUN( name ) name ##_c
 
@@ -61,5 +264,6 @@ is_cart_topo( MPI_Comm comm )
 
 #undef COUNT_T
 #undef COUNT_FUN
+#undef LARGE_TYPE_SIZE_FUN
 
 #endif
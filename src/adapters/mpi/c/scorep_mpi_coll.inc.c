@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2023, 2025,
+ * Copyright (c) 2023, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -22,9 +22,10 @@
  * Barrier
  * -------------------------------------------------------------------------- */
 void
-COUNT_FUN( scorep_mpi_coll_bytes_barrier )( MPI_Comm  comm,
-                                            uint64_t* sendbytes,
-                                            uint64_t* recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_barrier )( MPI_Comm                                  comm,
+                                            const scorep_mpi_comm_definition_payload* commPayload,
+                                            uint64_t*                                 sendbytes,
+                                            uint64_t*                                 recvbytes )
 {
     *sendbytes = 0;
     *recvbytes = 0;
@@ -35,24 +36,25 @@ COUNT_FUN( scorep_mpi_coll_bytes_barrier )( MPI_Comm  comm,
  * All-to-one
  * -------------------------------------------------------------------------- */
 static inline void
-COUNT_FUN( coll_bytes_all_to_one )( COUNT_T      sendcount,
-                                    MPI_Datatype sendtype,
-                                    COUNT_T      recvcount,
-                                    MPI_Datatype recvtype,
-                                    int          root,
-                                    int          inplace,
-                                    MPI_Comm     comm,
-                                    uint64_t*    sendbytes,
-                                    uint64_t*    recvbytes )
+COUNT_FUN( coll_bytes_all_to_one )( COUNT_T                                   sendcount,
+                                    MPI_Datatype                              sendtype,
+                                    COUNT_T                                   recvcount,
+                                    MPI_Datatype                              recvtype,
+                                    int                                       root,
+                                    int                                       inplace,
+                                    MPI_Comm                                  comm,
+                                    const scorep_mpi_comm_definition_payload* commPayload,
+                                    uint64_t*                                 sendbytes,
+                                    uint64_t*                                 recvbytes )
 {
-    if ( is_intracomm( comm ) )
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    if ( !properties.is_intercomm )
     {
-        int me;
-        PMPI_Comm_rank( comm, &me );
+        const int me = properties.local_rank;
         if ( me == root )
         {
-            int num_ranks;
-            PMPI_Comm_size( comm, &num_ranks );
+            const int num_ranks = properties.comm_size;
 
             /*
              * At the root, recvcount, recvtype are always significant.
@@ -92,8 +94,7 @@ COUNT_FUN( coll_bytes_all_to_one )( COUNT_T      sendcount,
     {
         if ( root == MPI_ROOT )
         {
-            int num_remote_ranks;
-            PMPI_Comm_remote_size( comm, &num_remote_ranks );
+            const int num_remote_ranks = properties.remote_comm_size;
 
             COUNT_T recvsize;
             TYPE_SIZE_FUN( recvtype, &recvsize );
@@ -118,15 +119,16 @@ COUNT_FUN( coll_bytes_all_to_one )( COUNT_T      sendcount,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_gather )( COUNT_T      sendcount,
-                                           MPI_Datatype sendtype,
-                                           COUNT_T      recvcount,
-                                           MPI_Datatype recvtype,
-                                           int          root,
-                                           int          inplace,
-                                           MPI_Comm     comm,
-                                           uint64_t*    sendbytes,
-                                           uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_gather )( COUNT_T                                   sendcount,
+                                           MPI_Datatype                              sendtype,
+                                           COUNT_T                                   recvcount,
+                                           MPI_Datatype                              recvtype,
+                                           int                                       root,
+                                           int                                       inplace,
+                                           MPI_Comm                                  comm,
+                                           const scorep_mpi_comm_definition_payload* commPayload,
+                                           uint64_t*                                 sendbytes,
+                                           uint64_t*                                 recvbytes )
 {
     COUNT_FUN( coll_bytes_all_to_one )( sendcount,
                                         sendtype,
@@ -135,18 +137,20 @@ COUNT_FUN( scorep_mpi_coll_bytes_gather )( COUNT_T      sendcount,
                                         root,
                                         inplace,
                                         comm,
+                                        commPayload,
                                         sendbytes,
                                         recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_reduce )( COUNT_T      count,
-                                           MPI_Datatype datatype,
-                                           int          root,
-                                           int          inplace,
-                                           MPI_Comm     comm,
-                                           uint64_t*    sendbytes,
-                                           uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_reduce )( COUNT_T                                   count,
+                                           MPI_Datatype                              datatype,
+                                           int                                       root,
+                                           int                                       inplace,
+                                           MPI_Comm                                  comm,
+                                           const scorep_mpi_comm_definition_payload* commPayload,
+                                           uint64_t*                                 sendbytes,
+                                           uint64_t*                                 recvbytes )
 {
     /*
      * Reduce takes the same (count, datatype) for both send and receive
@@ -158,30 +162,32 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce )( COUNT_T      count,
                                         root,
                                         inplace,
                                         comm,
+                                        commPayload,
                                         sendbytes,
                                         recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_gatherv )( COUNT_T        sendcount,
-                                            MPI_Datatype   sendtype,
-                                            const COUNT_T* recvcounts,
-                                            MPI_Datatype   recvtype,
-                                            int            root,
-                                            int            inplace,
-                                            MPI_Comm       comm,
-                                            uint64_t*      sendbytes,
-                                            uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_gatherv )( COUNT_T                                   sendcount,
+                                            MPI_Datatype                              sendtype,
+                                            const COUNT_T*                            recvcounts,
+                                            MPI_Datatype                              recvtype,
+                                            int                                       root,
+                                            int                                       inplace,
+                                            MPI_Comm                                  comm,
+                                            const scorep_mpi_comm_definition_payload* commPayload,
+                                            uint64_t*                                 sendbytes,
+                                            uint64_t*                                 recvbytes )
 {
-    if ( is_intracomm( comm ) )
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    if ( !properties.is_intercomm )
     {
-        int me;
-        PMPI_Comm_rank( comm, &me );
+        const int me = properties.local_rank;
 
         if ( me == root )
         {
-            int num_ranks;
-            PMPI_Comm_size( comm, &num_ranks );
+            const int num_ranks = properties.comm_size;
             /*
              * At the root, recvcounts, recvtype are always significant.
              * sendcount, sendtype are ignored if the in-place option is given
@@ -225,8 +231,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_gatherv )( COUNT_T        sendcount,
     {
         if ( root == MPI_ROOT )
         {
-            int num_remote_ranks;
-            PMPI_Comm_remote_size( comm, &num_remote_ranks );
+            const int num_remote_ranks = properties.remote_comm_size;
 
             COUNT_T recvsize;
             TYPE_SIZE_FUN( recvtype, &recvsize );
@@ -259,15 +264,16 @@ COUNT_FUN( scorep_mpi_coll_bytes_gatherv )( COUNT_T        sendcount,
  * One-to-all
  * -------------------------------------------------------------------------- */
 static inline void
-COUNT_FUN( scorep_mpi_coll_bytes_one_to_all )( COUNT_T      sendcount,
-                                               MPI_Datatype sendtype,
-                                               COUNT_T      recvcount,
-                                               MPI_Datatype recvtype,
-                                               int          root,
-                                               int          inplace,
-                                               MPI_Comm     comm,
-                                               uint64_t*    sendbytes,
-                                               uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_one_to_all )( COUNT_T                                   sendcount,
+                                               MPI_Datatype                              sendtype,
+                                               COUNT_T                                   recvcount,
+                                               MPI_Datatype                              recvtype,
+                                               int                                       root,
+                                               int                                       inplace,
+                                               MPI_Comm                                  comm,
+                                               const scorep_mpi_comm_definition_payload* commPayload,
+                                               uint64_t*                                 sendbytes,
+                                               uint64_t*                                 recvbytes )
 {
     /*
      * Same as All-to-one with the meaning of send and receive exchanged
@@ -279,17 +285,19 @@ COUNT_FUN( scorep_mpi_coll_bytes_one_to_all )( COUNT_T      sendcount,
                                         root,
                                         inplace,
                                         comm,
+                                        commPayload,
                                         recvbytes,
                                         sendbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_bcast )(   COUNT_T      count,
-                                            MPI_Datatype datatype,
-                                            int          root,
-                                            MPI_Comm     comm,
-                                            uint64_t*    sendbytes,
-                                            uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_bcast )(   COUNT_T                                   count,
+                                            MPI_Datatype                              datatype,
+                                            int                                       root,
+                                            MPI_Comm                                  comm,
+                                            const scorep_mpi_comm_definition_payload* commPayload,
+                                            uint64_t*                                 sendbytes,
+                                            uint64_t*                                 recvbytes )
 {
     /*
      * Bcast takes the same (count, datatype) for both send and receive
@@ -302,20 +310,22 @@ COUNT_FUN( scorep_mpi_coll_bytes_bcast )(   COUNT_T      count,
                                                    root,
                                                    0,
                                                    comm,
+                                                   commPayload,
                                                    sendbytes,
                                                    recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_scatter )( COUNT_T      sendcount,
-                                            MPI_Datatype sendtype,
-                                            COUNT_T      recvcount,
-                                            MPI_Datatype recvtype,
-                                            int          root,
-                                            int          inplace,
-                                            MPI_Comm     comm,
-                                            uint64_t*    sendbytes,
-                                            uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_scatter )( COUNT_T                                   sendcount,
+                                            MPI_Datatype                              sendtype,
+                                            COUNT_T                                   recvcount,
+                                            MPI_Datatype                              recvtype,
+                                            int                                       root,
+                                            int                                       inplace,
+                                            MPI_Comm                                  comm,
+                                            const scorep_mpi_comm_definition_payload* commPayload,
+                                            uint64_t*                                 sendbytes,
+                                            uint64_t*                                 recvbytes )
 {
     COUNT_FUN( scorep_mpi_coll_bytes_one_to_all )( sendcount,
                                                    sendtype,
@@ -324,20 +334,22 @@ COUNT_FUN( scorep_mpi_coll_bytes_scatter )( COUNT_T      sendcount,
                                                    root,
                                                    inplace,
                                                    comm,
+                                                   commPayload,
                                                    sendbytes,
                                                    recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_scatterv )( const COUNT_T* sendcounts,
-                                             MPI_Datatype   sendtype,
-                                             COUNT_T        recvcount,
-                                             MPI_Datatype   recvtype,
-                                             int            root,
-                                             int            inplace,
-                                             MPI_Comm       comm,
-                                             uint64_t*      sendbytes,
-                                             uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_scatterv )( const COUNT_T*                            sendcounts,
+                                             MPI_Datatype                              sendtype,
+                                             COUNT_T                                   recvcount,
+                                             MPI_Datatype                              recvtype,
+                                             int                                       root,
+                                             int                                       inplace,
+                                             MPI_Comm                                  comm,
+                                             const scorep_mpi_comm_definition_payload* commPayload,
+                                             uint64_t*                                 sendbytes,
+                                             uint64_t*                                 recvbytes )
 {
     /*
      * Same as gatherv with the meaning of send and receive exchanged
@@ -349,6 +361,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_scatterv )( const COUNT_T* sendcounts,
                                                 root,
                                                 inplace,
                                                 comm,
+                                                commPayload,
                                                 recvbytes,
                                                 sendbytes );
 }
@@ -358,24 +371,19 @@ COUNT_FUN( scorep_mpi_coll_bytes_scatterv )( const COUNT_T* sendcounts,
  * All-to-all
  * -------------------------------------------------------------------------- */
 void
-COUNT_FUN( scorep_mpi_coll_bytes_alltoall )( COUNT_T      sendcount,
-                                             MPI_Datatype sendtype,
-                                             COUNT_T      recvcount,
-                                             MPI_Datatype recvtype,
-                                             int          inplace,
-                                             MPI_Comm     comm,
-                                             uint64_t*    sendbytes,
-                                             uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_alltoall )( COUNT_T                                   sendcount,
+                                             MPI_Datatype                              sendtype,
+                                             COUNT_T                                   recvcount,
+                                             MPI_Datatype                              recvtype,
+                                             int                                       inplace,
+                                             MPI_Comm                                  comm,
+                                             const scorep_mpi_comm_definition_payload* commPayload,
+                                             uint64_t*                                 sendbytes,
+                                             uint64_t*                                 recvbytes )
 {
-    int num_ranks;
-    if ( is_intracomm( comm ) )
-    {
-        PMPI_Comm_size( comm, &num_ranks );
-    }
-    else /* Intercomm */
-    {
-        PMPI_Comm_remote_size( comm, &num_ranks );
-    }
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_ranks = num_peers( &properties );
 
     /*
      * recvcounts, recvtype are always significant.
@@ -400,24 +408,19 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoall )( COUNT_T      sendcount,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_alltoallv )( const COUNT_T* sendcounts,
-                                              MPI_Datatype   sendtype,
-                                              const COUNT_T* recvcounts,
-                                              MPI_Datatype   recvtype,
-                                              int            inplace,
-                                              MPI_Comm       comm,
-                                              uint64_t*      sendbytes,
-                                              uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_alltoallv )( const COUNT_T*                            sendcounts,
+                                              MPI_Datatype                              sendtype,
+                                              const COUNT_T*                            recvcounts,
+                                              MPI_Datatype                              recvtype,
+                                              int                                       inplace,
+                                              MPI_Comm                                  comm,
+                                              const scorep_mpi_comm_definition_payload* commPayload,
+                                              uint64_t*                                 sendbytes,
+                                              uint64_t*                                 recvbytes )
 {
-    int num_ranks;
-    if ( is_intracomm( comm ) )
-    {
-        PMPI_Comm_size( comm, &num_ranks );
-    }
-    else /* Intercomm */
-    {
-        PMPI_Comm_remote_size( comm, &num_ranks );
-    }
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_ranks = num_peers( &properties );
 
     /*
      * recvcounts, recvtype are always significant.
@@ -431,8 +434,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoallv )( const COUNT_T* sendcounts,
 
     if ( inplace )
     {
-        int me;
-        PMPI_Comm_rank( comm, &me );
+        const int me = properties.local_rank;
 
         for ( int rank = 0; rank < num_ranks; ++rank )
         {
@@ -460,32 +462,26 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoallv )( const COUNT_T* sendcounts,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_alltoallw )( const COUNT_T*      sendcounts,
-                                              const MPI_Datatype* sendtypes,
-                                              const COUNT_T*      recvcounts,
-                                              const MPI_Datatype* recvtypes,
-                                              int                 inplace,
-                                              MPI_Comm            comm,
-                                              uint64_t*           sendbytes,
-                                              uint64_t*           recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_alltoallw )( const COUNT_T*                            sendcounts,
+                                              const MPI_Datatype*                       sendtypes,
+                                              const COUNT_T*                            recvcounts,
+                                              const MPI_Datatype*                       recvtypes,
+                                              int                                       inplace,
+                                              MPI_Comm                                  comm,
+                                              const scorep_mpi_comm_definition_payload* commPayload,
+                                              uint64_t*                                 sendbytes,
+                                              uint64_t*                                 recvbytes )
 {
-    int num_ranks;
-    if ( is_intracomm( comm ) )
-    {
-        PMPI_Comm_size( comm, &num_ranks );
-    }
-    else /* Intercomm */
-    {
-        PMPI_Comm_remote_size( comm, &num_ranks );
-    }
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_ranks = num_peers( &properties );
 
     *sendbytes = 0;
     *recvbytes = 0;
 
     if ( inplace )
     {
-        int me;
-        PMPI_Comm_rank( comm, &me );
+        const int me = properties.local_rank;
 
         COUNT_T recvsize;
         for ( int rank = 0; rank < num_ranks; ++rank )
@@ -516,14 +512,15 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoallw )( const COUNT_T*      sendcounts,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_allgather )( COUNT_T      sendcount,
-                                              MPI_Datatype sendtype,
-                                              COUNT_T      recvcount,
-                                              MPI_Datatype recvtype,
-                                              int          inplace,
-                                              MPI_Comm     comm,
-                                              uint64_t*    sendbytes,
-                                              uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_allgather )( COUNT_T                                   sendcount,
+                                              MPI_Datatype                              sendtype,
+                                              COUNT_T                                   recvcount,
+                                              MPI_Datatype                              recvtype,
+                                              int                                       inplace,
+                                              MPI_Comm                                  comm,
+                                              const scorep_mpi_comm_definition_payload* commPayload,
+                                              uint64_t*                                 sendbytes,
+                                              uint64_t*                                 recvbytes )
 {
     COUNT_FUN( scorep_mpi_coll_bytes_alltoall )( sendcount,
                                                  sendtype,
@@ -531,29 +528,25 @@ COUNT_FUN( scorep_mpi_coll_bytes_allgather )( COUNT_T      sendcount,
                                                  recvtype,
                                                  inplace,
                                                  comm,
+                                                 commPayload,
                                                  sendbytes,
                                                  recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_allgatherv )( COUNT_T        sendcount,
-                                               MPI_Datatype   sendtype,
-                                               const COUNT_T* recvcounts,
-                                               MPI_Datatype   recvtype,
-                                               int            inplace,
-                                               MPI_Comm       comm,
-                                               uint64_t*      sendbytes,
-                                               uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_allgatherv )( COUNT_T                                   sendcount,
+                                               MPI_Datatype                              sendtype,
+                                               const COUNT_T*                            recvcounts,
+                                               MPI_Datatype                              recvtype,
+                                               int                                       inplace,
+                                               MPI_Comm                                  comm,
+                                               const scorep_mpi_comm_definition_payload* commPayload,
+                                               uint64_t*                                 sendbytes,
+                                               uint64_t*                                 recvbytes )
 {
-    int num_ranks;
-    if ( is_intracomm( comm ) )
-    {
-        PMPI_Comm_size( comm, &num_ranks );
-    }
-    else /* Intercomm */
-    {
-        PMPI_Comm_remote_size( comm, &num_ranks );
-    }
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_ranks = num_peers( &properties );
 
     /*
      * recvcounts, recvtype are always significant.
@@ -567,8 +560,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_allgatherv )( COUNT_T        sendcount,
 
     if ( inplace )
     {
-        int me;
-        PMPI_Comm_rank( comm, &me );
+        const int me = properties.local_rank;
 
         for ( int rank = 0; rank < num_ranks; ++rank )
         {
@@ -596,12 +588,13 @@ COUNT_FUN( scorep_mpi_coll_bytes_allgatherv )( COUNT_T        sendcount,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_allreduce )( COUNT_T      count,
-                                              MPI_Datatype datatype,
-                                              int          inplace,
-                                              MPI_Comm     comm,
-                                              uint64_t*    sendbytes,
-                                              uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_allreduce )( COUNT_T                                   count,
+                                              MPI_Datatype                              datatype,
+                                              int                                       inplace,
+                                              MPI_Comm                                  comm,
+                                              const scorep_mpi_comm_definition_payload* commPayload,
+                                              uint64_t*                                 sendbytes,
+                                              uint64_t*                                 recvbytes )
 {
     COUNT_FUN( scorep_mpi_coll_bytes_alltoall )( count,
                                                  datatype,
@@ -609,20 +602,23 @@ COUNT_FUN( scorep_mpi_coll_bytes_allreduce )( COUNT_T      count,
                                                  datatype,
                                                  inplace,
                                                  comm,
+                                                 commPayload,
                                                  sendbytes,
                                                  recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter_block )( COUNT_T      recvcount,
-                                                         MPI_Datatype datatype,
-                                                         int          inplace,
-                                                         MPI_Comm     comm,
-                                                         uint64_t*    sendbytes,
-                                                         uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter_block )( COUNT_T                                   recvcount,
+                                                         MPI_Datatype                              datatype,
+                                                         int                                       inplace,
+                                                         MPI_Comm                                  comm,
+                                                         const scorep_mpi_comm_definition_payload* commPayload,
+                                                         uint64_t*                                 sendbytes,
+                                                         uint64_t*                                 recvbytes )
 {
-    int num_local_ranks;
-    PMPI_Comm_size( comm, &num_local_ranks );
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_local_ranks = properties.comm_size;
 
     COUNT_T typesize;
     TYPE_SIZE_FUN( datatype, &typesize );
@@ -640,21 +636,22 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter_block )( COUNT_T      recvcount,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter )( const COUNT_T* recvcounts,
-                                                   MPI_Datatype   datatype,
-                                                   int            inplace,
-                                                   MPI_Comm       comm,
-                                                   uint64_t*      sendbytes,
-                                                   uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter )( const COUNT_T*                            recvcounts,
+                                                   MPI_Datatype                              datatype,
+                                                   int                                       inplace,
+                                                   MPI_Comm                                  comm,
+                                                   const scorep_mpi_comm_definition_payload* commPayload,
+                                                   uint64_t*                                 sendbytes,
+                                                   uint64_t*                                 recvbytes )
 {
-    int num_local_ranks;
-    PMPI_Comm_size( comm, &num_local_ranks );
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int num_local_ranks = properties.comm_size;
 
     COUNT_T typesize;
     TYPE_SIZE_FUN( datatype, &typesize );
 
-    int me;
-    PMPI_Comm_rank( comm, &me );
+    const int me = properties.local_rank;
 
     uint64_t sendcount = 0;
     for ( int rank = 0; rank < num_local_ranks; ++rank )
@@ -662,7 +659,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter )( const COUNT_T* recvcounts,
         sendcount += recvcounts[ rank ];
     }
 
-    if ( is_intracomm( comm ) )
+    if ( !properties.is_intercomm )
     {
         if ( inplace )
         {
@@ -678,8 +675,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter )( const COUNT_T* recvcounts,
     }
     else /* Intercomm */
     {
-        int num_remote_ranks;
-        PMPI_Comm_remote_size( comm, &num_remote_ranks );
+        const int num_remote_ranks = properties.remote_comm_size;
 
         *sendbytes = sendcount * typesize;
         *recvbytes = num_remote_ranks * recvcounts[ me ] * typesize;
@@ -692,18 +688,18 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter )( const COUNT_T* recvcounts,
  * Scan
  * -------------------------------------------------------------------------- */
 void
-COUNT_FUN( scorep_mpi_coll_bytes_scan )( COUNT_T      count,
-                                         MPI_Datatype datatype,
-                                         int          inplace,
-                                         MPI_Comm     comm,
-                                         uint64_t*    sendbytes,
-                                         uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_scan )( COUNT_T                                   count,
+                                         MPI_Datatype                              datatype,
+                                         int                                       inplace,
+                                         MPI_Comm                                  comm,
+                                         const scorep_mpi_comm_definition_payload* commPayload,
+                                         uint64_t*                                 sendbytes,
+                                         uint64_t*                                 recvbytes )
 {
-    int me;
-    PMPI_Comm_rank( comm, &me );
-
-    int num_ranks;
-    PMPI_Comm_size( comm, &num_ranks );
+    comm_properties properties;
+    get_comm_properties( comm, commPayload, &properties );
+    const int me        = properties.local_rank;
+    const int num_ranks = properties.comm_size;
 
     COUNT_T size;
     TYPE_SIZE_FUN( datatype, &size );
@@ -722,12 +718,13 @@ COUNT_FUN( scorep_mpi_coll_bytes_scan )( COUNT_T      count,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_exscan )( COUNT_T      count,
-                                           MPI_Datatype datatype,
-                                           int          inplace,
-                                           MPI_Comm     comm,
-                                           uint64_t*    sendbytes,
-                                           uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_exscan )( COUNT_T                                   count,
+                                           MPI_Datatype                              datatype,
+                                           int                                       inplace,
+                                           MPI_Comm                                  comm,
+                                           const scorep_mpi_comm_definition_payload* commPayload,
+                                           uint64_t*                                 sendbytes,
+                                           uint64_t*                                 recvbytes )
 {
     /*
      * Exscan never sends data to itself,
@@ -737,6 +734,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_exscan )( COUNT_T      count,
                                              datatype,
                                              1,
                                              comm,
+                                             commPayload,
                                              sendbytes,
                                              recvbytes );
 }
@@ -748,12 +746,14 @@ COUNT_FUN( scorep_mpi_coll_bytes_exscan )( COUNT_T      count,
 
 /**
  * Iterate over all neighbors in a comm with cartesian topology and execute CODE
- * for the non-null neighbors.
+ * for the non-null neighbors. Their indices are taken from the definition
+ * payload, or determined with MPI_Cart_shift if there is none.
  *
- * comm : Name of an MPI_Comm with cartesian topology.
- * index: Name of the index variable. Declared as int by the macro.
- * CODE : Code to be executed for the neighbors that are not MPI_PROC_NULL.
- *        Can use 'index'.
+ * comm       : Name of an MPI_Comm with cartesian topology.
+ * commPayload: Definition payload of comm, or NULL.
+ * index      : Name of the index variable. Declared as int by the macro.
+ * CODE       : Code to be executed for the neighbors that are not MPI_PROC_NULL.
+ *              Can use 'index'.
  *
  *
  * Indexing of neighbors in a cartesian topology, See MPI Standard 4.0, Section 8.6:
@@ -767,49 +767,60 @@ COUNT_FUN( scorep_mpi_coll_bytes_exscan )( COUNT_T      count,
  * case of a nonperiodic virtual grid dimension (i.e., periods[. . .]==false),
  * then this neighbor is defined to be MPI_PROC_NULL.
  */
-#define CART_ITER_NON_NULL_NEIGHBORS( comm, index, CODE ) do { \
-        int ndims; \
-        int neighbor_ranks[ 2 ]; \
-        int index; \
-        PMPI_Cartdim_get( comm, &ndims ); \
-        for ( int dim = 0; dim < ndims; ++dim ) \
+#define CART_ITER_NON_NULL_NEIGHBORS( comm, commPayload, index, CODE ) do { \
+        if ( commPayload ) \
+        { \
+            for ( int neighbor = 0; neighbor < ( commPayload )->num_cart_neighbors; ++neighbor ) \
+            { \
+                int index = ( commPayload )->cart_neighbors[ neighbor ]; \
+                { CODE } \
+            } \
+        } \
+        else \
         { \
-            PMPI_Cart_shift( comm, dim, 1, &neighbor_ranks[ 0 ], &neighbor_ranks[ 1 ] ); \
-            for ( int i = 0; i < 2; ++i ) \
+            int ndims; \
+            int neighbor_ranks[ 2 ]; \
+            PMPI_Cartdim_get( comm, &ndims ); \
+            for ( int dim = 0; dim < ndims; ++dim ) \
             { \
-                if ( neighbor_ranks[ i ] != MPI_PROC_NULL ) \
+                PMPI_Cart_shift( comm, dim, 1, &neighbor_ranks[ 0 ], &neighbor_ranks[ 1 ] ); \
+                for ( int i = 0; i < 2; ++i ) \
                 { \
-                    index = 2 * dim + i; \
-                    { CODE } \
+                    if ( neighbor_ranks[ i ] != MPI_PROC_NULL ) \
+                    { \
+                        int index = 2 * dim + i; \
+                        { CODE } \
+                    } \
                 } \
             } \
         } \
 } while ( 0 )
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoall )( COUNT_T      sendcount,
-                                                      MPI_Datatype sendtype,
-                                                      COUNT_T      recvcount,
-                                                      MPI_Datatype recvtype,
-                                                      MPI_Comm     comm,
-                                                      uint64_t*    sendbytes,
-                                                      uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoall )( COUNT_T                                   sendcount,
+                                                      MPI_Datatype                              sendtype,
+                                                      COUNT_T                                   recvcount,
+                                                      MPI_Datatype                              recvtype,
+                                                      MPI_Comm                                  comm,
+                                                      const scorep_mpi_comm_definition_payload* commPayload,
+                                                      uint64_t*                                 sendbytes,
+                                                      uint64_t*                                 recvbytes )
 {
+    int topology, indegree, outdegree;
+    get_topology( comm, commPayload, &topology, &indegree, &outdegree );
+
     int num_sources, num_destinations;
-    if ( is_cart_topo( comm ) )
+    if ( topology == MPI_CART )
     {
-        int nneighbors = 0;
-        CART_ITER_NON_NULL_NEIGHBORS( comm, index, ++nneighbors;
-                                      );
-        num_sources      = nneighbors;
-        num_destinations = nneighbors;
+        num_sources      = num_cart_neighbors( comm, commPayload );
+        num_destinations = num_sources;
     }
     else
     {
-        scorep_mpi_topo_num_neighbors( comm, &num_sources, &num_destinations );
+        num_sources      = indegree;
+        num_destinations = outdegree;
     }
 
-
     COUNT_T sendsize, recvsize;
     TYPE_SIZE_FUN( sendtype, &sendsize );
     TYPE_SIZE_FUN( recvtype, &recvsize );
@@ -818,13 +829,14 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoall )( COUNT_T      sendcount,
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallv )( const COUNT_T* sendcounts,
-                                                       MPI_Datatype   sendtype,
-                                                       const COUNT_T* recvcounts,
-                                                       MPI_Datatype   recvtype,
-                                                       MPI_Comm       comm,
-                                                       uint64_t*      sendbytes,
-                                                       uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallv )( const COUNT_T*                            sendcounts,
+                                                       MPI_Datatype                              sendtype,
+                                                       const COUNT_T*                            recvcounts,
+                                                       MPI_Datatype                              recvtype,
+                                                       MPI_Comm                                  comm,
+                                                       const scorep_mpi_comm_definition_payload* commPayload,
+                                                       uint64_t*                                 sendbytes,
+                                                       uint64_t*                                 recvbytes )
 {
     *sendbytes = 0;
     *recvbytes = 0;
@@ -833,18 +845,17 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallv )( const COUNT_T* sendcounts
     TYPE_SIZE_FUN( sendtype, &sendsize );
     TYPE_SIZE_FUN( recvtype, &recvsize );
 
-    if ( is_cart_topo( comm ) )
+    int topology, indegree, outdegree;
+    get_topology( comm, commPayload, &topology, &indegree, &outdegree );
+    if ( topology == MPI_CART )
     {
-        CART_ITER_NON_NULL_NEIGHBORS( comm, index,
+        CART_ITER_NON_NULL_NEIGHBORS( comm, commPayload, index,
                                       *sendbytes += sendcounts[ index ] * sendsize;
                                       *recvbytes += recvcounts[ index ] * recvsize;
                                       );
     }
     else
     {
-        int indegree, outdegree;
-        scorep_mpi_topo_num_neighbors( comm, &indegree, &outdegree );
-
         for ( int i = 0; i < outdegree; ++i )
         {
             *sendbytes += sendcounts[ i ] * sendsize;
@@ -857,22 +868,25 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallv )( const COUNT_T* sendcounts
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw )( const COUNT_T*      sendcounts,
-                                                       const MPI_Datatype* sendtypes,
-                                                       const COUNT_T*      recvcounts,
-                                                       const MPI_Datatype* recvtypes,
-                                                       MPI_Comm            comm,
-                                                       uint64_t*           sendbytes,
-                                                       uint64_t*           recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw )( const COUNT_T*                            sendcounts,
+                                                       const MPI_Datatype*                       sendtypes,
+                                                       const COUNT_T*                            recvcounts,
+                                                       const MPI_Datatype*                       recvtypes,
+                                                       MPI_Comm                                  comm,
+                                                       const scorep_mpi_comm_definition_payload* commPayload,
+                                                       uint64_t*                                 sendbytes,
+                                                       uint64_t*                                 recvbytes )
 {
     *sendbytes = 0;
     *recvbytes = 0;
 
     COUNT_T sendsize, recvsize;
 
-    if ( is_cart_topo( comm ) )
+    int topology, indegree, outdegree;
+    get_topology( comm, commPayload, &topology, &indegree, &outdegree );
+    if ( topology == MPI_CART )
     {
-        CART_ITER_NON_NULL_NEIGHBORS( comm, index,
+        CART_ITER_NON_NULL_NEIGHBORS( comm, commPayload, index,
                                       TYPE_SIZE_FUN( sendtypes[ index ], &sendsize );
                                       TYPE_SIZE_FUN( recvtypes[ index ], &recvsize );
                                       *sendbytes += sendcounts[ index ] * sendsize;
@@ -881,9 +895,6 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw )( const COUNT_T*      sendc
     }
     else
     {
-        int indegree, outdegree;
-        scorep_mpi_topo_num_neighbors( comm, &indegree, &outdegree );
-
         for ( int i = 0; i < outdegree; ++i )
         {
             TYPE_SIZE_FUN( sendtypes[ i ], &sendsize );
@@ -898,31 +909,34 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw )( const COUNT_T*      sendc
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgather )( COUNT_T      sendcount,
-                                                       MPI_Datatype sendtype,
-                                                       COUNT_T      recvcount,
-                                                       MPI_Datatype recvtype,
-                                                       MPI_Comm     comm,
-                                                       uint64_t*    sendbytes,
-                                                       uint64_t*    recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgather )( COUNT_T                                   sendcount,
+                                                       MPI_Datatype                              sendtype,
+                                                       COUNT_T                                   recvcount,
+                                                       MPI_Datatype                              recvtype,
+                                                       MPI_Comm                                  comm,
+                                                       const scorep_mpi_comm_definition_payload* commPayload,
+                                                       uint64_t*                                 sendbytes,
+                                                       uint64_t*                                 recvbytes )
 {
     scorep_mpi_coll_bytes_neighbor_alltoall( sendcount,
                                              sendtype,
                                              recvcount,
                                              recvtype,
                                              comm,
+                                             commPayload,
                                              sendbytes,
                                              recvbytes );
 }
 
 void
-COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgatherv )( COUNT_T        sendcount,
-                                                        MPI_Datatype   sendtype,
-                                                        const COUNT_T* recvcounts,
-                                                        MPI_Datatype   recvtype,
-                                                        MPI_Comm       comm,
-                                                        uint64_t*      sendbytes,
-                                                        uint64_t*      recvbytes )
+COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgatherv )( COUNT_T                                   sendcount,
+                                                        MPI_Datatype                              sendtype,
+                                                        const COUNT_T*                            recvcounts,
+                                                        MPI_Datatype                              recvtype,
+                                                        MPI_Comm                                  comm,
+                                                        const scorep_mpi_comm_definition_payload* commPayload,
+                                                        uint64_t*                                 sendbytes,
+                                                        uint64_t*                                 recvbytes )
 {
     *sendbytes = 0;
     *recvbytes = 0;
@@ -931,19 +945,17 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgatherv )( COUNT_T        sendcount
     TYPE_SIZE_FUN( sendtype, &sendsize );
     TYPE_SIZE_FUN( recvtype, &recvsize );
 
-    if ( is_cart_topo( comm ) )
+    int topology, indegree, outdegree;
+    get_topology( comm, commPayload, &topology, &indegree, &outdegree );
+    if ( topology == MPI_CART )
     {
-        CART_ITER_NON_NULL_NEIGHBORS( comm, index,
+        CART_ITER_NON_NULL_NEIGHBORS( comm, commPayload, index,
                                       *sendbytes += sendcount * sendsize;
                                       *recvbytes += recvcounts[ index ] * recvsize;
                                       );
     }
     else
     {
-        int indegree, outdegree;
-        scorep_mpi_topo_num_neighbors( comm, &indegree, &outdegree );
-
-
         *sendbytes = outdegree * sendcount * sendsize;
         for ( int i = 0; i < indegree; ++i )
         {
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2017, 2022, 2025,
+ * Copyright (c) 2009-2014, 2017, 2022, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -39,6 +39,7 @@
 #include <scorep_mpi_communicator.h>
 #include <scorep_mpi_communicator_mgmt.h>
 #include <scorep_mpi_c.h>
+#include <scorep_mpi_rma_request.h>
 #include <SCOREP_Definitions.h>
 
 #include <UTILS_Error.h>
@@ -190,6 +191,7 @@ scorep_mpi_win_free( MPI_Win win )
     UTILS_MutexLock( &scorep_mpi_window_mutex );
     if ( scorep_mpi_last_window == 1 && scorep_mpi_windows[ 0 ].win == win )
     {
+        scorep_mpi_rma_request_free_window( scorep_mpi_windows[ 0 ].handle );
         scorep_mpi_last_window = 0;
     }
     else if ( scorep_mpi_last_window > 1 )
@@ -203,6 +205,7 @@ scorep_mpi_win_free( MPI_Win win )
 
         if ( i < scorep_mpi_last_window-- )
         {
+            scorep_mpi_rma_request_free_window( scorep_mpi_windows[ i ].handle );
             scorep_mpi_windows[ i ] = scorep_mpi_windows[ scorep_mpi_last_window ];
         }
         else
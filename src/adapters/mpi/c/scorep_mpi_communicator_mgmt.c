@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2013-2014, 2017, 2022, 2025,
+ * Copyright (c) 2013-2014, 2017, 2022, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2018, 2020,
@@ -25,6 +25,7 @@
 
 #include <scorep_mpi_groups.h>
 #include <scorep_mpi_c.h>
+#include <scorep_mpi_coll.h>
 
 #include <UTILS_Error.h>
 #include <UTILS_Mutex.h>
@@ -273,6 +274,31 @@ scorep_mpi_comm_create_id( MPI_Comm               comm,
     }
 }
 
+/**
+ * @brief Collect the indices of the neighbors in a Cartesian topology which
+ *        are not MPI_PROC_NULL
+ * See CART_ITER_NON_NULL_NEIGHBORS in scorep_mpi_coll.inc.c for the indexing.
+ */
+static void
+set_cart_neighbors( MPI_Comm                            comm,
+                    int                                 ndims,
+                    scorep_mpi_comm_definition_payload* commPayload )
+{
+    commPayload->num_cart_neighbors = 0;
+    for ( int dim = 0; dim < ndims; ++dim )
+    {
+        int neighbor_ranks[ 2 ];
+        PMPI_Cart_shift( comm, dim, 1, &neighbor_ranks[ 0 ], &neighbor_ranks[ 1 ] );
+        for ( int i = 0; i < 2; ++i )
+        {
+            if ( neighbor_ranks[ i ] != MPI_PROC_NULL )
+            {
+                commPayload->cart_neighbors[ commPayload->num_cart_neighbors++ ] = 2 * dim + i;
+            }
+        }
+    }
+}
+
 SCOREP_InterimCommunicatorHandle
 scorep_mpi_comm_create_finalize( MPI_Comm                         comm,
                                  SCOREP_InterimCommunicatorHandle parentCommHandle )
@@ -343,11 +369,22 @@ scorep_mpi_comm_create_finalize( MPI_Comm                         comm,
         scorep_mpi_comm_create_id( comm, size, local_rank, &root, &id );
     }
 
+    /* determine the topology, inter communicators have none */
+    int topology  = MPI_UNDEFINED;
+    int indegree  = 0;
+    int outdegree = 0;
+    int ndims     = 0;
+    if ( !is_inter_comm )
+    {
+        scorep_mpi_topo_get( comm, local_rank, &topology, &indegree, &outdegree, &ndims );
+    }
+
     /* create definition in measurement system */
     scorep_mpi_comm_definition_payload* comm_payload;
     handle = SCOREP_Definitions_NewInterimCommunicator( parentCommHandle,
                                                         SCOREP_PARADIGM_MPI,
-                                                        sizeof( *comm_payload ),
+                                                        sizeof( *comm_payload )
+                                                        + 2 * ndims * sizeof( int ),
                                                         ( void** )&comm_payload );
     comm_payload->comm_size         = size;
     comm_payload->local_rank        = local_rank;
@@ -355,6 +392,11 @@ scorep_mpi_comm_create_finalize( MPI_Comm                         comm,
     comm_payload->global_root_rank  = root;
     comm_payload->root_id           = id;
     comm_payload->io_handle_counter = 0;
+    comm_payload->is_intercomm      = is_inter_comm;
+    comm_payload->topology          = topology;
+    comm_payload->indegree          = indegree;
+    comm_payload->outdegree         = outdegree;
+    set_cart_neighbors( comm, ndims, comm_payload );
 
     /* enter comm in scorep_mpi_comms[] array */
     scorep_mpi_comms[ scorep_mpi_last_comm ].comm = comm;
@@ -480,12 +522,17 @@ scorep_mpi_setup_world( void )
                                                    SCOREP_PARADIGM_MPI,
                                                    sizeof( *comm_payload ),
                                                    ( void** )&comm_payload );
-    comm_payload->comm_size         = scorep_mpi_world.size;
-    comm_payload->local_rank        = scorep_mpi_my_global_rank;
-    comm_payload->remote_comm_size  = 0;
-    comm_payload->global_root_rank  = 0;
-    comm_payload->root_id           = 0;
-    comm_payload->io_handle_counter = 0;
+    comm_payload->comm_size          = scorep_mpi_world.size;
+    comm_payload->local_rank         = scorep_mpi_my_global_rank;
+    comm_payload->remote_comm_size   = 0;
+    comm_payload->global_root_rank   = 0;
+    comm_payload->root_id            = 0;
+    comm_payload->io_handle_counter  = 0;
+    comm_payload->is_intercomm       = false;
+    comm_payload->topology           = MPI_UNDEFINED;
+    comm_payload->indegree           = 0;
+    comm_payload->outdegree          = 0;
+    comm_payload->num_cart_neighbors = 0;
 
     if ( scorep_mpi_my_global_rank == 0 )
     {
@@ -530,6 +577,7 @@ scorep_mpi_comm_init( void )
                          "SCOREP_MPI_MAX_GROUPS.", SCOREP_MPI_MAX_GROUP );
         }
 
+        scorep_mpi_coll_init();
         scorep_mpi_setup_world();
 
         /* The initialization is done, flag that */
@@ -591,6 +639,16 @@ scorep_mpi_comm_handle( MPI_Comm comm )
     }
 }
 
+const scorep_mpi_comm_definition_payload*
+scorep_mpi_comm_payload( SCOREP_InterimCommunicatorHandle commHandle )
+{
+    if ( commHandle == SCOREP_INVALID_INTERIM_COMMUNICATOR )
+    {
+        return NULL;
+    }
+    return SCOREP_InterimCommunicatorHandle_GetPayload( commHandle );
+}
+
 uint32_t
 scorep_mpi_io_get_unify_key( SCOREP_InterimCommunicatorHandle commHandle )
 {
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2017, 2022-2023, 2025,
+ * Copyright (c) 2009-2014, 2017, 2022-2023, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -382,14 +382,14 @@ scorep_mpi_request_p2p_create( MPI_Request             request,
 }
 
 void
-scorep_mpi_request_icoll_create( MPI_Request             request,
-                                 scorep_mpi_request_flag flags,
-                                 SCOREP_CollectiveType   collectiveType,
-                                 int                     rootLoc,
-                                 uint64_t                bytesSent,
-                                 uint64_t                bytesRecv,
-                                 MPI_Comm                comm,
-                                 SCOREP_MpiRequestId     id )
+scorep_mpi_request_icoll_create( MPI_Request                      request,
+                                 scorep_mpi_request_flag          flags,
+                                 SCOREP_CollectiveType            collectiveType,
+                                 int                              rootLoc,
+                                 uint64_t                         bytesSent,
+                                 uint64_t                         bytesRecv,
+                                 SCOREP_InterimCommunicatorHandle commHandle,
+                                 SCOREP_MpiRequestId              id )
 {
     scorep_mpi_request data = { .request       = request,
                                 .request_type  = SCOREP_MPI_REQUEST_TYPE_ICOLL,
@@ -398,7 +398,7 @@ scorep_mpi_request_icoll_create( MPI_Request             request,
                                     .root_loc    = rootLoc,
                                     .bytes_sent  = bytesSent,
                                     .bytes_recv  = bytesRecv,
-                                    .comm_handle = SCOREP_MPI_COMM_HANDLE( comm ),
+                                    .comm_handle = commHandle,
                                 },
                                 .flags  = flags,
                                 .id     = id,
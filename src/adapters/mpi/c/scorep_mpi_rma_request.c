@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2017, 2019, 2022,
+ * Copyright (c) 2017, 2019, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2019,
@@ -26,51 +26,86 @@
 #include <scorep_mpi_rma_request.h>
 
 #include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define SCOREP_DEBUG_MODULE_NAME MPI
 #include <UTILS_Debug.h>
 
 #include <SCOREP_Events.h>
+#include <SCOREP_Memory.h>
 
 #include <UTILS_Error.h>
 #include <UTILS_Mutex.h>
 
-#define SCOREP_SKIPLIST_TYPE scorep_mpi_rma_request
-#include <SCOREP_Skiplist.h>
-
-/**
- * @internal
- * @brief Head node of the RMA request list
+/*
+ * Requests are tracked per window and per target. Each window has its own
+ * lock and a hash table of its targets. A target holds its implicit requests
+ * (one per completion type) in fixed slots and its request-based operations
+ * in a list. Targets with pending requests are linked per window, thus
+ * completing all requests of a window or of a target does not need to search.
+ *
+ * Nodes, targets, and windows are recycled, they are allocated from the
+ * Score-P memory which is only released at the end of the measurement.
  */
-static scorep_mpi_rma_request_skiplist_t* rma_requests;
+
+typedef struct rma_request_node rma_request_node;
+typedef struct rma_target       rma_target;
+typedef struct rma_window       rma_window;
+
+struct rma_request_node
+{
+    /* Needs to be the first member, see scorep_mpi_rma_request_remove_by_ptr */
+    scorep_mpi_rma_request payload;
+    rma_target*            target;
+    rma_request_node*      prev;
+    rma_request_node*      next;
+};
+
+struct rma_target
+{
+    rma_window*       window;
+    int               rank;
+    rma_target*       hash_next;
+    rma_target*       pending_prev;
+    rma_target*       pending_next;
+    uint32_t          number_of_requests;
+    rma_request_node* implicit[ 2 ];
+    rma_request_node* requests_head;
+    rma_request_node* requests_tail;
+};
+
+struct rma_window
+{
+    SCOREP_RmaWindowHandle handle;
+    rma_window*            next;
+    UTILS_Mutex            lock;
+    rma_target**           targets;
+    uint32_t               targets_capacity;
+    uint32_t               number_of_targets;
+    rma_target*            pending_targets;
+    rma_target*            free_targets;
+    rma_request_node*      free_nodes;
+};
+
+#define WINDOW_BUCKETS 64
 
 /**
  * @internal
- * @brief Mutex for rma_requests
+ * @brief Hash buckets of the tracked windows, each with its own lock
  */
-static UTILS_Mutex rma_request_mutex;
+static struct
+{
+    UTILS_Mutex lock;
+    rma_window* windows;
+} window_buckets[ WINDOW_BUCKETS ];
 
 /**
  * @internal
- * @brief Reset values to a defined state
- *
- * @param payload Pointer to payload structure to reset
- *
- * @note Dispite of being a static function, this function is part of the
- * SKIPLIST functionality for the type #scorep_mpi_rma_request and therefore
- * retains the @c scorep_ prefix.
+ * @brief Released windows, guarded by free_windows_mutex
  */
-static void
-scorep_mpi_rma_request_reset_payload( scorep_mpi_rma_request* payload )
-{
-    payload->window            = SCOREP_INVALID_RMA_WINDOW;
-    payload->target            = -1;
-    payload->matching_id       = 0;
-    payload->mpi_handle        = MPI_REQUEST_NULL;
-    payload->completion_type   = SCOREP_MPI_RMA_REQUEST_SEPARATE_COMPLETION;
-    payload->completed_locally = false;
-    payload->schedule_removal  = false;
-}
+static rma_window* free_windows;
+static UTILS_Mutex free_windows_mutex;
 
 /**
  * @internal
@@ -78,113 +113,404 @@ scorep_mpi_rma_request_reset_payload( scorep_mpi_rma_request* payload )
  *
  * @param prefix String prefix to the output
  * @param request Pointer to request data to print
- *
- * @note Dispite of being a static function, this function is part of the
- * SKIPLIST functionality for the type #scorep_mpi_rma_request and therefore
- * retains the @c scorep_ prefix.
  */
 static void
-scorep_mpi_rma_request_print_payload( const char* prefix, const scorep_mpi_rma_request* request )
+print_payload( const char* prefix, const scorep_mpi_rma_request* request )
 {
     UTILS_DEBUG( "%s: win=%" PRIu32 " target=%i match=%" PRIu64 " req=%lu compl=%i", prefix,
                  request->window, request->target, request->matching_id,
                  request->mpi_handle, request->completion_type );
 }
 
-void
-scorep_mpi_rma_request_init( void )
+static inline uint32_t
+hash_window( SCOREP_RmaWindowHandle handle )
 {
-    unsigned int height = 6;
+    return ( ( uint32_t )handle * UINT32_C( 0x9e3779b1 ) ) >> 26;
+}
 
-    // Create a skiplist for 2^6 elements
-    rma_requests = scorep_mpi_rma_request_create_list( height,
-                                                       ( SCOREP_Skiplist_Guard )UTILS_MutexLock,
-                                                       ( SCOREP_Skiplist_Guard )UTILS_MutexUnlock,
-                                                       ( SCOREP_Skiplist_GuardObject )( &rma_request_mutex ) );
+static inline uint32_t
+hash_target( const rma_window* window,
+             int               rank )
+{
+    return ( ( uint32_t )rank * UINT32_C( 0x9e3779b1 ) ) & ( window->targets_capacity - 1 );
 }
 
-void
-scorep_mpi_rma_request_finalize( void )
+/**
+ * @internal
+ * @brief Find the tracking data of @a handle, create it if @a create is true
+ */
+static rma_window*
+get_window( SCOREP_RmaWindowHandle handle,
+            bool                   create )
 {
-    if ( !scorep_mpi_rma_request_is_empty( rma_requests ) )
+    uint32_t bucket = hash_window( handle );
+
+    UTILS_MutexLock( &window_buckets[ bucket ].lock );
+
+    rma_window* window = window_buckets[ bucket ].windows;
+    while ( window && window->handle != handle )
     {
-        UTILS_WARNING( "Request tracking not completed successfully for all RMA operations." );
+        window = window->next;
+    }
+
+    if ( !window && create )
+    {
+        UTILS_MutexLock( &free_windows_mutex );
+        window = free_windows;
+        if ( window )
+        {
+            free_windows = window->next;
+        }
+        UTILS_MutexUnlock( &free_windows_mutex );
+
+        if ( !window )
+        {
+            window = SCOREP_Memory_AllocForMisc( sizeof( *window ) );
+            memset( window, 0, sizeof( *window ) );
+            window->targets_capacity = 16;
+            window->targets          = calloc( window->targets_capacity, sizeof( *window->targets ) );
+            UTILS_ASSERT( window->targets );
+        }
+
+        window->handle                    = handle;
+        window->next                      = window_buckets[ bucket ].windows;
+        window_buckets[ bucket ].windows = window;
     }
-    scorep_mpi_rma_request_destroy_list( rma_requests );
+
+    UTILS_MutexUnlock( &window_buckets[ bucket ].lock );
+
+    return window;
 }
 
-static int
-scorep_mpi_rma_request_cmp( const scorep_mpi_rma_request* listElement,
-                            const scorep_mpi_rma_request* searchElement )
+/* Needs the lock of @a window */
+static rma_target*
+find_target( rma_window* window,
+             int         rank )
 {
-    scorep_mpi_rma_request_print_payload( "List element", listElement );
-    scorep_mpi_rma_request_print_payload( "Search element", searchElement );
+    rma_target* target = window->targets[ hash_target( window, rank ) ];
+    while ( target && target->rank != rank )
+    {
+        target = target->hash_next;
+    }
+    return target;
+}
 
-    // Test corner cases
-    if ( listElement->window == SCOREP_INVALID_RMA_WINDOW && searchElement->window != SCOREP_INVALID_RMA_WINDOW )
+/* Needs the lock of @a window */
+static rma_target*
+get_target( rma_window* window,
+            int         rank )
+{
+    rma_target* target = find_target( window, rank );
+    if ( target )
     {
-        return -1;
+        return target;
     }
-    if ( listElement->window != SCOREP_INVALID_RMA_WINDOW && searchElement->window == SCOREP_INVALID_RMA_WINDOW )
+
+    if ( window->number_of_targets == window->targets_capacity )
     {
-        return 1;
+        uint32_t     old_capacity = window->targets_capacity;
+        rma_target** old_targets  = window->targets;
+
+        window->targets_capacity *= 2;
+        window->targets           = calloc( window->targets_capacity, sizeof( *window->targets ) );
+        UTILS_ASSERT( window->targets );
+        for ( uint32_t i = 0; i < old_capacity; i++ )
+        {
+            while ( old_targets[ i ] )
+            {
+                rma_target* moved = old_targets[ i ];
+                old_targets[ i ] = moved->hash_next;
+
+                uint32_t bucket = hash_target( window, moved->rank );
+                moved->hash_next            = window->targets[ bucket ];
+                window->targets[ bucket ] = moved;
+            }
+        }
+        free( old_targets );
     }
 
-    // Test window handle value
-    if ( listElement->window < searchElement->window )
+    target = window->free_targets;
+    if ( target )
     {
-        return -1;
+        window->free_targets = target->hash_next;
     }
-    if ( listElement->window > searchElement->window )
+    else
     {
-        return 1;
+        target = SCOREP_Memory_AllocForMisc( sizeof( *target ) );
     }
+    memset( target, 0, sizeof( *target ) );
+    target->window = window;
+    target->rank   = rank;
+
+    uint32_t bucket = hash_target( window, rank );
+    target->hash_next         = window->targets[ bucket ];
+    window->targets[ bucket ] = target;
+    window->number_of_targets++;
+
+    return target;
+}
 
-    // Test target value
-    if ( listElement->target < searchElement->target )
+/* Needs the lock of the window of @a target */
+static void
+add_node( rma_target*       target,
+          rma_request_node* node )
+{
+    node->target = target;
+
+    scorep_mpi_rma_request* request = &node->payload;
+    if ( request->mpi_handle == MPI_REQUEST_NULL
+         && target->implicit[ request->completion_type ] == NULL )
     {
-        return -1;
+        target->implicit[ request->completion_type ] = node;
     }
-    if ( listElement->target > searchElement->target )
+    else
     {
-        return 1;
+        node->prev = target->requests_tail;
+        node->next = NULL;
+        if ( target->requests_tail )
+        {
+            target->requests_tail->next = node;
+        }
+        else
+        {
+            target->requests_head = node;
+        }
+        target->requests_tail = node;
     }
 
-    if ( listElement->mpi_handle == MPI_REQUEST_NULL && searchElement->mpi_handle != MPI_REQUEST_NULL )
+    if ( target->number_of_requests++ == 0 )
     {
-        return -1;
+        rma_window* window = target->window;
+        target->pending_prev = NULL;
+        target->pending_next = window->pending_targets;
+        if ( window->pending_targets )
+        {
+            window->pending_targets->pending_prev = target;
+        }
+        window->pending_targets = target;
     }
-    if ( listElement->mpi_handle != MPI_REQUEST_NULL && searchElement->mpi_handle == MPI_REQUEST_NULL )
+}
+
+/* Needs the lock of the window of @a node */
+static void
+remove_node( rma_request_node* node )
+{
+    rma_target* target = node->target;
+    rma_window* window = target->window;
+
+    print_payload( "Removing", &node->payload );
+
+    if ( target->implicit[ node->payload.completion_type ] == node )
     {
-        return 1;
+        target->implicit[ node->payload.completion_type ] = NULL;
+    }
+    else
+    {
+        if ( node->prev )
+        {
+            node->prev->next = node->next;
+        }
+        else
+        {
+            target->requests_head = node->next;
+        }
+        if ( node->next )
+        {
+            node->next->prev = node->prev;
+        }
+        else
+        {
+            target->requests_tail = node->prev;
+        }
     }
 
-    // Test MPI request handle
-    if ( listElement->mpi_handle < searchElement->mpi_handle )
+    if ( --target->number_of_requests == 0 )
     {
-        return -1;
+        if ( target->pending_prev )
+        {
+            target->pending_prev->pending_next = target->pending_next;
+        }
+        else
+        {
+            window->pending_targets = target->pending_next;
+        }
+        if ( target->pending_next )
+        {
+            target->pending_next->pending_prev = target->pending_prev;
+        }
     }
-    if ( listElement->mpi_handle > searchElement->mpi_handle )
+
+    node->target       = NULL;
+    node->next         = window->free_nodes;
+    window->free_nodes = node;
+}
+
+/* Needs the lock of the window of @a target */
+static void
+foreach_on_target( rma_target*                target,
+                   scorep_mpi_rma_request_cb* callback )
+{
+    for ( int type = 0; type < 2; type++ )
     {
-        return 1;
+        rma_request_node* node = target->implicit[ type ];
+        if ( node )
+        {
+            print_payload( "Processing", &node->payload );
+            ( *callback )( &node->payload );
+            if ( node->payload.schedule_removal )
+            {
+                remove_node( node );
+            }
+        }
     }
 
-    // Test completion flag
-    if ( listElement->completion_type != searchElement->completion_type )
+    rma_request_node* node = target->requests_head;
+    while ( node )
     {
-        if ( listElement->completion_type == SCOREP_MPI_RMA_REQUEST_SEPARATE_COMPLETION )
+        rma_request_node* next = node->next;
+
+        print_payload( "Processing", &node->payload );
+        ( *callback )( &node->payload );
+        if ( node->payload.schedule_removal )
         {
-            return -1;
+            remove_node( node );
         }
-        else
+
+        node = next;
+    }
+}
+
+/* Needs the lock of @a window */
+static rma_request_node*
+find_node( rma_window*                  window,
+           int                          rank,
+           MPI_Request                  mpiHandle,
+           SCOREP_Mpi_RmaCompletionType completionType )
+{
+    rma_target* target = find_target( window, rank );
+    if ( !target )
+    {
+        return NULL;
+    }
+
+    if ( mpiHandle == MPI_REQUEST_NULL && target->implicit[ completionType ] )
+    {
+        return target->implicit[ completionType ];
+    }
+
+    rma_request_node* node = target->requests_head;
+    while ( node
+            && ( node->payload.mpi_handle != mpiHandle
+                 || node->payload.completion_type != completionType ) )
+    {
+        node = node->next;
+    }
+    return node;
+}
+
+/* Releases all tracking data of @a window, needs its lock */
+static void
+clear_window( rma_window* window )
+{
+    if ( window->pending_targets )
+    {
+        UTILS_WARNING( "Request tracking not completed successfully for all RMA operations." );
+    }
+
+    for ( uint32_t i = 0; i < window->targets_capacity; i++ )
+    {
+        while ( window->targets[ i ] )
+        {
+            rma_target* target = window->targets[ i ];
+            window->targets[ i ] = target->hash_next;
+
+            /* drop the pending requests */
+            for ( int type = 0; type < 2; type++ )
+            {
+                if ( target->implicit[ type ] )
+                {
+                    remove_node( target->implicit[ type ] );
+                }
+            }
+            while ( target->requests_head )
+            {
+                remove_node( target->requests_head );
+            }
+
+            target->hash_next    = window->free_targets;
+            window->free_targets = target;
+        }
+    }
+    window->number_of_targets = 0;
+}
+
+void
+scorep_mpi_rma_request_init( void )
+{
+    /* Windows are tracked on their first RMA operation. */
+}
+
+void
+scorep_mpi_rma_request_finalize( void )
+{
+    for ( uint32_t bucket = 0; bucket < WINDOW_BUCKETS; bucket++ )
+    {
+        UTILS_MutexLock( &window_buckets[ bucket ].lock );
+        while ( window_buckets[ bucket ].windows )
         {
-            return 1;
+            rma_window* window = window_buckets[ bucket ].windows;
+            window_buckets[ bucket ].windows = window->next;
+
+            UTILS_MutexLock( &window->lock );
+            clear_window( window );
+            UTILS_MutexUnlock( &window->lock );
+            free( window->targets );
         }
+        UTILS_MutexUnlock( &window_buckets[ bucket ].lock );
     }
 
-    return 0;
+    /* The windows themselves live in the Score-P memory. */
+    UTILS_MutexLock( &free_windows_mutex );
+    while ( free_windows )
+    {
+        free( free_windows->targets );
+        free_windows = free_windows->next;
+    }
+    UTILS_MutexUnlock( &free_windows_mutex );
 }
 
+void
+scorep_mpi_rma_request_free_window( SCOREP_RmaWindowHandle window )
+{
+    uint32_t bucket = hash_window( window );
+
+    UTILS_MutexLock( &window_buckets[ bucket ].lock );
+    rma_window** it = &window_buckets[ bucket ].windows;
+    while ( *it && ( *it )->handle != window )
+    {
+        it = &( *it )->next;
+    }
+    rma_window* found = *it;
+    if ( found )
+    {
+        *it = found->next;
+    }
+    UTILS_MutexUnlock( &window_buckets[ bucket ].lock );
+
+    if ( !found )
+    {
+        return;
+    }
+
+    UTILS_MutexLock( &found->lock );
+    clear_window( found );
+    UTILS_MutexUnlock( &found->lock );
+
+    UTILS_MutexLock( &free_windows_mutex );
+    found->next  = free_windows;
+    free_windows = found;
+    UTILS_MutexUnlock( &free_windows_mutex );
+}
 
 scorep_mpi_rma_request*
 scorep_mpi_rma_request_create( SCOREP_RmaWindowHandle       window,
@@ -195,19 +521,34 @@ scorep_mpi_rma_request_create( SCOREP_RmaWindowHandle       window,
 {
     UTILS_DEBUG_ENTRY();
 
-    scorep_mpi_rma_request_node* new_node =
-        scorep_mpi_rma_request_create_node( rma_requests );
+    rma_window* tracking = get_window( window, true );
+
+    UTILS_MutexLock( &tracking->lock );
+
+    rma_request_node* new_node = tracking->free_nodes;
+    if ( new_node )
+    {
+        tracking->free_nodes = new_node->next;
+    }
+    else
+    {
+        new_node = SCOREP_Memory_AllocForMisc( sizeof( *new_node ) );
+    }
 
     // Set values for element
-    new_node->payload.window          = window;
-    new_node->payload.target          = target;
-    new_node->payload.mpi_handle      = mpi_handle,
-    new_node->payload.completion_type = completion_type;
-    new_node->payload.matching_id     = matching_id;
+    new_node->payload.window            = window;
+    new_node->payload.target            = target;
+    new_node->payload.mpi_handle        = mpi_handle,
+    new_node->payload.completion_type   = completion_type;
+    new_node->payload.matching_id       = matching_id;
+    new_node->payload.completed_locally = false;
+    new_node->payload.schedule_removal  = false;
+
+    print_payload( "New", &new_node->payload );
 
-    scorep_mpi_rma_request_print_list_node( "New", new_node );
+    add_node( get_target( tracking, target ), new_node );
 
-    scorep_mpi_rma_request_insert_node( rma_requests, new_node );
+    UTILS_MutexUnlock( &tracking->lock );
 
     UTILS_DEBUG_EXIT();
 
@@ -222,31 +563,19 @@ scorep_mpi_rma_request_find( SCOREP_RmaWindowHandle       window,
 {
     UTILS_DEBUG_ENTRY();
 
-    scorep_mpi_rma_request search_info;
-    scorep_mpi_rma_request_reset_payload( &search_info );
-
-    search_info.window          = window;
-    search_info.target          = target;
-    search_info.mpi_handle      = mpiHandle;
-    search_info.completion_type = completionType;
-
-    scorep_mpi_rma_request_print_payload( "Search", &search_info );
-
-    scorep_mpi_rma_request_node* list_element =
-        scorep_mpi_rma_request_lower_bound( rma_requests, &search_info );
-
-    scorep_mpi_rma_request_print_list_node( "Found", list_element );
-
-    if ( scorep_mpi_rma_request_cmp( &( list_element->payload ), &search_info ) == 0 )
-    {
-        UTILS_DEBUG_EXIT();
-        return &( list_element->payload );
-    }
-    else
+    rma_window* tracking = get_window( window, false );
+    if ( !tracking )
     {
         UTILS_DEBUG_EXIT();
         return NULL;
     }
+
+    UTILS_MutexLock( &tracking->lock );
+    rma_request_node* node = find_node( tracking, target, mpiHandle, completionType );
+    UTILS_MutexUnlock( &tracking->lock );
+
+    UTILS_DEBUG_EXIT();
+    return node ? &( node->payload ) : NULL;
 }
 
 
@@ -258,29 +587,24 @@ scorep_mpi_rma_request_remove( SCOREP_RmaWindowHandle       window,
 {
     UTILS_DEBUG_ENTRY();
 
-    scorep_mpi_rma_request search_info;
-    scorep_mpi_rma_request_reset_payload( &search_info );
-
-    search_info.window          = window;
-    search_info.target          = target;
-    search_info.mpi_handle      = mpiHandle;
-    search_info.completion_type = completionType;
-
-    scorep_mpi_rma_request_print_payload( "Search", &search_info );
-
-    scorep_mpi_rma_request_node* element =
-        scorep_mpi_rma_request_lower_bound( rma_requests, &search_info );
-
-    scorep_mpi_rma_request_print_list_node( "Lower bound", element );
+    rma_window*       tracking = get_window( window, false );
+    rma_request_node* node     = NULL;
+    if ( tracking )
+    {
+        UTILS_MutexLock( &tracking->lock );
+        node = find_node( tracking, target, mpiHandle, completionType );
+        if ( node )
+        {
+            remove_node( node );
+        }
+        UTILS_MutexUnlock( &tracking->lock );
+    }
 
-    if ( scorep_mpi_rma_request_cmp( &( element->payload ), &search_info ) != 0 )
+    if ( !node )
     {
         UTILS_WARNING( "Unable to find RMA request to remove." );
-        return;
     }
 
-    scorep_mpi_rma_request_remove_node( rma_requests, element );
-
     UTILS_DEBUG_EXIT();
 }
 
@@ -288,9 +612,22 @@ void
 scorep_mpi_rma_request_remove_by_ptr( scorep_mpi_rma_request* request )
 {
     // The starting address of the request payload is the same as for the node.
-    // Thus we can cast the pointer and call scorep_mpi_rma_request_remove_node().
+    rma_request_node* node = ( rma_request_node* )request;
 
-    scorep_mpi_rma_request_remove_node( rma_requests, ( scorep_mpi_rma_request_node* )request );
+    /* node->target may only be read under the lock of the window. */
+    rma_window* window = get_window( request->window, false );
+    if ( !window )
+    {
+        /* Already removed when its window was freed */
+        return;
+    }
+
+    UTILS_MutexLock( &window->lock );
+    if ( node->target && node->target->window == window )
+    {
+        remove_node( node );
+    }
+    UTILS_MutexUnlock( &window->lock );
 }
 
 void
@@ -299,44 +636,23 @@ scorep_mpi_rma_request_foreach_on_window( SCOREP_RmaWindowHandle     window,
 {
     UTILS_DEBUG_ENTRY();
 
-    scorep_mpi_rma_request search_info;
-    scorep_mpi_rma_request_reset_payload( &search_info );
-
-    search_info.window = window;
-
-    scorep_mpi_rma_request_print_payload( "Search", &search_info );
-
-    scorep_mpi_rma_request_node* list_element =
-        scorep_mpi_rma_request_lower_bound( rma_requests, &search_info );
-
-    scorep_mpi_rma_request_print_list_node( "Lower bound", list_element );
-
-    if ( list_element != NULL
-         && list_element->payload.window != search_info.window
-         && list_element->next[ 0 ]
-         && list_element->next[ 0 ]->payload.window == search_info.window )
+    rma_window* tracking = get_window( window, false );
+    if ( !tracking )
     {
-        list_element = list_element->next[ 0 ];
+        UTILS_DEBUG_EXIT();
+        return;
     }
 
-    while ( list_element != NULL
-            && list_element->payload.window == window )
+    UTILS_MutexLock( &tracking->lock );
+    rma_target* target = tracking->pending_targets;
+    while ( target )
     {
-        scorep_mpi_rma_request_print_list_node( "Processing", list_element );
-
-        ( *callback )( &( list_element->payload ) );
-        if ( list_element->payload.schedule_removal )
-        {
-            scorep_mpi_rma_request_print_list_node( "Removing", list_element );
-            scorep_mpi_rma_request_node* removal_candidate = list_element;
-            list_element = list_element->next[ 0 ];
-            scorep_mpi_rma_request_remove_node( rma_requests, removal_candidate );
-        }
-        else
-        {
-            list_element = list_element->next[ 0 ];
-        }
+        /* The target leaves the list if all its requests are removed. */
+        rma_target* next = target->pending_next;
+        foreach_on_target( target, callback );
+        target = next;
     }
+    UTILS_MutexUnlock( &tracking->lock );
 
     UTILS_DEBUG_EXIT();
 }
@@ -348,46 +664,20 @@ scorep_mpi_rma_request_foreach_to_target( SCOREP_RmaWindowHandle     window,
 {
     UTILS_DEBUG_ENTRY();
 
-    scorep_mpi_rma_request search_info;
-    scorep_mpi_rma_request_reset_payload( &search_info );
-
-    search_info.window = window;
-    search_info.target = target;
-
-    scorep_mpi_rma_request_print_payload( "Search", &search_info );
-
-    scorep_mpi_rma_request_node* list_element =
-        scorep_mpi_rma_request_lower_bound( rma_requests, &search_info );
-
-    scorep_mpi_rma_request_print_list_node( "Lower bound", list_element );
-
-    if ( list_element != NULL
-         && list_element->payload.window != search_info.window
-         && list_element->next[ 0 ]
-         && list_element->next[ 0 ]->payload.window == search_info.window )
+    rma_window* tracking = get_window( window, false );
+    if ( !tracking )
     {
-        list_element = list_element->next[ 0 ];
+        UTILS_DEBUG_EXIT();
+        return;
     }
 
-    while ( list_element != NULL
-            && list_element->payload.window == window
-            && list_element->payload.target == target )
+    UTILS_MutexLock( &tracking->lock );
+    rma_target* pending = find_target( tracking, target );
+    if ( pending )
     {
-        scorep_mpi_rma_request_print_list_node( "Processing", list_element );
-
-        ( *callback )( &( list_element->payload ) );
-        if ( list_element->payload.schedule_removal )
-        {
-            scorep_mpi_rma_request_print_list_node( "Removing", list_element );
-            scorep_mpi_rma_request_node* removal_candidate = list_element;
-            list_element = list_element->next[ 0 ];
-            scorep_mpi_rma_request_remove_node( rma_requests, removal_candidate );
-        }
-        else
-        {
-            list_element = list_element->next[ 0 ];
-        }
+        foreach_on_target( pending, callback );
     }
+    UTILS_MutexUnlock( &tracking->lock );
 
     UTILS_DEBUG_EXIT();
 }
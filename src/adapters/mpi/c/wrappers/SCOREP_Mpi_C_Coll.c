@@ -106,12 +106,15 @@ MPI_Allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allgather( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allgather( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLGATHER ] );
             SCOREP_MpiCollectiveBegin();
@@ -130,7 +133,7 @@ MPI_Allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLGATHER,
                                      sendbytes,
@@ -145,6 +148,13 @@ MPI_Allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLGATHER );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -182,12 +192,15 @@ MPI_Allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLGATHERV ] );
             SCOREP_MpiCollectiveBegin();
@@ -206,7 +219,7 @@ MPI_Allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLGATHERV,
                                      sendbytes,
@@ -221,6 +234,13 @@ MPI_Allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLGATHERV );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -256,12 +276,15 @@ MPI_Allreduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MP
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allreduce( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allreduce( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLREDUCE ] );
             SCOREP_MpiCollectiveBegin();
@@ -280,7 +303,7 @@ MPI_Allreduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MP
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLREDUCE,
                                      sendbytes,
@@ -295,6 +318,13 @@ MPI_Allreduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MP
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLREDUCE );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -331,12 +361,15 @@ MPI_Alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoall( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoall( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLTOALL ] );
             SCOREP_MpiCollectiveBegin();
@@ -355,7 +388,7 @@ MPI_Alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLTOALL,
                                      sendbytes,
@@ -370,6 +403,13 @@ MPI_Alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLTOALL );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -408,12 +448,15 @@ MPI_Alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLTOALLV ] );
             SCOREP_MpiCollectiveBegin();
@@ -432,7 +475,7 @@ MPI_Alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* s
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLTOALLV,
                                      sendbytes,
@@ -447,6 +490,13 @@ MPI_Alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* s
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLTOALLV );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -485,12 +535,15 @@ MPI_Alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int se
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ALLTOALLW ] );
             SCOREP_MpiCollectiveBegin();
@@ -509,7 +562,7 @@ MPI_Alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int se
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_ALLTOALLW,
                                      sendbytes,
@@ -524,6 +577,13 @@ MPI_Alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int se
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_ALLTOALLW );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -554,12 +614,15 @@ MPI_Barrier( MPI_Comm comm )
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_barrier( comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_barrier( comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_BARRIER ] );
             SCOREP_MpiCollectiveBegin();
@@ -578,7 +641,7 @@ MPI_Barrier( MPI_Comm comm )
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_BARRIER,
                                      sendbytes,
@@ -593,6 +656,13 @@ MPI_Barrier( MPI_Comm comm )
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_BARRIER );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -627,12 +697,15 @@ MPI_Bcast( void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm co
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_bcast( count, datatype, root, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_bcast( count, datatype, root, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_BCAST ] );
             SCOREP_MpiCollectiveBegin();
@@ -651,7 +724,7 @@ MPI_Bcast( void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm co
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_BCAST,
                                      sendbytes,
@@ -666,6 +739,13 @@ MPI_Bcast( void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm co
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_BCAST );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -701,12 +781,15 @@ MPI_Exscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_exscan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_exscan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_EXSCAN ] );
             SCOREP_MpiCollectiveBegin();
@@ -725,7 +808,7 @@ MPI_Exscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_EXSCAN,
                                      sendbytes,
@@ -740,6 +823,13 @@ MPI_Exscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_EXSCAN );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -777,12 +867,15 @@ MPI_Gather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype sen
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_gather( sendcount, sendtype, recvcount, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_gather( sendcount, sendtype, recvcount, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_GATHER ] );
             SCOREP_MpiCollectiveBegin();
@@ -801,7 +894,7 @@ MPI_Gather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype sen
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_GATHER,
                                      sendbytes,
@@ -816,6 +909,13 @@ MPI_Gather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype sen
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_GATHER );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -854,12 +954,15 @@ MPI_Gatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_gatherv( sendcount, sendtype, recvcounts, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_gatherv( sendcount, sendtype, recvcounts, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_GATHERV ] );
             SCOREP_MpiCollectiveBegin();
@@ -878,7 +981,7 @@ MPI_Gatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_GATHERV,
                                      sendbytes,
@@ -893,6 +996,13 @@ MPI_Gatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_GATHERV );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -929,12 +1039,15 @@ MPI_Reduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce( count, datatype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce( count, datatype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_REDUCE ] );
             SCOREP_MpiCollectiveBegin();
@@ -953,7 +1066,7 @@ MPI_Reduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_REDUCE,
                                      sendbytes,
@@ -968,6 +1081,13 @@ MPI_Reduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_D
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_REDUCE );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1003,12 +1123,15 @@ MPI_Reduce_scatter( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, SCOREP_M
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce_scatter( recvcounts, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce_scatter( recvcounts, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_REDUCE_SCATTER ] );
             SCOREP_MpiCollectiveBegin();
@@ -1027,7 +1150,7 @@ MPI_Reduce_scatter( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, SCOREP_M
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_REDUCE_SCATTER,
                                      sendbytes,
@@ -1042,6 +1165,13 @@ MPI_Reduce_scatter( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, SCOREP_M
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_REDUCE_SCATTER );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1077,12 +1207,15 @@ MPI_Reduce_scatter_block( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, in
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce_scatter_block( recvcount, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce_scatter_block( recvcount, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_REDUCE_SCATTER_BLOCK ] );
             SCOREP_MpiCollectiveBegin();
@@ -1101,7 +1234,7 @@ MPI_Reduce_scatter_block( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, in
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_REDUCE_SCATTER_BLOCK,
                                      sendbytes,
@@ -1116,6 +1249,13 @@ MPI_Reduce_scatter_block( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, in
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_REDUCE_SCATTER_BLOCK );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1151,12 +1291,15 @@ MPI_Scan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_Dat
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_SCAN ] );
             SCOREP_MpiCollectiveBegin();
@@ -1175,7 +1318,7 @@ MPI_Scan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_Dat
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_SCAN,
                                      sendbytes,
@@ -1190,6 +1333,13 @@ MPI_Scan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_Dat
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_SCAN );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1227,12 +1377,15 @@ MPI_Scatter( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scatter( sendcount, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scatter( sendcount, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_SCATTER ] );
             SCOREP_MpiCollectiveBegin();
@@ -1251,7 +1404,7 @@ MPI_Scatter( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_SCATTER,
                                      sendbytes,
@@ -1266,6 +1419,13 @@ MPI_Scatter( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_SCATTER );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1304,12 +1464,15 @@ MPI_Scatterv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* se
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scatterv( sendcounts, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scatterv( sendcounts, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_SCATTERV ] );
             SCOREP_MpiCollectiveBegin();
@@ -1328,7 +1491,7 @@ MPI_Scatterv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* se
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      scorep_mpi_get_scorep_mpi_rank( root ),
                                      SCOREP_MPI_COLLECTIVE__MPI_SCATTERV,
                                      sendbytes,
@@ -1343,6 +1506,13 @@ MPI_Scatterv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* se
         SCOREP_MPI_EVENT_GEN_ON();
     }
 
+    /* Outside of the collective region, the resynchronization must not be
+       attributed to the application's collective */
+    if ( comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS )
+    {
+        SCOREP_ResynchronizeClocks( SCOREP_MPI_COLLECTIVE__MPI_SCATTERV );
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
     return return_val;
 }
@@ -1382,13 +1552,16 @@ MPI_Iallgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allgather( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allgather( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLGATHER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1410,7 +1583,7 @@ MPI_Iallgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLGATHER,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLGATHER ] );
         }
@@ -1461,13 +1634,16 @@ MPI_Iallgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatyp
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLGATHERV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1489,7 +1665,7 @@ MPI_Iallgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatyp
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLGATHERV,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLGATHERV ] );
         }
@@ -1538,13 +1714,16 @@ MPI_Iallreduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, M
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_allreduce( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_allreduce( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLREDUCE ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1566,7 +1745,7 @@ MPI_Iallreduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, M
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLREDUCE,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLREDUCE ] );
         }
@@ -1616,13 +1795,16 @@ MPI_Ialltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoall( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoall( sendcount, sendtype, recvcount, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALL ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1644,7 +1826,7 @@ MPI_Ialltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLTOALL,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALL ] );
         }
@@ -1696,13 +1878,16 @@ MPI_Ialltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int*
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype, recvcounts, recvtype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALLV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1724,7 +1909,7 @@ MPI_Ialltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int*
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLTOALLV,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALLV ] );
         }
@@ -1776,13 +1961,16 @@ MPI_Ialltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALLW ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1804,7 +1992,7 @@ MPI_Ialltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int s
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IALLTOALLW,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IALLTOALLW ] );
         }
@@ -1848,13 +2036,16 @@ MPI_Ibarrier( MPI_Comm comm, MPI_Request* request )
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_barrier( comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_barrier( comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IBARRIER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1876,7 +2067,7 @@ MPI_Ibarrier( MPI_Comm comm, MPI_Request* request )
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IBARRIER,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IBARRIER ] );
         }
@@ -1924,13 +2115,16 @@ MPI_Ibcast( void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm c
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_bcast( count, datatype, root, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_bcast( count, datatype, root, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IBCAST ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1952,7 +2146,7 @@ MPI_Ibcast( void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm c
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IBCAST,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IBCAST ] );
         }
@@ -2001,13 +2195,16 @@ MPI_Iexscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_exscan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_exscan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IEXSCAN ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2029,7 +2226,7 @@ MPI_Iexscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IEXSCAN,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IEXSCAN ] );
         }
@@ -2080,13 +2277,16 @@ MPI_Igather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_gather( sendcount, sendtype, recvcount, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_gather( sendcount, sendtype, recvcount, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IGATHER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2108,7 +2308,7 @@ MPI_Igather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype se
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IGATHER,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IGATHER ] );
         }
@@ -2160,13 +2360,16 @@ MPI_Igatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_gatherv( sendcount, sendtype, recvcounts, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_gatherv( sendcount, sendtype, recvcounts, recvtype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IGATHERV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2188,7 +2391,7 @@ MPI_Igatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IGATHERV,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IGATHERV ] );
         }
@@ -2238,13 +2441,16 @@ MPI_Ireduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce( count, datatype, root, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce( count, datatype, root, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2266,7 +2472,7 @@ MPI_Ireduce( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IREDUCE,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE ] );
         }
@@ -2315,13 +2521,16 @@ MPI_Ireduce_scatter( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, SCOREP_
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce_scatter( recvcounts, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce_scatter( recvcounts, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE_SCATTER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2343,7 +2552,7 @@ MPI_Ireduce_scatter( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, SCOREP_
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IREDUCE_SCATTER,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE_SCATTER ] );
         }
@@ -2392,13 +2601,16 @@ MPI_Ireduce_scatter_block( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, i
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_reduce_scatter_block( recvcount, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_reduce_scatter_block( recvcount, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE_SCATTER_BLOCK ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2420,7 +2632,7 @@ MPI_Ireduce_scatter_block( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, i
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_IREDUCE_SCATTER_BLOCK,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_IREDUCE_SCATTER_BLOCK ] );
         }
@@ -2469,13 +2681,16 @@ MPI_Iscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_Da
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scan( count, datatype, ( sendbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCAN ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2497,7 +2712,7 @@ MPI_Iscan( SCOREP_MPI_CONST_DECL void* sendbuf, void* recvbuf, int count, MPI_Da
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_ISCAN,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCAN ] );
         }
@@ -2548,13 +2763,16 @@ MPI_Iscatter( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scatter( sendcount, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scatter( sendcount, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCATTER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2576,7 +2794,7 @@ MPI_Iscatter( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_Datatype s
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_ISCATTER,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCATTER ] );
         }
@@ -2628,13 +2846,16 @@ MPI_Iscatterv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* s
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_scatterv( sendcounts, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_scatterv( sendcounts, sendtype, recvcount, recvtype, root, ( recvbuf == MPI_IN_PLACE ), comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCATTERV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -2656,7 +2877,7 @@ MPI_Iscatterv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DECL int* s
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_ISCATTERV,
-                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm, reqid );
+                                                 scorep_mpi_get_scorep_mpi_rank( root ), sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_ISCATTERV ] );
         }
@@ -527,12 +527,15 @@ MPI_Neighbor_allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_NEIGHBOR_ALLGATHER ] );
             SCOREP_MpiCollectiveBegin();
@@ -551,7 +554,7 @@ MPI_Neighbor_allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_NEIGHBOR_ALLGATHER,
                                      sendbytes,
@@ -603,12 +606,15 @@ MPI_Neighbor_allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_NEIGHBOR_ALLGATHERV ] );
             SCOREP_MpiCollectiveBegin();
@@ -627,7 +633,7 @@ MPI_Neighbor_allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_NEIGHBOR_ALLGATHERV,
                                      sendbytes,
@@ -678,12 +684,15 @@ MPI_Neighbor_alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_D
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_NEIGHBOR_ALLTOALL ] );
             SCOREP_MpiCollectiveBegin();
@@ -702,7 +711,7 @@ MPI_Neighbor_alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_D
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_NEIGHBOR_ALLTOALL,
                                      sendbytes,
@@ -755,12 +764,15 @@ MPI_Neighbor_alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DE
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_NEIGHBOR_ALLTOALLV ] );
             SCOREP_MpiCollectiveBegin();
@@ -779,7 +791,7 @@ MPI_Neighbor_alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DE
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_NEIGHBOR_ALLTOALLV,
                                      sendbytes,
@@ -832,12 +844,15 @@ MPI_Neighbor_alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DE
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_NEIGHBOR_ALLTOALLW ] );
             SCOREP_MpiCollectiveBegin();
@@ -856,7 +871,7 @@ MPI_Neighbor_alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_DE
     {
         if ( event_gen_active_for_group )
         {
-            SCOREP_MpiCollectiveEnd( SCOREP_MPI_COMM_HANDLE( comm ),
+            SCOREP_MpiCollectiveEnd( comm_handle,
                                      SCOREP_INVALID_ROOT_RANK,
                                      SCOREP_MPI_COLLECTIVE__MPI_NEIGHBOR_ALLTOALLW,
                                      sendbytes,
@@ -909,13 +924,16 @@ MPI_Ineighbor_allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLGATHER ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -937,7 +955,7 @@ MPI_Ineighbor_allgather( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_INEIGHBOR_ALLGATHER,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLGATHER ] );
         }
@@ -988,13 +1006,16 @@ MPI_Ineighbor_allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MP
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLGATHERV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1016,7 +1037,7 @@ MPI_Ineighbor_allgatherv( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MP
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_INEIGHBOR_ALLGATHERV,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLGATHERV ] );
         }
@@ -1066,13 +1087,16 @@ MPI_Ineighbor_alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALL ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1094,7 +1118,7 @@ MPI_Ineighbor_alltoall( SCOREP_MPI_CONST_DECL void* sendbuf, int sendcount, MPI_
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_INEIGHBOR_ALLTOALL,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALL ] );
         }
@@ -1146,13 +1170,16 @@ MPI_Ineighbor_alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_D
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALLV ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1174,7 +1201,7 @@ MPI_Ineighbor_alltoallv( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_D
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_INEIGHBOR_ALLTOALLV,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALLV ] );
         }
@@ -1226,13 +1253,16 @@ MPI_Ineighbor_alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_D
 
     uint64_t sendbytes = 0, recvbytes = 0;
 
+    SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
     if ( event_gen_active )
     {
         reqid = scorep_mpi_get_request_id();
         SCOREP_MPI_EVENT_GEN_OFF();
         if ( event_gen_active_for_group )
         {
-            scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, &sendbytes, &recvbytes );
+            comm_handle = SCOREP_MPI_COMM_HANDLE( comm );
+            scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes );
 
             SCOREP_EnterWrappedRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALLW ] );
             SCOREP_MpiNonBlockingCollectiveRequest( reqid );
@@ -1254,7 +1284,7 @@ MPI_Ineighbor_alltoallw( SCOREP_MPI_CONST_DECL void* sendbuf, SCOREP_MPI_CONST_D
             if ( return_val == MPI_SUCCESS )
             {
                 scorep_mpi_request_icoll_create( *request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__MPI_INEIGHBOR_ALLTOALLW,
-                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm, reqid );
+                                                 SCOREP_INVALID_ROOT_RANK, sendbytes, recvbytes, comm_handle, reqid );
             }
             SCOREP_ExitRegion( scorep_mpi_regions[ SCOREP_MPI_REGION__MPI_INEIGHBOR_ALLTOALLW ] );
         }
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2025,
+ * Copyright (c) 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -13,6 +13,8 @@
  * Functions to be called from Fortran (scorep_mpi_coll_h.F90) via the bind(c) interface
  * 1. convert F90 integer handles to C handle types ( via e.g. PMPI_Comm_f2c )
  * 2. call the C implementation
+ * No communicator definition payload is passed, the properties of the
+ * communicator are queried from MPI.
  */
 
 void
@@ -21,6 +23,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_barrier_fromF08 )( MPI_Fint* comm,
                                                     uint64_t* recvbytes )
 {
     COUNT_FUN( scorep_mpi_coll_bytes_barrier )( PMPI_Comm_f2c( *comm ),
+                                                NULL,
                                                 sendbytes,
                                                 recvbytes );
 }
@@ -44,6 +47,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_gather_fromF08 )(  const COUNT_T*  sendcount,
                                                *root,
                                                *inplace,
                                                PMPI_Comm_f2c( *comm ),
+                                               NULL,
                                                sendbytes,
                                                recvbytes );
 }
@@ -62,6 +66,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_fromF08 )( const COUNT_T*  count,
                                                *root,
                                                *inplace,
                                                PMPI_Comm_f2c( *comm ),
+                                               NULL,
                                                sendbytes,
                                                recvbytes );
 }
@@ -84,6 +89,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_gatherv_fromF08 )( const COUNT_T*  sendcount,
                                                 *root,
                                                 *inplace,
                                                 PMPI_Comm_f2c( *comm ),
+                                                NULL,
                                                 sendbytes,
                                                 recvbytes );
 }
@@ -100,6 +106,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_bcast_fromF08 )( const COUNT_T*  count,
                                               PMPI_Type_f2c( *datatype ),
                                               *root,
                                               PMPI_Comm_f2c( *comm ),
+                                              NULL,
                                               sendbytes,
                                               recvbytes );
 }
@@ -122,6 +129,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_scatter_fromF08 )(  const COUNT_T*  sendcount,
                                                 *root,
                                                 *inplace,
                                                 PMPI_Comm_f2c( *comm ),
+                                                NULL,
                                                 sendbytes,
                                                 recvbytes );
 }
@@ -144,6 +152,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_scatterv_fromF08 )( const COUNT_T*  sendcounts,
                                                  *root,
                                                  *inplace,
                                                  PMPI_Comm_f2c( *comm ),
+                                                 NULL,
                                                  sendbytes,
                                                  recvbytes );
 }
@@ -164,6 +173,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoall_fromF08 )( const COUNT_T*  sendcount,
                                                  PMPI_Type_f2c( *recvtype ),
                                                  *inplace,
                                                  PMPI_Comm_f2c( *comm ),
+                                                 NULL,
                                                  sendbytes,
                                                  recvbytes );
 }
@@ -184,6 +194,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoallv_fromF08 )( const COUNT_T*  sendcounts
                                                   PMPI_Type_f2c( *recvtype ),
                                                   *inplace,
                                                   PMPI_Comm_f2c( *comm ),
+                                                  NULL,
                                                   sendbytes,
                                                   recvbytes );
 }
@@ -222,6 +233,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_alltoallw_fromF08 )( const COUNT_T*  sendcounts
                                                   recvtypes_c,
                                                   *inplace,
                                                   PMPI_Comm_f2c( *comm ),
+                                                  NULL,
                                                   sendbytes,
                                                   recvbytes );
 }
@@ -242,6 +254,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_allgather_fromF08 )( const COUNT_T*  sendcount,
                                                   PMPI_Type_f2c( *recvtype ),
                                                   *inplace,
                                                   PMPI_Comm_f2c( *comm ),
+                                                  NULL,
                                                   sendbytes,
                                                   recvbytes );
 }
@@ -262,6 +275,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_allgatherv_fromF08 )( const COUNT_T*  sendcount
                                                    PMPI_Type_f2c( *recvtype ),
                                                    *inplace,
                                                    PMPI_Comm_f2c( *comm ),
+                                                   NULL,
                                                    sendbytes,
                                                    recvbytes );
 }
@@ -279,6 +293,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_allreduce_fromF08 )( const COUNT_T*  count,
                                                   PMPI_Type_f2c( *datatype ),
                                                   *inplace,
                                                   PMPI_Comm_f2c( *comm ),
+                                                  NULL,
                                                   sendbytes,
                                                   recvbytes );
 }
@@ -295,6 +310,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter_block_fromF08 )( const COUNT_T*
                                                              PMPI_Type_f2c( *datatype ),
                                                              *inplace,
                                                              PMPI_Comm_f2c( *comm ),
+                                                             NULL,
                                                              sendbytes,
                                                              recvbytes );
 }
@@ -311,6 +327,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_reduce_scatter_fromF08 )( const COUNT_T*  recvc
                                                        PMPI_Type_f2c( *datatype ),
                                                        *inplace,
                                                        PMPI_Comm_f2c( *comm ),
+                                                       NULL,
                                                        sendbytes,
                                                        recvbytes );
 }
@@ -327,6 +344,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_scan_fromF08 )( const COUNT_T*  count,
                                              PMPI_Type_f2c( *datatype ),
                                              *inplace,
                                              PMPI_Comm_f2c( *comm ),
+                                             NULL,
                                              sendbytes,
                                              recvbytes );
 }
@@ -343,6 +361,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_exscan_fromF08 )( const COUNT_T*  count,
                                                PMPI_Type_f2c( *datatype ),
                                                *inplace,
                                                PMPI_Comm_f2c( *comm ),
+                                               NULL,
                                                sendbytes,
                                                recvbytes );
 }
@@ -362,6 +381,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoall_fromF08 )( const COUNT_T*  se
                                                           *recvcount,
                                                           PMPI_Type_f2c( *recvtype ),
                                                           PMPI_Comm_f2c( *comm ),
+                                                          NULL,
                                                           sendbytes,
                                                           recvbytes );
 }
@@ -380,6 +400,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallv_fromF08 )( const COUNT_T*  s
                                                            recvcounts,
                                                            PMPI_Type_f2c( *recvtype ),
                                                            PMPI_Comm_f2c( *comm ),
+                                                           NULL,
                                                            sendbytes,
                                                            recvbytes );
 }
@@ -396,7 +417,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw_fromF08 )( const COUNT_T*  s
 {
     int indegree  = 0;
     int outdegree = 0;
-    scorep_mpi_topo_num_neighbors( PMPI_Comm_f2c( *comm ), &indegree, &outdegree );
+    scorep_mpi_topo_num_neighbors( PMPI_Comm_f2c( *comm ), NULL, &indegree, &outdegree );
     /* TODO:
      * make these global arrays (allocated with SCOREP_AllocForMisc) and grow * them similar to the arrays in request_mgmt */
     /* TODO:
@@ -418,6 +439,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_alltoallw_fromF08 )( const COUNT_T*  s
                                                            recvcounts,
                                                            recvtypes_c,
                                                            PMPI_Comm_f2c( *comm ),
+                                                           NULL,
                                                            sendbytes,
                                                            recvbytes );
 }
@@ -436,6 +458,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgather_fromF08 )( const COUNT_T*  s
                                                            *recvcount,
                                                            PMPI_Type_f2c( *recvtype ),
                                                            PMPI_Comm_f2c( *comm ),
+                                                           NULL,
                                                            sendbytes,
                                                            recvbytes );
 }
@@ -454,6 +477,7 @@ COUNT_FUN( scorep_mpi_coll_bytes_neighbor_allgatherv_fromF08 )( const COUNT_T*
                                                             recvcounts,
                                                             PMPI_Type_f2c( *recvtype ),
                                                             PMPI_Comm_f2c( *comm ),
+                                                            NULL,
                                                             sendbytes,
                                                             recvbytes );
 }
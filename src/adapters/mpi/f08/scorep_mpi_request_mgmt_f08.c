@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2025,
+ * Copyright (c) 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -15,6 +15,7 @@
 #include <UTILS_Error.h>
 
 #include <scorep_mpi_c.h>
+#include <scorep_mpi_communicator_mgmt.h>
 #include <scorep_mpi_rma_request.h>
 #include <scorep_mpi_request_mgmt.h>
 
@@ -81,7 +82,7 @@ scorep_mpi_request_icoll_create_fromF08( MPI_Fint*                request,
         *rootLoc,
         *bytesSent,
         *bytesRecv,
-        PMPI_Comm_f2c( *comm ),
+        SCOREP_MPI_COMM_HANDLE( PMPI_Comm_f2c( *comm ) ),
         *id
         );
 }
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022, 2025,
+ * Copyright (c) 2022, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -20,10 +20,37 @@
    @brief Computations of sent and received bytes for collective communication patterns
  */
 
+#include <scorep_mpi_communicator_mgmt.h>
+
 #include <stdint.h>
 #include <mpi.h>
 
 
+/*
+ * Caches the sizes of common predefined datatypes. Called once at
+ * initialization of the communicator management.
+ */
+void
+scorep_mpi_coll_init( void );
+
+
+/*
+ * Determine the topology of a communicator and the number of sources and
+ * destinations of neighborhood collectives.
+ *
+ * For cartesian topologies, these are 2*ndims, i.e., neighbors for which
+ * MPI_Cart_shift would return MPI_PROC_NULL are included. ndims is zero for
+ * all other topologies.
+ */
+void
+scorep_mpi_topo_get( MPI_Comm comm,
+                     int      localRank,
+                     int*     topology,
+                     int*     indegree,
+                     int*     outdegree,
+                     int*     ndims );
+
+
 /*
  * Count the number of ingoing and outgoing edges in the topology associated with
  * comm.
@@ -33,52 +60,24 @@
  *
  * For cartesian topologies, this is always 2*#dimensions, i.e., neighbors for
  * which MPI_Cart_shift would return MPI_PROC_NULL are included.
+ *
+ * The numbers are read from commPayload, the definition payload of comm. If
+ * it is NULL, they are queried from MPI.
  */
-static inline void
-scorep_mpi_topo_num_neighbors( MPI_Comm comm, int* indegree, int* outdegree )
-{
-    int topo_type = MPI_UNDEFINED;
-    PMPI_Topo_test( comm, &topo_type );
-
-    switch ( topo_type )
-    {
-        case MPI_GRAPH:
-        {
-            int rank, neighbors;
-            PMPI_Comm_rank( comm, &rank );
-            PMPI_Graph_neighbors_count( comm, rank, &neighbors );
-            *indegree  = neighbors;
-            *outdegree = neighbors;
-            break;
-        }
-        case MPI_CART:
-        {
-            int ndims;
-            PMPI_Cartdim_get( comm, &ndims );
-            *indegree  = 2 * ndims;
-            *outdegree = 2 * ndims;
-            break;
-        }
-        case MPI_DIST_GRAPH:
-        {
-            int weighted;
-            PMPI_Dist_graph_neighbors_count( comm, indegree, outdegree, &weighted );
-            break;
-        }
-        case MPI_UNDEFINED: /* fallthrough */
-        default:
-        {
-            indegree  = 0;
-            outdegree = 0;
-            break;
-        }
-    }
-}
+void
+scorep_mpi_topo_num_neighbors( MPI_Comm                                  comm,
+                               const scorep_mpi_comm_definition_payload* commPayload,
+                               int*                                      indegree,
+                               int*                                      outdegree );
 
 
 /*
  * Patterns for the non-blocking and persistent collectives are identical to the
  * standard ones.
+ *
+ * The properties of comm are read from commPayload, its definition payload.
+ * Callers pass NULL for communicators which are not tracked, the properties
+ * are then queried from MPI.
  */
 
 
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2013, 2017, 2022, 2025,
+ * Copyright (c) 2013, 2017, 2022, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2018,
@@ -109,6 +109,15 @@ typedef struct scorep_mpi_comm_definition_payload
     uint32_t global_root_rank;
     uint32_t root_id;
     uint32_t io_handle_counter;
+
+    /* Properties used by the byte calculations of collectives, determined
+     * once at the creation of the communicator. */
+    bool is_intercomm;
+    int  topology;           /**< Result of MPI_Topo_test */
+    int  indegree;           /**< Number of sources of neighborhood collectives */
+    int  outdegree;          /**< Number of destinations of neighborhood collectives */
+    int  num_cart_neighbors; /**< Number of non-null neighbors in a Cartesian topology */
+    int  cart_neighbors[];   /**< Their indices in the neighbor sequence */
 } scorep_mpi_comm_definition_payload;
 
 /**
@@ -212,6 +221,15 @@ scorep_mpi_comm_create_finalize( MPI_Comm                         comm,
 extern SCOREP_InterimCommunicatorHandle
 scorep_mpi_comm_handle( MPI_Comm comm );
 
+/**
+ * @internal
+ * @brief  Retrieves the definition payload of a communicator handle.
+ * @param  commHandle Internal SCOREP handle of an MPI communicator
+ * @return Payload of %commHandle, NULL for SCOREP_INVALID_INTERIM_COMMUNICATOR
+ */
+extern const scorep_mpi_comm_definition_payload*
+scorep_mpi_comm_payload( SCOREP_InterimCommunicatorHandle commHandle );
+
 /**
  * Initializes the window handling specific data structures.
  */
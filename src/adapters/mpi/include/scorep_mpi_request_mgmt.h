@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2017-2019, 2022, 2025,
+ * Copyright (c) 2009-2013, 2017-2019, 2022, 2025-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -211,18 +211,18 @@ scorep_mpi_request_p2p_create( MPI_Request             request,
  * @param rootLoc        Root location of collective operation
  * @param bytesSent      Number of bytes sent in request
  * @param bytesRecv      Number of bytes received in request
- * @param comm           MPI communicator handle
+ * @param commHandle     Score-P handle of the MPI communicator
  * @param id             Request id
  */
 void
-scorep_mpi_request_icoll_create( MPI_Request             request,
-                                 scorep_mpi_request_flag flags,
-                                 SCOREP_CollectiveType   collectiveType,
-                                 int                     rootLoc,
-                                 uint64_t                bytesSent,
-                                 uint64_t                bytesRecv,
-                                 MPI_Comm                comm,
-                                 SCOREP_MpiRequestId     id );
+scorep_mpi_request_icoll_create( MPI_Request                      request,
+                                 scorep_mpi_request_flag          flags,
+                                 SCOREP_CollectiveType            collectiveType,
+                                 int                              rootLoc,
+                                 uint64_t                         bytesSent,
+                                 uint64_t                         bytesRecv,
+                                 SCOREP_InterimCommunicatorHandle commHandle,
+                                 SCOREP_MpiRequestId              id );
 
 /**
  * @brief Create entry for a given MPI Comm_Idup request handle
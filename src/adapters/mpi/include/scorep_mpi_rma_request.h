@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2017, 2019,
+ * Copyright (c) 2017, 2019, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2019,
@@ -25,8 +25,9 @@
  * remote referencing only the window or window in combination with a target
  * rank. Therefore these special query support is needed.
  *
- * The data structure used here is a simple skip list that should have O(log N)
- * behavior with high probability.
+ * Requests are kept per window and target, each window with its own lock.
+ * Looking up the implicit request of a target and completing all requests of
+ * a window or target do not need to search.
  */
 
 #include <stdbool.h>
@@ -79,6 +80,13 @@ scorep_mpi_rma_request_init( void );
 void
 scorep_mpi_rma_request_finalize( void );
 
+/**
+ * @brief Stop tracking the requests of a window
+ * @param window RMA window handle
+ */
+void
+scorep_mpi_rma_request_free_window( SCOREP_RmaWindowHandle window );
+
 /**
  * @brief Create an RMA request entry
  * @param window RMA window handle
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022-2025,
+ * Copyright (c) 2022-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -135,6 +135,7 @@ typedef struct task_t
     SCOREP_RegionHandle region;
 
     struct task_t*      next;               /* free list handling */
+    struct task_t*      next_batch;         /* tasks_returned handling */
 } task_t;
 
 
@@ -194,6 +195,7 @@ typedef struct parallel_t
                                           by thread_num in task-create. */
 
     struct parallel_t* next;           /* free list */
+    struct parallel_t* next_batch;     /* parallel_regions_returned handling */
 } parallel_t;
 
 
@@ -267,13 +269,34 @@ static THREAD_LOCAL_STORAGE_SPECIFIER struct scorep_thread_private_data* tpd;
 static THREAD_LOCAL_STORAGE_SPECIFIER parallel_t* team_implicit_parallel;
 
 
-/* free list of parallel_t objects */
-static UTILS_Mutex parallel_regions_free_list_mutex = UTILS_MUTEX_INIT;
-static parallel_t* parallel_regions_free_list;
+/* Objects are returned to the thread-local free list of the thread that
+   releases them, which is often not the thread that requests them, e.g., a
+   parallel region is released by the last thread of the team, and explicit
+   tasks are completed by any thread of the team. To prevent the free lists of
+   requesting threads from running dry while others accumulate objects, a
+   thread hands over a batch of objects to a global lock-free stack, once its
+   free list holds twice the batch size. Threads with an empty free list take
+   all batches from this stack at once. Taking all batches with a single
+   atomic exchange is not subject to the ABA problem, in contrast to popping
+   single elements. */
+#define PARALLEL_REGIONS_BATCH_SIZE 8
+#define TASKS_BATCH_SIZE 64
+
+
+/* thread-local free list of parallel_t objects */
+static THREAD_LOCAL_STORAGE_SPECIFIER parallel_t* parallel_regions_free_list;
+static THREAD_LOCAL_STORAGE_SPECIFIER uint32_t    parallel_regions_free_list_size;
+
+/* Global stack of batches of parallel_t objects, linked via next_batch. */
+static parallel_t* parallel_regions_returned;
 
 
 /* thread-local free list of implicit and explicit task_t objects. */
-static THREAD_LOCAL_STORAGE_SPECIFIER task_t* tasks_free_list;
+static THREAD_LOCAL_STORAGE_SPECIFIER task_t*  tasks_free_list;
+static THREAD_LOCAL_STORAGE_SPECIFIER uint32_t tasks_free_list_size;
+
+/* Global stack of batches of task_t objects, linked via next_batch. */
+static task_t* tasks_returned;
 
 
 /* convenience */
@@ -378,17 +401,65 @@ complete_adapter_init( void )
 }
 
 
+/* Pushes the list of parallel_t objects starting at @a batch to
+   parallel_regions_returned. */
+static inline void
+return_parallel_regions( parallel_t* batch )
+{
+    parallel_t* top = UTILS_Atomic_LoadN_void_ptr( &parallel_regions_returned,
+                                                   UTILS_ATOMIC_RELAXED );
+    do
+    {
+        batch->next_batch = top;
+    }
+    while ( !UTILS_Atomic_CompareExchangeN_void_ptr( &parallel_regions_returned,
+                                                     &top,
+                                                     batch,
+                                                     true,
+                                                     UTILS_ATOMIC_RELEASE,
+                                                     UTILS_ATOMIC_RELAXED ) );
+}
+
+
+/* Moves all returned parallel_t objects to the thread-local free list. */
+static inline void
+reclaim_parallel_regions( void )
+{
+    parallel_t* batch = UTILS_Atomic_ExchangeN_void_ptr( &parallel_regions_returned,
+                                                         NULL,
+                                                         UTILS_ATOMIC_ACQUIRE );
+    while ( batch != NULL )
+    {
+        parallel_t* next_batch = batch->next_batch;
+        parallel_t* last       = batch;
+        parallel_regions_free_list_size++;
+        while ( last->next != NULL )
+        {
+            last = last->next;
+            parallel_regions_free_list_size++;
+        }
+        last->next                 = parallel_regions_free_list;
+        parallel_regions_free_list = batch;
+        batch                      = next_batch;
+    }
+}
+
+
 static inline parallel_t*
 get_parallel_region_from_pool( void )
 {
-    UTILS_MutexLock( &parallel_regions_free_list_mutex );
     parallel_t* parallel_region;
     uint32_t*   task_generation_numbers = NULL;
+    if ( parallel_regions_free_list == NULL )
+    {
+        reclaim_parallel_regions();
+    }
     if ( parallel_regions_free_list != NULL )
     {
         parallel_region            = parallel_regions_free_list;
         parallel_regions_free_list = parallel_regions_free_list->next;
-        task_generation_numbers    = parallel_region->task_generation_numbers;
+        parallel_regions_free_list_size--;
+        task_generation_numbers = parallel_region->task_generation_numbers;
     }
     else
     {
@@ -399,7 +470,6 @@ get_parallel_region_from_pool( void )
     }
     memset( parallel_region, 0,  sizeof( *parallel_region ) );
     parallel_region->task_generation_numbers = task_generation_numbers;
-    UTILS_MutexUnlock( &parallel_regions_free_list_mutex );
     return parallel_region;
 }
 
@@ -417,10 +487,65 @@ release_parallel_region( parallel_t* parallelRegion )
                                       UTILS_ATOMIC_SEQUENTIAL_CONSISTENT ) == 0 )
     {
         /* return to pool */
-        UTILS_MutexLock( &parallel_regions_free_list_mutex );
         parallelRegion->next       = parallel_regions_free_list;
         parallel_regions_free_list = parallelRegion;
-        UTILS_MutexUnlock( &parallel_regions_free_list_mutex );
+        parallel_regions_free_list_size++;
+        if ( parallel_regions_free_list_size >= 2 * PARALLEL_REGIONS_BATCH_SIZE )
+        {
+            parallel_t* batch = parallel_regions_free_list;
+            parallel_t* last  = batch;
+            for ( uint32_t i = 1; i < PARALLEL_REGIONS_BATCH_SIZE; i++ )
+            {
+                last = last->next;
+            }
+            parallel_regions_free_list       = last->next;
+            parallel_regions_free_list_size -= PARALLEL_REGIONS_BATCH_SIZE;
+            last->next                       = NULL;
+            return_parallel_regions( batch );
+        }
+    }
+}
+
+
+/* Pushes the list of task_t objects starting at @a batch to tasks_returned. */
+static inline void
+return_tasks( task_t* batch )
+{
+    task_t* top = UTILS_Atomic_LoadN_void_ptr( &tasks_returned,
+                                               UTILS_ATOMIC_RELAXED );
+    do
+    {
+        batch->next_batch = top;
+    }
+    while ( !UTILS_Atomic_CompareExchangeN_void_ptr( &tasks_returned,
+                                                     &top,
+                                                     batch,
+                                                     true,
+                                                     UTILS_ATOMIC_RELEASE,
+                                                     UTILS_ATOMIC_RELAXED ) );
+}
+
+
+/* Moves all returned task_t objects to the thread-local free list. */
+static inline void
+reclaim_tasks( void )
+{
+    task_t* batch = UTILS_Atomic_ExchangeN_void_ptr( &tasks_returned,
+                                                     NULL,
+                                                     UTILS_ATOMIC_ACQUIRE );
+    while ( batch != NULL )
+    {
+        task_t* next_batch = batch->next_batch;
+        task_t* last       = batch;
+        tasks_free_list_size++;
+        while ( last->next != NULL )
+        {
+            last = last->next;
+            tasks_free_list_size++;
+        }
+        last->next      = tasks_free_list;
+        tasks_free_list = batch;
+        batch           = next_batch;
     }
 }
 
@@ -433,6 +558,10 @@ get_task_from_pool( void )
     uint8_t              workshare_regions_capacity = 0;
     SCOREP_RegionHandle* sync_regions               = NULL;
     uint8_t              sync_regions_capacity      = 0;
+    if ( tasks_free_list == NULL )
+    {
+        reclaim_tasks();
+    }
     if ( tasks_free_list != NULL )
     {
         data                       = tasks_free_list;
@@ -441,6 +570,7 @@ get_task_from_pool( void )
         sync_regions               = data->sync_regions;
         sync_regions_capacity      = data->sync_regions_capacity;
         tasks_free_list            = tasks_free_list->next;
+        tasks_free_list_size--;
     }
     else
     {
@@ -465,6 +595,20 @@ release_task_to_pool( task_t* task )
 {
     task->next      = tasks_free_list;
     tasks_free_list = task;
+    tasks_free_list_size++;
+    if ( tasks_free_list_size >= 2 * TASKS_BATCH_SIZE )
+    {
+        task_t* batch = tasks_free_list;
+        task_t* last  = batch;
+        for ( uint32_t i = 1; i < TASKS_BATCH_SIZE; i++ )
+        {
+            last = last->next;
+        }
+        tasks_free_list       = last->next;
+        tasks_free_list_size -= TASKS_BATCH_SIZE;
+        last->next            = NULL;
+        return_tasks( batch );
+    }
 }
 
 
@@ -520,6 +664,21 @@ scorep_ompt_cb_host_thread_end( ompt_data_t* thread_data )
     SCOREP_IN_MEASUREMENT_INCREMENT();
     UTILS_DEBUG( "[%s] atid %" PRIu32,
                  UTILS_FUNCTION_NAME, thread_data->value );
+
+    /* Make the objects of this thread's pools available to other threads. */
+    if ( parallel_regions_free_list != NULL )
+    {
+        return_parallel_regions( parallel_regions_free_list );
+        parallel_regions_free_list      = NULL;
+        parallel_regions_free_list_size = 0;
+    }
+    if ( tasks_free_list != NULL )
+    {
+        return_tasks( tasks_free_list );
+        tasks_free_list      = NULL;
+        tasks_free_list_size = 0;
+    }
+
     SCOREP_IN_MEASUREMENT_DECREMENT();
 }
 
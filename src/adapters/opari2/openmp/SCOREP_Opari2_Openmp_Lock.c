@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2012, 2014, 2022,
+ * Copyright (c) 2009-2012, 2014, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2012,
@@ -33,125 +33,144 @@
  *
  * @ingroup OPARI2
  *
- * @brief Implementation of internal functins for lock management.
+ * @brief Implementation of internal functions for lock management.
  */
 
 #include <config.h>
 #include <stdlib.h>
 
 #include <SCOREP_Definitions.h>
+#include <UTILS_Atomic.h>
+#include <UTILS_Error.h>
 
 #include "SCOREP_Opari2_Openmp_Lock.h"
 
-#define SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE 100
+/* Locks are kept in a hash table keyed by the address of the OMP lock (or the
+ * name of the critical region). Each bucket is a singly linked list of
+ * entries. Entries are never unlinked before finalization, thus lookups only
+ * need to walk the list without taking any lock. A destroyed lock leaves a
+ * free entry (lock == NULL) behind, which is claimed again by a later
+ * initialization hashing into the same bucket. */
 
-struct lock_block
+#define SCOREP_OPARI2_OPENMP_LOCK_HASH_POWER 12
+#define SCOREP_OPARI2_OPENMP_LOCK_HASH_SIZE  ( UINT32_C( 1 ) << SCOREP_OPARI2_OPENMP_LOCK_HASH_POWER )
+
+typedef struct lock_entry lock_entry;
+struct lock_entry
 {
-    struct SCOREP_Opari2_Openmp_Lock lock[ SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE ];
-    struct lock_block*               next;
-    struct lock_block*               prev;
+    SCOREP_Opari2_Openmp_Lock lock;
+    lock_entry*               next;
 };
 
-static struct lock_block*                lock_head_block = 0;
-static struct lock_block*                lock_last_block = 0;
-static struct SCOREP_Opari2_Openmp_Lock* last_lock       = 0;
-static int                               last_index      = SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE;
+static lock_entry* lock_table[ SCOREP_OPARI2_OPENMP_LOCK_HASH_SIZE ];
 
 static SCOREP_Opari2_Openmp_Lock_HandleType current_lock_handle = 0;
 
-UTILS_Mutex scorep_opari2_openmp_lock = UTILS_MUTEX_INIT;
+
+static inline lock_entry**
+get_bucket( const void* lock )
+{
+    uint64_t hash = ( uint64_t )( uintptr_t )lock * UINT64_C( 0x9E3779B97F4A7C15 );
+    return &lock_table[ hash >> ( 64 - SCOREP_OPARI2_OPENMP_LOCK_HASH_POWER ) ];
+}
+
 
 void
 scorep_opari2_openmp_lock_finalize( void )
 {
-    struct lock_block* block;
+    for ( uint32_t i = 0; i < SCOREP_OPARI2_OPENMP_LOCK_HASH_SIZE; i++ )
+    {
+        lock_entry* entry = lock_table[ i ];
+        while ( entry )
+        {
+            lock_entry* next = entry->next;
+            free( entry );
+            entry = next;
+        }
+        lock_table[ i ] = NULL;
+    }
+}
 
-    /* free lock blocks */
 
-    while ( lock_head_block )
+static lock_entry*
+find_entry( lock_entry* entry,
+            const void* lock )
+{
+    while ( entry )
     {
-        block           = lock_head_block;
-        lock_head_block = lock_head_block->next;
-        free( block );
+        if ( UTILS_Atomic_LoadN_void_ptr( ( void** )&entry->lock.lock,
+                                          UTILS_ATOMIC_ACQUIRE ) == lock )
+        {
+            return entry;
+        }
+        entry = entry->next;
     }
+    return NULL;
 }
 
+
 SCOREP_Opari2_Openmp_Lock*
 scorep_opari2_openmp_lock_init( const void* lock )
 {
-    struct lock_block* new_block;
-
-    UTILS_MutexLock( &scorep_opari2_openmp_lock );
-    last_index++;
-    if ( last_index >= SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE )
+    lock_entry** bucket = get_bucket( lock );
+    lock_entry*  head   = UTILS_Atomic_LoadN_void_ptr( ( void** )bucket,
+                                                       UTILS_ATOMIC_ACQUIRE );
+
+    /* The address of a lock might be reused without destroying the previous
+     * lock first, re-initialize its entry in that case. */
+    lock_entry* entry = find_entry( head, lock );
+    if ( !entry )
     {
-        if ( lock_head_block == 0 )
+        /* Try to claim an entry of a destroyed lock. */
+        for ( lock_entry* curr = head; curr && !entry; curr = curr->next )
         {
-            /* first time: allocate and initialize first block */
-            new_block       = malloc( sizeof( struct lock_block ) );
-            new_block->next = 0;
-            new_block->prev = 0;
-            lock_head_block = lock_last_block = new_block;
-        }
-        else if ( lock_last_block == 0 )
-        {
-            /* lock list empty: re-initialize */
-            lock_last_block = lock_head_block;
-        }
-        else
-        {
-            if ( lock_last_block->next == 0 )
+            void* expected = NULL;
+            if ( UTILS_Atomic_LoadN_void_ptr( ( void** )&curr->lock.lock,
+                                              UTILS_ATOMIC_RELAXED ) == NULL
+                 && UTILS_Atomic_CompareExchangeN_void_ptr( ( void** )&curr->lock.lock,
+                                                            &expected,
+                                                            ( void* )lock,
+                                                            false,
+                                                            UTILS_ATOMIC_ACQUIRE_RELEASE,
+                                                            UTILS_ATOMIC_RELAXED ) )
             {
-                /* lock list full: expand */
-                new_block             = malloc( sizeof( struct lock_block ) );
-                new_block->next       = 0;
-                new_block->prev       = lock_last_block;
-                lock_last_block->next = new_block;
+                entry = curr;
             }
-            /* use next available block */
-            lock_last_block = lock_last_block->next;
         }
-        last_lock  = &( lock_last_block->lock[ 0 ] );
-        last_index = 0;
     }
-    else
+    if ( !entry )
     {
-        last_lock++;
+        entry = malloc( sizeof( *entry ) );
+        UTILS_BUG_ON( entry == NULL, "Could not allocate OpenMP lock entry." );
+        entry->lock.lock = lock;
+        do
+        {
+            entry->next = head;
+        }
+        while ( !UTILS_Atomic_CompareExchangeN_void_ptr( ( void** )bucket,
+                                                         ( void** )&head,
+                                                         entry,
+                                                         true,
+                                                         UTILS_ATOMIC_RELEASE,
+                                                         UTILS_ATOMIC_ACQUIRE ) );
     }
+
     /* store lock information */
-    last_lock->lock              = lock;
-    last_lock->handle            = current_lock_handle++;
-    last_lock->acquisition_order = 0;
-    last_lock->nest_level        = 0;
+    entry->lock.handle            = UTILS_Atomic_FetchAdd_uint32( &current_lock_handle, 1,
+                                                                  UTILS_ATOMIC_RELAXED );
+    entry->lock.acquisition_order = 0;
+    entry->lock.nest_level        = 0;
 
-    UTILS_MutexUnlock( &scorep_opari2_openmp_lock );
-    return last_lock;
+    return &entry->lock;
 }
 
 static struct SCOREP_Opari2_Openmp_Lock*
 scorep_opari2_openmp_get_lock( const void* lock )
 {
-    int                               i;
-    struct lock_block*                block;
-    struct SCOREP_Opari2_Openmp_Lock* curr;
-
-    /* search all locks in all blocks */
-    block = lock_head_block;
-    while ( block )
-    {
-        curr = &( block->lock[ 0 ] );
-        for ( i = 0; i < SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE; ++i )
-        {
-            if ( curr->lock == lock )
-            {
-                return curr;
-            }
-
-            curr++;
-        }
-        block = block->next;
-    }
-    return 0;
+    lock_entry* entry = find_entry( UTILS_Atomic_LoadN_void_ptr( ( void** )get_bucket( lock ),
+                                                                 UTILS_ATOMIC_ACQUIRE ),
+                                    lock );
+    return entry ? &entry->lock : NULL;
 }
 
 
@@ -205,32 +224,11 @@ SCOREP_Opari2_Openmp_GetLock( const void* lock )
 void
 scorep_opari2_openmp_lock_destroy( const void* lock )
 {
-    /* delete lock by copying last lock in place of lock */
-
-    *scorep_opari2_openmp_get_lock( lock ) = *last_lock;
-
-    /* adjust pointer to last lock  */
-    last_index--;
-    if ( last_index < 0 )
-    {
-        /* reached low end of block */
-        if ( lock_last_block->prev )
-        {
-            /* goto previous block if existing */
-            last_index = SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE - 1;
-            last_lock  = &( lock_last_block->
-                            prev->lock[ last_index ] );
-        }
-        else
-        {
-            /* no previous block: re-initialize */
-            last_index = SCOREP_OPARI2_OPENMP_LOCKBLOCK_SIZE;
-            last_lock  = 0;
-        }
-        lock_last_block = lock_last_block->prev;
-    }
-    else
+    /* free the entry for reuse, it stays in the bucket */
+    SCOREP_Opari2_Openmp_Lock* lock_struct = scorep_opari2_openmp_get_lock( lock );
+    if ( lock_struct )
     {
-        last_lock--;
+        UTILS_Atomic_StoreN_void_ptr( ( void** )&lock_struct->lock, NULL,
+                                      UTILS_ATOMIC_RELEASE );
     }
 }
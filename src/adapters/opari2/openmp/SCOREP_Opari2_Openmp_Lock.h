@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2022,
+ * Copyright (c) 2009-2014, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -39,7 +39,6 @@
  */
 
 #include <scorep/SCOREP_PublicTypes.h>
-#include <UTILS_Mutex.h>
 #include <stdint.h>
 
 /** Definition of the type of the lock handle */
@@ -69,6 +68,10 @@ extern SCOREP_RegionHandle scorep_opari2_openmp_lock_region_handles[ SCOREP_OPAR
 
 typedef struct SCOREP_Opari2_Openmp_Lock SCOREP_Opari2_Openmp_Lock;
 
+/** Score-P representation of an OMP lock. The address stays valid until
+    scorep_opari2_openmp_lock_finalize. @a acquisition_order and @a nest_level
+    are only modified by the thread holding the OMP lock, thus they do not need
+    further synchronization. */
 struct SCOREP_Opari2_Openmp_Lock
 {
     const void*                          lock;
@@ -77,10 +80,6 @@ struct SCOREP_Opari2_Openmp_Lock
     uint32_t                             nest_level; // only used for nested locks
 };
 
-/** Mutex to ensure exclusive access to opari2_openmp_lock lock data structure.
- */
-extern UTILS_Mutex scorep_opari2_openmp_lock;
-
 /** Initializes a new lock handle.
     @param lock The OMP lock which should be initialized
     @returns the new SCOREP lock handle.
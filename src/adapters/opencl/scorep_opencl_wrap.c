@@ -4,6 +4,9 @@
  * Copyright (c) 2014-2015, 2017, 2025,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license.  See the COPYING file in the package base
  * directory for details.
@@ -40,11 +43,11 @@
     { \
         if ( scorep_opencl_record_api ) \
         { \
-            SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION_HANDLE( func ) ); \
+            SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( SCOREP_LIBWRAP_REGION_HANDLE( func ) ) ); \
         } \
         else if ( SCOREP_IsUnwindingEnabled() ) \
         { \
-            SCOREP_EnterWrapper( SCOREP_LIBWRAP_REGION_HANDLE( func ) ); \
+            SCOREP_EnterWrapper( SCOREP_LIBWRAP_REGION( SCOREP_LIBWRAP_REGION_HANDLE( func ) ) ); \
         } \
     }
 /* *INDENT-ON* */
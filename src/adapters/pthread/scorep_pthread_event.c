@@ -1,7 +1,7 @@
 /**
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2014, 2016, 2018,
+ * Copyright (c) 2014, 2016, 2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2014-2018, 2023, 2025,
@@ -89,7 +89,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_create )( pthread_t*            thread,
         int result = pthread_attr_getdetachstate( attr, &detach_state );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_CREATE ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_CREATE ] ) );
     SCOREP_Location*              location = SCOREP_Location_GetCurrentCPULocation();
     scorep_pthread_location_data* data     =
         SCOREP_Location_GetSubsystemData( location, scorep_pthread_subsystem_id );
@@ -270,7 +270,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_join )( pthread_t thread,
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_JOIN ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_JOIN ] ) );
 
     extern pthread_t scorep_pthread_main_thread;
     if ( pthread_equal( thread, scorep_pthread_main_thread ) )
@@ -347,7 +347,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_exit )( void* valuePtr )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_EXIT ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_EXIT ] ) );
     /* Matching exit will be triggered from cleanup_handler() or condition below. */
 
     SCOREP_Location*              location = SCOREP_Location_GetCurrentCPULocation();
@@ -397,7 +397,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cancel )( pthread_t thread )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_CANCEL ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_CANCEL ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_cancel )( thread );
@@ -423,7 +423,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_detach )( pthread_t thread )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_DETACH ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_DETACH ] ) );
 
     // If detached thread still runs at finalization time, finalization will
     // fail because it requires serial execution.
@@ -464,7 +464,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_mutex_init )( pthread_mutex_t*           pthread
         int ignore = pthread_mutexattr_getpshared( pthreadAttr, &process_shared );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_INIT ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_INIT ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_mutex_init )( pthreadMutex, pthreadAttr );
@@ -514,7 +514,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_mutex_destroy )( pthread_mutex_t* pthreadMutex )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_DESTROY ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_DESTROY ] ) );
 
     scorep_pthread_mutex* scorep_mutex = scorep_pthread_mutex_hash_get( pthreadMutex );
     if ( scorep_mutex )
@@ -553,7 +553,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_mutex_lock )( pthread_mutex_t* pthreadMutex )
         scorep_mutex = scorep_pthread_mutex_hash_put( pthreadMutex );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_LOCK ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_LOCK ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_mutex_lock )( pthreadMutex );
@@ -623,7 +623,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_mutex_unlock )( pthread_mutex_t* pthreadMutex )
         UTILS_WARNING( "Undefined behavior: unlocking unlocked mutex %p", pthreadMutex );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_UNLOCK ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_UNLOCK ] ) );
 
     if ( scorep_mutex->process_shared == false )
     {
@@ -672,7 +672,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_mutex_trylock )( pthread_mutex_t* pthreadMutex )
         scorep_mutex = scorep_pthread_mutex_hash_put( pthreadMutex );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_TRYLOCK ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_MUTEX_TRYLOCK ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_mutex_trylock )( pthreadMutex );
@@ -707,7 +707,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_init )( pthread_cond_t*           cond,
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_INIT ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_INIT ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_cond_init )( cond, attr );
@@ -733,7 +733,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_signal )( pthread_cond_t* cond )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_SIGNAL ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_SIGNAL ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_cond_signal )( cond );
@@ -759,7 +759,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_broadcast )( pthread_cond_t* cond )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_BROADCAST ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_BROADCAST ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_cond_broadcast )( cond );
@@ -803,7 +803,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_wait )( pthread_cond_t*  cond,
         return SCOREP_LIBWRAP_ORIGINAL( pthread_cond_wait )( cond, pthreadMutex );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_WAIT ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_WAIT ] ) );
 
     if ( scorep_mutex->process_shared == false )
     {
@@ -882,7 +882,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_timedwait )( pthread_cond_t*        cond,
         return SCOREP_LIBWRAP_ORIGINAL( pthread_cond_timedwait )( cond, pthreadMutex, time );
     }
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_TIMEDWAIT ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_TIMEDWAIT ] ) );
 
     if ( scorep_mutex->process_shared == false )
     {
@@ -942,7 +942,7 @@ SCOREP_LIBWRAP_WRAPPER( pthread_cond_destroy )( pthread_cond_t* cond )
 
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_EnterWrappedRegion( scorep_pthread_regions[ SCOREP_PTHREAD_COND_DESTROY ] );
+    SCOREP_EnterWrappedRegion( SCOREP_LIBWRAP_REGION( scorep_pthread_regions[ SCOREP_PTHREAD_COND_DESTROY ] ) );
 
     SCOREP_ENTER_WRAPPED_REGION();
     int result = SCOREP_LIBWRAP_ORIGINAL( pthread_cond_destroy )( cond );
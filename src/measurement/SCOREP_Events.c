@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2018, 2021-2022,
+ * Copyright (c) 2009-2018, 2021-2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -64,7 +64,9 @@
 
 #include "scorep_environment.h"
 #include "scorep_events_common.h"
+#include "scorep_parameter_string_cache.h"
 #include "scorep_runtime_management.h"
+#include "scorep_sample_buffer.h"
 #include "scorep_type_utils.h"
 
 
@@ -80,9 +82,11 @@ SCOREP_Sample( SCOREP_InterruptGeneratorHandle interruptGeneratorHandle,
 {
     UTILS_BUG_ON( !SCOREP_IsUnwindingEnabled(), "Invalid call." );
 
-    SCOREP_Location* location      = SCOREP_Location_GetCurrentCPULocation();
-    uint64_t         timestamp     = scorep_get_timestamp( location );
-    uint64_t*        metric_values = SCOREP_Metric_Read( location );
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    /* Not scorep_get_timestamp(), that would pass on the buffered samples. */
+    uint64_t timestamp = SCOREP_Timer_GetClockTicks();
+    SCOREP_Location_SetLastTimestamp( location, timestamp );
+    uint64_t* metric_values = SCOREP_Metric_Read( location );
 
     SCOREP_CallingContextHandle current_calling_context  = SCOREP_INVALID_CALLING_CONTEXT;
     SCOREP_CallingContextHandle previous_calling_context = SCOREP_INVALID_CALLING_CONTEXT;
@@ -99,14 +103,27 @@ SCOREP_Sample( SCOREP_InterruptGeneratorHandle interruptGeneratorHandle,
         return;
     }
 
-    SCOREP_CALL_SUBSTRATE( Sample, SAMPLE,
-                           ( location,
-                             timestamp,
-                             current_calling_context,
-                             previous_calling_context,
-                             unwind_distance,
-                             interruptGeneratorHandle,
-                             metric_values ) );
+    /* Metric values are only valid until the next read, thus only samples
+     * without metrics can be buffered. */
+    if ( metric_values == NULL
+         && scorep_sample_buffer_push( location,
+                                       timestamp,
+                                       current_calling_context,
+                                       previous_calling_context,
+                                       unwind_distance,
+                                       interruptGeneratorHandle ) )
+    {
+        return;
+    }
+
+    SCOREP_CALL_SUBSTRATE_DISPATCH( Sample, SAMPLE,
+                                    ( location,
+                                      timestamp,
+                                      current_calling_context,
+                                      previous_calling_context,
+                                      unwind_distance,
+                                      interruptGeneratorHandle,
+                                      metric_values ) );
 }
 
 
@@ -122,14 +139,14 @@ SCOREP_Location_DeactivateCpuSample( SCOREP_Location*            location,
     uint64_t  timestamp     = scorep_get_timestamp( location );
     uint64_t* metric_values = SCOREP_Metric_Read( location );
 
-    SCOREP_CALL_SUBSTRATE( Sample, SAMPLE,
-                           ( location,
-                             timestamp,
-                             SCOREP_INVALID_CALLING_CONTEXT,
-                             previousCallingContext,
-                             1,
-                             SCOREP_INVALID_INTERRUPT_GENERATOR,
-                             metric_values ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( Sample, SAMPLE,
+                                    ( location,
+                                      timestamp,
+                                      SCOREP_INVALID_CALLING_CONTEXT,
+                                      previousCallingContext,
+                                      1,
+                                      SCOREP_INVALID_INTERRUPT_GENERATOR,
+                                      metric_values ) );
 }
 
 void
@@ -164,8 +181,8 @@ enter_region( SCOREP_Location*    location,
 
     SCOREP_Task_Enter( location, regionHandle );
 
-    SCOREP_CALL_SUBSTRATE( EnterRegion, ENTER_REGION,
-                           ( location, timestamp, regionHandle, metricValues ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( EnterRegion, ENTER_REGION,
+                                    ( location, timestamp, regionHandle, metricValues ) );
 }
 
 
@@ -192,13 +209,13 @@ scorep_calling_context_enter( SCOREP_Location*    location,
     UTILS_BUG_ON( current_calling_context == SCOREP_INVALID_CALLING_CONTEXT,
                   "Unwinding could not create calling context for enter event." );
 
-    SCOREP_CALL_SUBSTRATE( CallingContextEnter, CALLING_CONTEXT_ENTER,
-                           ( location,
-                             timestamp,
-                             current_calling_context,
-                             previous_calling_context,
-                             unwind_distance,
-                             metricValues ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( CallingContextEnter, CALLING_CONTEXT_ENTER,
+                                    ( location,
+                                      timestamp,
+                                      current_calling_context,
+                                      previous_calling_context,
+                                      unwind_distance,
+                                      metricValues ) );
 }
 
 
@@ -237,6 +254,7 @@ SCOREP_Location_EnterRegion( SCOREP_Location*    location,
         location = SCOREP_Location_GetCurrentCPULocation();
     }
 
+    scorep_pass_samples_until( location, timestamp );
     SCOREP_Location_SetLastTimestamp( location, timestamp );
 
     uint64_t* metric_values = SCOREP_Metric_Read( location );
@@ -292,8 +310,8 @@ exit_region( SCOREP_Location*    location,
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_EVENTS, "Reg:%u",
                         SCOREP_Definitions_HandleToId( regionHandle ) );
 
-    SCOREP_CALL_SUBSTRATE( ExitRegion, EXIT_REGION,
-                           ( location, timestamp, regionHandle, metricValues ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( ExitRegion, EXIT_REGION,
+                                    ( location, timestamp, regionHandle, metricValues ) );
 
     SCOREP_Task_Exit( location );
 }
@@ -322,13 +340,13 @@ scorep_calling_context_exit( SCOREP_Location*    location,
     UTILS_BUG_ON( current_calling_context == SCOREP_INVALID_CALLING_CONTEXT,
                   "Unwinding could not create calling context for exit event." );
 
-    SCOREP_CALL_SUBSTRATE( CallingContextExit, CALLING_CONTEXT_EXIT,
-                           ( location,
-                             timestamp,
-                             current_calling_context,
-                             previous_calling_context,
-                             unwind_distance,
-                             metricValues ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( CallingContextExit, CALLING_CONTEXT_EXIT,
+                                    ( location,
+                                      timestamp,
+                                      current_calling_context,
+                                      previous_calling_context,
+                                      unwind_distance,
+                                      metricValues ) );
 }
 
 
@@ -360,6 +378,7 @@ SCOREP_Location_ExitRegion( SCOREP_Location*    location,
         location = SCOREP_Location_GetCurrentCPULocation();
     }
 
+    scorep_pass_samples_until( location, timestamp );
     SCOREP_Location_SetLastTimestamp( location, timestamp );
 
     uint64_t* metric_values = SCOREP_Metric_Read( location );
@@ -819,6 +838,8 @@ SCOREP_Location_RmaWinCreate( SCOREP_Location*       location,
                               uint64_t               timestamp,
                               SCOREP_RmaWindowHandle windowHandle )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     SCOREP_CALL_SUBSTRATE( RmaWinCreate, RMA_WIN_CREATE,
                            ( location, timestamp, windowHandle ) );
 }
@@ -840,6 +861,8 @@ SCOREP_Location_RmaWinDestroy( SCOREP_Location*       location,
                                uint64_t               timestamp,
                                SCOREP_RmaWindowHandle windowHandle )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     SCOREP_CALL_SUBSTRATE( RmaWinDestroy, RMA_WIN_DESTROY,
                            ( location, timestamp, windowHandle ) );
 }
@@ -1000,6 +1023,8 @@ SCOREP_Location_RmaPut( SCOREP_Location*       location,
                         uint64_t               bytes,
                         uint64_t               matchingId )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     SCOREP_CALL_SUBSTRATE( RmaPut, RMA_PUT,
                            ( location, timestamp, windowHandle,
                              remote, bytes, matchingId ) );
@@ -1030,6 +1055,8 @@ SCOREP_Location_RmaGet( SCOREP_Location*       location,
                         uint64_t               bytes,
                         uint64_t               matchingId )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     SCOREP_CALL_SUBSTRATE( RmaGet, RMA_GET,
                            ( location, timestamp, windowHandle,
                              remote, bytes, matchingId ) );
@@ -1072,6 +1099,8 @@ SCOREP_Location_RmaOpCompleteBlocking( SCOREP_Location*       location,
                                        SCOREP_RmaWindowHandle windowHandle,
                                        uint64_t               matchingId )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     SCOREP_CALL_SUBSTRATE( RmaOpCompleteBlocking, RMA_OP_COMPLETE_BLOCKING,
                            ( location, timestamp, windowHandle, matchingId ) );
 }
@@ -1335,8 +1364,8 @@ SCOREP_TriggerCounterInt64( SCOREP_SamplingSetHandle counterHandle,
 
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_EVENTS, "" );
 
-    SCOREP_CALL_SUBSTRATE( TriggerCounterInt64, TRIGGER_COUNTER_INT64,
-                           ( location, timestamp, counterHandle, value ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( TriggerCounterInt64, TRIGGER_COUNTER_INT64,
+                                    ( location, timestamp, counterHandle, value ) );
 }
 
 
@@ -1348,8 +1377,8 @@ trigger_counter_uint64( SCOREP_Location*         location,
 {
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_EVENTS, "" );
 
-    SCOREP_CALL_SUBSTRATE( TriggerCounterUint64, TRIGGER_COUNTER_UINT64,
-                           ( location, timestamp, counterHandle, value ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( TriggerCounterUint64, TRIGGER_COUNTER_UINT64,
+                                    ( location, timestamp, counterHandle, value ) );
 }
 
 
@@ -1376,6 +1405,8 @@ SCOREP_Location_TriggerCounterUint64( SCOREP_Location*         location,
                                       SCOREP_SamplingSetHandle counterHandle,
                                       uint64_t                 value )
 {
+    scorep_pass_samples_until( location, timestamp );
+
     trigger_counter_uint64( location, timestamp, counterHandle, value );
 }
 
@@ -1392,8 +1423,8 @@ SCOREP_TriggerCounterDouble( SCOREP_SamplingSetHandle counterHandle,
 
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_EVENTS, "" );
 
-    SCOREP_CALL_SUBSTRATE( TriggerCounterDouble, TRIGGER_COUNTER_DOUBLE,
-                           ( location, timestamp, counterHandle, value ) );
+    SCOREP_CALL_SUBSTRATE_DISPATCH( TriggerCounterDouble, TRIGGER_COUNTER_DOUBLE,
+                                    ( location, timestamp, counterHandle, value ) );
 }
 
 
@@ -1459,6 +1490,7 @@ SCOREP_Location_TriggerParameterUint64( SCOREP_Location*       location,
         location = SCOREP_Location_GetCurrentCPULocation();
     }
 
+    scorep_pass_samples_until( location, timestamp );
     SCOREP_Location_SetLastTimestamp( location, timestamp );
 
     SCOREP_CALL_SUBSTRATE( TriggerParameterUint64, TRIGGER_PARAMETER_UINT64,
@@ -1473,8 +1505,10 @@ void
 SCOREP_TriggerParameterString( SCOREP_ParameterHandle parameterHandle,
                                const char*            value )
 {
-    SCOREP_StringHandle string_handle = SCOREP_Definitions_NewString( value );
-    SCOREP_TriggerParameterStringHandle( parameterHandle, string_handle );
+    SCOREP_TriggerParameterStringHandle(
+        parameterHandle,
+        scorep_parameter_string_cache_get( SCOREP_Location_GetCurrentCPULocation(),
+                                           parameterHandle, value ) );
 }
 
 
@@ -1512,9 +1546,11 @@ SCOREP_Location_TriggerParameterString( SCOREP_Location*       location,
         location = SCOREP_Location_GetCurrentCPULocation();
     }
 
+    scorep_pass_samples_until( location, timestamp );
     SCOREP_Location_SetLastTimestamp( location, timestamp );
 
-    SCOREP_StringHandle string_handle = SCOREP_Definitions_NewString( value );
+    SCOREP_StringHandle string_handle =
+        scorep_parameter_string_cache_get( location, parameterHandle, value );
 
     SCOREP_CALL_SUBSTRATE( TriggerParameterString, TRIGGER_PARAMETER_STRING,
                            ( location, timestamp,
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2017-2018, 2021, 2024,
+ * Copyright (c) 2009-2015, 2017-2018, 2021, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -91,6 +91,7 @@
 #include <SCOREP_Thread_Mgmt.h>
 #include "scorep_location_management.h"
 #include "scorep_runtime_management.h"
+#include "scorep_sample_buffer.h"
 #include "scorep_system_tree.h"
 #include "scorep_clock_synchronization.h"
 #include "scorep_paradigms_management.h"
@@ -403,6 +404,11 @@ static void
 end_epoch( SCOREP_ExitStatus exitStatus )
 {
     SCOREP_TIME_START_TIMING( SCOREP_EndEpoch );
+
+    /* Samples still buffered precede the end of the epoch. */
+    scorep_sample_buffer_dispatch( SCOREP_Location_GetCurrentCPULocation() );
+    scorep_sample_buffer_dispatch( main_thread_location );
+
     SCOREP_EndEpoch();
 
     /* We might execute this function on a thread different from the program's
@@ -776,9 +782,12 @@ SCOREP_EnableRecording( void )
 {
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_Location* location      = SCOREP_Location_GetCurrentCPULocation();
-    uint64_t         timestamp     = SCOREP_Timer_GetClockTicks();
-    uint64_t*        metric_values = SCOREP_Metric_Read( location );
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    /* Buffered samples were taken in the current recording mode. */
+    scorep_sample_buffer_dispatch( location );
+
+    uint64_t  timestamp     = SCOREP_Timer_GetClockTicks();
+    uint64_t* metric_values = SCOREP_Metric_Read( location );
 
     if ( !SCOREP_Thread_InParallel() )
     {
@@ -807,9 +816,12 @@ SCOREP_DisableRecording( void )
 {
     UTILS_DEBUG_ENTRY();
 
-    SCOREP_Location* location      = SCOREP_Location_GetCurrentCPULocation();
-    uint64_t         timestamp     = SCOREP_Timer_GetClockTicks();
-    uint64_t*        metric_values = SCOREP_Metric_Read( location );
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    /* Buffered samples were taken in the current recording mode. */
+    scorep_sample_buffer_dispatch( location );
+
+    uint64_t  timestamp     = SCOREP_Timer_GetClockTicks();
+    uint64_t* metric_values = SCOREP_Metric_Read( location );
 
     if ( !SCOREP_Thread_InParallel() )
     {
@@ -885,8 +897,11 @@ SCOREP_OnTracingBufferFlushEnd( uint64_t timestamp )
      */
     SCOREP_Status_OnOtf2Flush();
 
-    SCOREP_Location* location      = SCOREP_Location_GetCurrentCPULocation();
-    uint64_t*        metric_values = SCOREP_Metric_Read( location );
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    /* Samples taken during the flush belong into the flush region. */
+    scorep_sample_buffer_dispatch( location );
+
+    uint64_t* metric_values = SCOREP_Metric_Read( location );
 
     /*
      * We account the flush time of non-CPU locations (i.e., CUDA streams
@@ -910,6 +925,30 @@ init_mpp( SCOREP_SynchronizationMode syncMode )
 }
 
 
+static bool
+record_timer_frequency( SCOREP_Location* location,
+                        void*            arg )
+{
+    /* An uint64_t has up to 20 decimal digits. */
+    SCOREP_Location_AddLocationProperty( location, "TIMER_FREQUENCY", 21, "%" PRIu64,
+                                         *( uint64_t* )arg );
+    return false;
+}
+
+
+/*
+ * The timer frequency is determined per process. Record it for all
+ * locations of this process, as processes on different hardware may run at
+ * different frequencies.
+ */
+static void
+record_timer_frequencies( void )
+{
+    uint64_t frequency = SCOREP_Timer_GetClockResolution();
+    SCOREP_Location_ForAll( record_timer_frequency, &frequency );
+}
+
+
 static void
 scorep_finalize( void )
 {
@@ -973,7 +1012,7 @@ scorep_finalize( void )
 
     /* Clock resolution might be calculated once. Do it at the beginning
      * of finalization. */
-    SCOREP_Timer_GetClockResolution();
+    record_timer_frequencies();
 
     /*
      * Second, call into the substrates to deactivate the master.
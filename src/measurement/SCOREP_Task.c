@@ -4,7 +4,7 @@
  * Copyright (c) 2014-2015,
  * German Research School for Simulation Sciences GmbH, Juelich/Aachen, Germany
  *
- * Copyright (c) 2015, 2018, 2021-2022,
+ * Copyright (c) 2015, 2018, 2021-2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2015,
@@ -46,6 +46,8 @@
 typedef struct scorep_task_stack_frame
 {
     SCOREP_RegionHandle             regions[ SCOREP_TASK_STACK_SIZE ];
+    /* Hash of the region stack up to and including regions[ i ] */
+    uint32_t                        stack_hashes[ SCOREP_TASK_STACK_SIZE ];
     struct scorep_task_stack_frame* prev;
 } scorep_task_stack_frame;
 
@@ -331,6 +333,23 @@ SCOREP_Task_ClearCurrent( void )
     SCOREP_Task_ClearStack( location, SCOREP_Task_GetCurrentTask( location ) );
 }
 
+/*
+ * The hash of the region stack is aggregated from the bottom to the top of
+ * the stack, starting with the hash of the parent thread/task. This allows to
+ * match the master thread callpaths. Filtered regions do not contribute.
+ */
+static inline uint32_t
+aggregate_stack_hash( uint32_t            stackHash,
+                      SCOREP_RegionHandle region )
+{
+    if ( region == SCOREP_FILTERED_REGION )
+    {
+        return stackHash;
+    }
+    uint32_t region_hash = SCOREP_LOCAL_HANDLE_DEREF( region, Region )->hash_value;
+    return jenkins_hash( &region_hash, sizeof( region_hash ), stackHash );
+}
+
 void
 SCOREP_Task_Enter( SCOREP_Location*    location,
                    SCOREP_RegionHandle region )
@@ -342,16 +361,25 @@ SCOREP_Task_Enter( SCOREP_Location*    location,
 
     if ( task->current_index < SCOREP_TASK_STACK_SIZE - 1 )
     {
+        scorep_task_stack_frame* frame = task->current_frame;
         task->current_index++;
-        task->current_frame->regions[ task->current_index ] = region;
+        frame->regions[ task->current_index ]      = region;
+        frame->stack_hashes[ task->current_index ] =
+            aggregate_stack_hash( frame->stack_hashes[ task->current_index - 1 ], region );
     }
     else
     {
+        /* All previous frames are full */
+        uint32_t stack_hash = task->current_frame
+                              ? task->current_frame->stack_hashes[ SCOREP_TASK_STACK_SIZE - 1 ]
+                              : task->parent_hash_value;
+
         scorep_task_stack_frame* new_frame = alloc_new_stack_frame( location );
-        new_frame->prev                   = task->current_frame;
-        task->current_frame               = new_frame;
-        task->current_frame->regions[ 0 ] = region;
-        task->current_index               = 0;
+        new_frame->prev                        = task->current_frame;
+        task->current_frame                    = new_frame;
+        task->current_frame->regions[ 0 ]      = region;
+        task->current_frame->stack_hashes[ 0 ] = aggregate_stack_hash( stack_hash, region );
+        task->current_index                    = 0;
     }
 }
 
@@ -380,27 +408,6 @@ SCOREP_Task_SetSubstrateData( SCOREP_TaskHandle task,
     task->substrate_data[ substrateId ] = data;
 }
 
-static uint32_t
-stack_frame_aggregation( const scorep_task_stack_frame* frame,
-                         uint32_t                       frameSize,
-                         SCOREP_TaskHandle              task )
-{
-    if ( !frame )
-    {
-        return task->parent_hash_value;
-    }
-    /* All previous frames are full, thus always pass `( SCOREP_TASK_STACK_SIZE - 1 )` */
-    uint32_t aggregated_jenkinshash_value = stack_frame_aggregation( frame->prev, ( SCOREP_TASK_STACK_SIZE - 1 ), task );
-
-    for ( uint32_t i = 0; i <= frameSize; i++ )
-    {
-        uint32_t region_hash = SCOREP_LOCAL_HANDLE_DEREF( frame->regions[ i ], Region )->hash_value;
-        aggregated_jenkinshash_value = jenkins_hash( &region_hash, sizeof( region_hash ), aggregated_jenkinshash_value );
-    }
-
-    return aggregated_jenkinshash_value;
-}
-
 uint32_t
 SCOREP_Task_GetRegionStackHash( SCOREP_TaskHandle task )
 {
@@ -409,9 +416,6 @@ SCOREP_Task_GetRegionStackHash( SCOREP_TaskHandle task )
         return 0;
     }
 
-    /* The aggregation of previous full frames has to happen from the bottom to
-     * the top of the stack to allow the integration of the parent thread/task
-     * hash values and to match the master thread callpaths.
-     */
-    return stack_frame_aggregation( task->current_frame, task->current_index, task );
+    /* Maintained by SCOREP_Task_Enter, see aggregate_stack_hash */
+    return task->current_frame->stack_hashes[ task->current_index ];
 }
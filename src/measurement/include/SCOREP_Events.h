@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2016, 2021-2022,
+ * Copyright (c) 2009-2014, 2016, 2021-2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -121,6 +121,29 @@ void
 SCOREP_Sample( SCOREP_InterruptGeneratorHandle interruptGeneratorHandle,
                void*                           contextPtr );
 
+/**
+ * Buffer up to @a numberOfSamples samples of @a location before passing them
+ * to the substrates. Buffered samples are passed on before the next event of
+ * @a location, or from within the signal handler if the buffer is full.
+ * Samples with metrics are never buffered. Needs to be called before the
+ * first sample of @a location.
+ *
+ * @param location        The CPU location to buffer the samples of.
+ * @param numberOfSamples Buffer size, 0 disables buffering.
+ */
+void
+SCOREP_SetSampleBufferSize( SCOREP_Location* location,
+                            uint32_t         numberOfSamples );
+
+/**
+ * Pass all buffered samples of @a location to the substrates. Used when
+ * @a location stops taking samples.
+ *
+ * @param location The CPU location to pass on the samples of.
+ */
+void
+SCOREP_FlushSampleBuffer( SCOREP_Location* location );
+
 /**
  * Trigger a sample with an invalid current calling context,
  *
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2018, 2024,
+ * Copyright (c) 2009-2013, 2018, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -228,6 +228,17 @@ SCOREP_GetBeginEpoch( void );
 uint64_t
 SCOREP_GetEndEpoch( void );
 
+/**
+ * Notify the measurement system that a collective of type
+ * @a collectiveType over all processes completed. Every
+ * `SCOREP_CLOCK_RESYNC_INTERVAL` seconds, a synchronizing collective is used
+ * to measure an additional clock offset, which refines the piecewise-linear
+ * timestamp correction. Must be called by all processes for the same sequence
+ * of collectives. Is a cheap counter check if no resynchronization is due.
+ */
+void
+SCOREP_ResynchronizeClocks( SCOREP_CollectiveType collectiveType );
+
 /**
  * Set an indication that the application aborted.
  */
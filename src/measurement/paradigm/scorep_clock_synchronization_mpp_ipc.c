@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2017,
+ * Copyright (c) 2009-2015, 2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -38,11 +38,13 @@
 #include <scorep_clock_synchronization.h>
 
 #include <SCOREP_Definitions.h>
+#include <SCOREP_RuntimeManagement.h>
 #include <SCOREP_Timer_Ticks.h>
 #include <SCOREP_Timer_Utils.h>
 #include <scorep_ipc.h>
 #include <scorep_environment.h>
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <assert.h>
 
@@ -87,15 +89,14 @@ synchronize_with_worker( int worker, int* min_index )
 }
 
 
-void
-SCOREP_SynchronizeClocks( void )
+/*
+ * Measures the offset of this process' clock to the clock of rank 0 and adds
+ * it as a new clock offset definition. If @a nextResync is not NULL, rank 0
+ * additionally distributes its value to all workers.
+ */
+static void
+measure_clock_offset( uint64_t* nextResync )
 {
-    if ( SCOREP_Timer_ClockIsGlobal() || !SCOREP_Env_DoTracing() )
-    {
-        SCOREP_AddClockOffset( SCOREP_Timer_GetClockTicks(), 0, 0 );
-        return;
-    }
-
     int size = SCOREP_Ipc_GetSize();
     int rank = SCOREP_Ipc_GetRank();
 
@@ -111,6 +112,10 @@ SCOREP_SynchronizeClocks( void )
 
             SCOREP_Ipc_Send( &sync_time, 1, SCOREP_IPC_UINT64_T, worker );
             SCOREP_Ipc_Send( &min_index, 1, SCOREP_IPC_INT, worker );
+            if ( nextResync )
+            {
+                SCOREP_Ipc_Send( nextResync, 1, SCOREP_IPC_UINT64_T, worker );
+            }
         }
 
         offset_time = SCOREP_Timer_GetClockTicks();
@@ -137,6 +142,10 @@ SCOREP_SynchronizeClocks( void )
         int      min_index;
         SCOREP_Ipc_Recv( &sync_time, 1, SCOREP_IPC_UINT64_T, master );
         SCOREP_Ipc_Recv( &min_index, 1, SCOREP_IPC_INT, master );
+        if ( nextResync )
+        {
+            SCOREP_Ipc_Recv( nextResync, 1, SCOREP_IPC_UINT64_T, master );
+        }
 
         offset_time = worker_time[ min_index ];
         offset      = sync_time - offset_time;
@@ -147,6 +156,126 @@ SCOREP_SynchronizeClocks( void )
 }
 
 
+/*
+ * In-run resynchronization state. All processes count the synchronizing
+ * collectives over all processes identically, thus the decision whether to
+ * resynchronize needs no communication. Rank 0 derives the next
+ * resynchronization point from the collective rate it observed since the
+ * last one and distributes it as part of the offset measurement.
+ */
+static struct
+{
+    bool     enabled;
+    uint64_t interval;
+    uint64_t cost;
+    uint64_t collectives;
+    uint64_t next;
+    uint64_t last_collectives;
+    uint64_t last_time;
+} resync;
+
+
+/* A resynchronization may take at most 1/RESYNC_MAX_OVERHEAD of the interval. */
+#define RESYNC_MAX_OVERHEAD 100
+
+
+void
+SCOREP_SynchronizeClocks( void )
+{
+    static bool begin_synchronized = false;
+
+    if ( SCOREP_Timer_ClockIsGlobal() || !SCOREP_Env_DoTracing() )
+    {
+        SCOREP_AddClockOffset( SCOREP_Timer_GetClockTicks(), 0, 0 );
+        return;
+    }
+
+    measure_clock_offset( NULL );
+
+    /* The second synchronization ends the measurement. */
+    resync.enabled = false;
+    if ( begin_synchronized )
+    {
+        return;
+    }
+    begin_synchronized = true;
+
+    uint64_t interval = SCOREP_Env_GetClockResyncInterval();
+    if ( interval == 0 || SCOREP_Ipc_GetSize() == 1 )
+    {
+        return;
+    }
+
+    /* The first synchronizing collective calibrates the collective rate. */
+    resync.enabled          = true;
+    resync.interval         = interval * SCOREP_Timer_GetClockResolution();
+    resync.cost             = 0;
+    resync.collectives      = 0;
+    resync.next             = 1;
+    resync.last_collectives = 0;
+    resync.last_time        = SCOREP_Timer_GetClockTicks();
+}
+
+
+void
+SCOREP_ResynchronizeClocks( SCOREP_CollectiveType collectiveType )
+{
+    if ( !resync.enabled )
+    {
+        return;
+    }
+
+    switch ( collectiveType )
+    {
+        case SCOREP_COLLECTIVE_BARRIER:
+        case SCOREP_COLLECTIVE_ALLGATHER:
+        case SCOREP_COLLECTIVE_ALLGATHERV:
+        case SCOREP_COLLECTIVE_ALLTOALL:
+        case SCOREP_COLLECTIVE_ALLTOALLV:
+        case SCOREP_COLLECTIVE_ALLTOALLW:
+        case SCOREP_COLLECTIVE_ALLREDUCE:
+        case SCOREP_COLLECTIVE_REDUCE_SCATTER:
+        case SCOREP_COLLECTIVE_REDUCE_SCATTER_BLOCK:
+            break;
+        default:
+            /* Not synchronizing, workers would wait for rank 0. */
+            return;
+    }
+
+    if ( ++resync.collectives < resync.next )
+    {
+        return;
+    }
+
+    uint64_t next_resync = 0;
+    uint64_t begin       = SCOREP_Timer_GetClockTicks();
+    if ( SCOREP_Ipc_GetRank() == 0 )
+    {
+        /* Scale the number of collectives since the last resynchronization
+         * to the interval, limited by the cost of the last one. */
+        uint64_t interval = resync.interval;
+        if ( interval < RESYNC_MAX_OVERHEAD * resync.cost )
+        {
+            interval = RESYNC_MAX_OVERHEAD * resync.cost;
+        }
+        uint64_t elapsed  = begin - resync.last_time;
+        double   distance = ( double )( resync.collectives - resync.last_collectives )
+                            * ( double )interval / ( double )( elapsed ? elapsed : 1 );
+        next_resync = resync.collectives
+                      + ( distance < 1.0 ? 1
+                          : distance < ( double )UINT32_MAX ? ( uint64_t )distance
+                          : UINT32_MAX );
+    }
+
+    measure_clock_offset( &next_resync );
+
+    resync.next             = next_resync;
+    resync.last_collectives = resync.collectives;
+    resync.last_time        = SCOREP_Timer_GetClockTicks();
+    resync.cost             = resync.last_time - begin;
+}
+
+
 void
 SCOREP_GetGlobalEpoch( uint64_t* globalEpochBegin, uint64_t* globalEpochEnd )
 {
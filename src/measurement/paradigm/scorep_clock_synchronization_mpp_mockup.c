@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015,
+ * Copyright (c) 2009-2015, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -38,6 +38,7 @@
 #include <scorep_clock_synchronization.h>
 
 #include <SCOREP_Definitions.h>
+#include <SCOREP_RuntimeManagement.h>
 #include <SCOREP_Timer_Ticks.h>
 
 /* *INDENT-OFF* */
@@ -52,6 +53,13 @@ SCOREP_SynchronizeClocks( void )
 }
 
 
+void
+SCOREP_ResynchronizeClocks( SCOREP_CollectiveType collectiveType )
+{
+    /* Nothing to resynchronize without other processes. */
+}
+
+
 void
 SCOREP_GetGlobalEpoch( uint64_t* globalEpochBegin, uint64_t* globalEpochEnd )
 {
@@ -4,7 +4,7 @@
  * Copyright (c) 2014, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2017,
+ * Copyright (c) 2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -37,15 +37,13 @@
 
 #define CEIL( a, b )       ( ( ( a ) / ( b ) ) + ( ( ( a ) % ( b ) ) > 0 ? 1 : 0 ) )
 #define ROUNDUPTO( a, b )  ( CEIL( a, b ) * b )
-#define MIN( a, b )        ( a > b ? a : b )
+#define MIN( a, b )        ( ( a ) < ( b ) ? ( a ) : ( b ) )
 
-#define INVALID_TRANSFER_STATE     -1
+/* Initial size of the staging buffers for collective operations, they grow on demand */
+#define INITIAL_BUFFER_SIZE         ( 8 * 1024 )
 
-#define TRANSFER_START              1
-#define TRANSFER_SENDER_COMPLETE    2
-#define TRANSFER_RECEIVER_COMPLETE  3
-
-#define BUFFER_SIZE                 ( 8 * 1024 )
+/* Point-to-point messages are pipelined through two chunks of this size */
+#define P2P_CHUNK_SIZE              ( 32 * 1024 )
 
 struct SCOREP_Ipc_Group
 {
@@ -82,11 +80,28 @@ resolve_group_size( SCOREP_Ipc_Group* group )
 }
 
 
-static void*   symmetric_buffer_a;
-static void*   symmetric_buffer_b;
-static int*    transfer_counter;
-static int*    transfer_status;
-static int*    current_ready_pe;
+/* Staging buffers for collective operations */
+static void*      symmetric_buffer_a;
+static void*      symmetric_buffer_b;
+static size_t     symmetric_buffer_size;
+/* Staging size and block offset distributed by the root of a collective */
+static long long* staging_layout;
+
+/*
+ * Point-to-point messages are put into the two chunks of the p2p_buffer of the
+ * receiver. The receiver hands out credits to the sender it currently receives
+ * from, one per free chunk, the sender announces each delivered chunk. Both
+ * are running totals per pair of PEs, hence they never need to be reset.
+ */
+static void* p2p_buffer;
+/* Number of chunks delivered into our p2p_buffer, per sending PE */
+static int*  chunks_delivered;
+/* Number of chunks we may put into the p2p_buffer of a receiving PE */
+static int*  chunk_credits;
+/* Local totals of chunks sent to and received from each PE */
+static int*  chunks_sent;
+static int*  chunks_received;
+
 static long*   barrier_psync;
 static long*   bcast_psync;
 static long*   collect_psync;
@@ -97,6 +112,72 @@ static void*
 get_pwork( size_t size,
            int    count );
 
+
+/*
+ * Grows the staging buffers for collective operations to at least @a size
+ * bytes. pshrealloc is a collective over all PEs, hence all need to call this
+ * with the same size. SHMEM IPC groups always span all PEs.
+ */
+static void
+require_buffer_size( size_t size )
+{
+    if ( size <= symmetric_buffer_size )
+    {
+        return;
+    }
+
+    size_t new_size = symmetric_buffer_size;
+    while ( new_size < size )
+    {
+        new_size *= 2;
+    }
+
+    symmetric_buffer_a = pshrealloc( symmetric_buffer_a, new_size );
+    symmetric_buffer_b = pshrealloc( symmetric_buffer_b, new_size );
+    UTILS_BUG_ON( !symmetric_buffer_a || !symmetric_buffer_b,
+                  "Cannot allocate symmetric buffers of size %zu", new_size );
+    symmetric_buffer_size = new_size;
+}
+
+
+/*
+ * The root passes the staging size it requires and the offset of their block
+ * in its staging buffer to all PEs of the group, if only the root knows them.
+ * The staging buffers are grown accordingly.
+ */
+static void
+distribute_layout( int           rank,
+                   int           start,
+                   int           stride,
+                   int           size,
+                   int           root,
+                   size_t        required,
+                   const size_t* offsets )
+{
+    if ( rank == root )
+    {
+        for ( int i = 0; i < size; i++ )
+        {
+            long long layout[ 2 ] = { required, offsets ? offsets[ i ] : 0 };
+            int       pe          = start + ( i << stride );
+            if ( pe == root )
+            {
+                memcpy( staging_layout, layout, sizeof( layout ) );
+            }
+            else
+            {
+                pshmem_putmem( staging_layout, layout, sizeof( layout ), pe );
+            }
+        }
+    }
+
+    /* Completes the puts */
+    pshmem_barrier( start, stride, size, barrier_psync );
+
+    require_buffer_size( staging_layout[ 0 ] );
+}
+
+
 /*
  * IPC API functions
  */
@@ -142,23 +223,32 @@ SCOREP_Ipc_Init( void )
 #undef SCOREP_SHMEM_DOUBLE
 
     /* Allocate memory in symmetric heap */
-    symmetric_buffer_a = pshmalloc( BUFFER_SIZE );
+    symmetric_buffer_size = INITIAL_BUFFER_SIZE;
+    symmetric_buffer_a    = pshmalloc( symmetric_buffer_size );
     UTILS_ASSERT( symmetric_buffer_a );
 
-    symmetric_buffer_b = pshmalloc( BUFFER_SIZE );
+    symmetric_buffer_b = pshmalloc( symmetric_buffer_size );
     UTILS_ASSERT( symmetric_buffer_b );
 
-    transfer_status = ( int* )pshmalloc( sizeof( int ) );
-    UTILS_ASSERT( transfer_status );
-    *transfer_status = INVALID_TRANSFER_STATE;
+    staging_layout = pshmalloc( 2 * sizeof( long long ) );
+    UTILS_ASSERT( staging_layout );
+
+    p2p_buffer = pshmalloc( 2 * P2P_CHUNK_SIZE );
+    UTILS_ASSERT( p2p_buffer );
 
-    current_ready_pe = ( int* )pshmalloc( sizeof( int ) );
-    UTILS_ASSERT( current_ready_pe );
-    *current_ready_pe = -1;
+    chunks_delivered = ( int* )pshmalloc( scorep_ipc_group_world.pe_size * sizeof( int ) );
+    UTILS_ASSERT( chunks_delivered );
+    memset( chunks_delivered, 0, scorep_ipc_group_world.pe_size * sizeof( int ) );
 
-    transfer_counter = ( int* )pshmalloc( scorep_ipc_group_world.pe_size * sizeof( int ) );
-    UTILS_ASSERT( transfer_counter );
-    memset( transfer_counter, 0, scorep_ipc_group_world.pe_size * sizeof( int ) );
+    chunk_credits = ( int* )pshmalloc( scorep_ipc_group_world.pe_size * sizeof( int ) );
+    UTILS_ASSERT( chunk_credits );
+    memset( chunk_credits, 0, scorep_ipc_group_world.pe_size * sizeof( int ) );
+
+    chunks_sent = calloc( scorep_ipc_group_world.pe_size, sizeof( int ) );
+    UTILS_ASSERT( chunks_sent );
+
+    chunks_received = calloc( scorep_ipc_group_world.pe_size, sizeof( int ) );
+    UTILS_ASSERT( chunks_received );
 
     barrier_psync = pshmalloc( _SHMEM_BARRIER_SYNC_SIZE * sizeof( long ) );
     UTILS_ASSERT( barrier_psync );
@@ -207,17 +297,27 @@ SCOREP_Ipc_Finalize( void )
     pshfree( symmetric_buffer_b );
     symmetric_buffer_b = NULL;
 
-    UTILS_ASSERT( transfer_status );
-    pshfree( transfer_status );
-    transfer_status = NULL;
+    UTILS_ASSERT( staging_layout );
+    pshfree( staging_layout );
+    staging_layout = NULL;
+
+    UTILS_ASSERT( p2p_buffer );
+    pshfree( p2p_buffer );
+    p2p_buffer = NULL;
 
-    UTILS_ASSERT( current_ready_pe );
-    pshfree( current_ready_pe );
-    current_ready_pe = NULL;
+    UTILS_ASSERT( chunks_delivered );
+    pshfree( chunks_delivered );
+    chunks_delivered = NULL;
 
-    UTILS_ASSERT( transfer_counter );
-    pshfree( transfer_counter );
-    transfer_counter = NULL;
+    UTILS_ASSERT( chunk_credits );
+    pshfree( chunk_credits );
+    chunk_credits = NULL;
+
+    free( chunks_sent );
+    chunks_sent = NULL;
+
+    free( chunks_received );
+    chunks_received = NULL;
 
     UTILS_ASSERT( barrier_psync );
     pshfree( barrier_psync );
@@ -264,6 +364,11 @@ SCOREP_IpcGroup_GetRank( SCOREP_Ipc_Group* group )
 }
 
 
+/*
+ * Sender and receiver need to agree on the size of the message, which is
+ * pipelined in chunks. The sender does not wait for the receiver to consume
+ * the last chunks.
+ */
 int
 SCOREP_IpcGroup_Send( SCOREP_Ipc_Group*   group,
                       const void*         buf,
@@ -271,51 +376,33 @@ SCOREP_IpcGroup_Send( SCOREP_Ipc_Group*   group,
                       SCOREP_Ipc_Datatype datatype,
                       int                 dest )
 {
-    UTILS_BUG_ON( count * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  count * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
-
     UTILS_DEBUG_ENTRY( "buf %p, count %i, data type %i, dest %i",
                        buf, count, datatype, dest );
 
-    /* Increase counter which marks current transfer */
-    transfer_counter[ dest ]++;
-
-    /* Wait until previous data transfers are completed */
-    int remote_transfer_counter;
-    int rank = SCOREP_Ipc_GetRank();
-    do
+    const char* data  = buf;
+    size_t      bytes = ( size_t )count * sizeof_ipc_datatypes[ datatype ];
+    int         rank  = SCOREP_Ipc_GetRank();
+    while ( bytes > 0 )
     {
-        remote_transfer_counter = pshmem_int_g( &( transfer_counter[ rank ] ), dest );
-    }
-    while ( remote_transfer_counter != ( ( volatile int* )transfer_counter )[ dest ] );
-
-    /* Wait until receiver is ready */
-    pshmem_int_wait_until( transfer_status, SHMEM_CMP_EQ, TRANSFER_START );
+        int    chunk       = chunks_sent[ dest ]++;
+        size_t chunk_bytes = MIN( bytes, P2P_CHUNK_SIZE );
 
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
+        /* Wait until the receiver has a free chunk for us */
+        pshmem_int_wait_until( &chunk_credits[ dest ], SHMEM_CMP_GT, chunk );
 
-    /* Send operation */
-    pshmem_putmem( symmetric_buffer_a,
-                   buf,
-                   count * sizeof_ipc_datatypes[ datatype ],
-                   dest );
+        pshmem_putmem( ( char* )p2p_buffer + ( chunk % 2 ) * P2P_CHUNK_SIZE,
+                       data,
+                       chunk_bytes,
+                       dest );
 
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
+        /* Ensure the data arrives before its announcement */
+        pshmem_fence();
 
-    /* Set transfer status of sender to completed */
-    pshmem_int_p( transfer_status, TRANSFER_SENDER_COMPLETE, dest );
+        pshmem_int_p( &chunks_delivered[ rank ], chunk + 1, dest );
 
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
-
-    /* Wait until receiver has finished */
-    pshmem_int_wait_until( transfer_status, SHMEM_CMP_EQ, TRANSFER_RECEIVER_COMPLETE );
-
-    /* Reset status flags */
-    *transfer_status = INVALID_TRANSFER_STATE;
+        data  += chunk_bytes;
+        bytes -= chunk_bytes;
+    }
 
     return 0;
 }
@@ -331,41 +418,44 @@ SCOREP_IpcGroup_Recv( SCOREP_Ipc_Group*   group,
     UTILS_DEBUG_ENTRY( "buf %p, count %i, data type %i, source %i",
                        buf, count, datatype, source );
 
-    /* Increase counter which marks current transfer */
-    transfer_counter[ source ]++;
-
-    /* Wait until previous data transfers are completed */
-    int remote_transfer_counter;
-    int rank = SCOREP_Ipc_GetRank();
-    do
+    char*  data       = buf;
+    size_t bytes      = ( size_t )count * sizeof_ipc_datatypes[ datatype ];
+    int    num_chunks = CEIL( bytes, P2P_CHUNK_SIZE );
+    int    first      = chunks_received[ source ];
+    int    rank       = SCOREP_Ipc_GetRank();
+    if ( num_chunks == 0 )
     {
-        remote_transfer_counter = pshmem_int_g( &transfer_counter[ rank ], source );
+        return 0;
     }
-    while ( remote_transfer_counter != ( ( volatile int* )transfer_counter )[ source ] );
-
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
 
-    /* Signal start of data transfer */
-    pshmem_int_p( transfer_status, TRANSFER_START, source );
+    /* Hand out credits for both chunks of our staging area, the fence keeps
+     * the credits in order */
+    pshmem_fence();
+    pshmem_int_p( &chunk_credits[ rank ], first + MIN( num_chunks, 2 ), source );
 
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
-
-    /* Wait until sender has finished data transfer */
-    pshmem_int_wait_until( transfer_status, SHMEM_CMP_EQ, TRANSFER_SENDER_COMPLETE );
+    for ( int i = 0; i < num_chunks; i++ )
+    {
+        int    chunk       = first + i;
+        size_t chunk_bytes = MIN( bytes, P2P_CHUNK_SIZE );
 
-    /* Copy symmetric memory block to buffer */
-    memcpy( buf, symmetric_buffer_a, count * sizeof_ipc_datatypes[ datatype ] );
+        /* Wait until sender has delivered the chunk */
+        pshmem_int_wait_until( &chunks_delivered[ source ], SHMEM_CMP_GT, chunk );
 
-    /* Signal end of data transfer */
-    pshmem_int_p( transfer_status, TRANSFER_RECEIVER_COMPLETE, source );
+        memcpy( data,
+                ( char* )p2p_buffer + ( chunk % 2 ) * P2P_CHUNK_SIZE,
+                chunk_bytes );
 
-    /* Use shmem_quiet operation to ensure ordering of put operations */
-    pshmem_quiet();
+        /* The chunk is free again for the remaining ones */
+        if ( i + 2 < num_chunks )
+        {
+            pshmem_fence();
+            pshmem_int_p( &chunk_credits[ rank ], chunk + 3, source );
+        }
 
-    /* Reset status flags */
-    *transfer_status = INVALID_TRANSFER_STATE;
+        data  += chunk_bytes;
+        bytes -= chunk_bytes;
+    }
+    chunks_received[ source ] = first + num_chunks;
 
     return 0;
 }
@@ -408,9 +498,7 @@ SCOREP_IpcGroup_Bcast( SCOREP_Ipc_Group*   group,
     {
         num_elements = ROUNDUPTO( count, 4 );
     }
-    UTILS_BUG_ON( num_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  num_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+    require_buffer_size( num_elements * sizeof_ipc_datatypes[ datatype ] );
 
     /* Copy buffer to symmetric memory block */
     if ( root == rank )
@@ -474,6 +562,10 @@ SCOREP_IpcGroup_Bcast( SCOREP_Ipc_Group*   group,
 }
 
 
+/*
+ * Each PE puts its block directly into the staging buffer of the root. Unlike
+ * fcollect, this transfers the data only once.
+ */
 int
 SCOREP_IpcGroup_Gather( SCOREP_Ipc_Group*   group,
                         const void*         sendbuf,
@@ -482,92 +574,37 @@ SCOREP_IpcGroup_Gather( SCOREP_Ipc_Group*   group,
                         SCOREP_Ipc_Datatype datatype,
                         int                 root )
 {
-    int rank         = SCOREP_Ipc_GetRank();
-    int start        = resolve_group_start( group );
-    int stride       = resolve_group_stride( group );
-    int size         = resolve_group_size( group );
-    int num_elements = count;
+    int    rank   = SCOREP_Ipc_GetRank();
+    int    start  = resolve_group_start( group );
+    int    stride = resolve_group_stride( group );
+    int    size   = resolve_group_size( group );
+    size_t bytes  = ( size_t )count * sizeof_ipc_datatypes[ datatype ];
 
     UTILS_DEBUG_ENTRY( "(%d, %d, %d, %d/%d, %d)",
                        start, stride, size, count, datatype, root );
 
-    if ( datatype == SCOREP_IPC_BYTE ||
-         datatype == SCOREP_IPC_CHAR ||
-         datatype == SCOREP_IPC_UNSIGNED_CHAR )
-    {
-        num_elements = ROUNDUPTO( count, 4 );
-    }
-    UTILS_BUG_ON( size * num_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  size * num_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
-
-    /* Copy buffer to symmetric memory block */
-    memcpy( symmetric_buffer_a, sendbuf, count * sizeof_ipc_datatypes[ datatype ] );
+    require_buffer_size( size * bytes );
 
+    /* Wait until the staging buffer of root is free */
     pshmem_barrier( start, stride, size, barrier_psync );
 
-    /* Broadcast operation */
-    int num_elements_sent;
-    switch ( datatype )
+    size_t offset = ( ( rank - start ) >> stride ) * bytes;
+    if ( rank == root )
     {
-        case SCOREP_IPC_BYTE:
-        case SCOREP_IPC_CHAR:
-        case SCOREP_IPC_UNSIGNED_CHAR:
-            num_elements_sent = CEIL( count, 4 );
-            pshmem_fcollect32( symmetric_buffer_b,
-                               symmetric_buffer_a,
-                               num_elements_sent,
-                               start, stride, size,
-                               collect_psync );
-            break;
-
-        case SCOREP_IPC_INT:
-        case SCOREP_IPC_UNSIGNED:
-        case SCOREP_IPC_INT32_T:
-        case SCOREP_IPC_UINT32_T:
-            pshmem_fcollect32( symmetric_buffer_b,
-                               symmetric_buffer_a,
-                               count,
-                               start, stride, size,
-                               collect_psync );
-            break;
-
-        case SCOREP_IPC_INT64_T:
-        case SCOREP_IPC_UINT64_T:
-        case SCOREP_IPC_DOUBLE:
-            pshmem_fcollect64( symmetric_buffer_b,
-                               symmetric_buffer_a,
-                               count,
-                               start, stride, size,
-                               collect_psync );
-            break;
-
-        default:
-            UTILS_BUG( "Gather: Invalid IPC datatype: %d", datatype );
+        memcpy( ( char* )symmetric_buffer_b + offset, sendbuf, bytes );
+    }
+    else
+    {
+        pshmem_putmem( ( char* )symmetric_buffer_b + offset, sendbuf, bytes, root );
     }
 
+    /* Completes the puts */
     pshmem_barrier( start, stride, size, barrier_psync );
 
     /* Copy symmetric memory block to buffer */
     if ( rank == root )
     {
-        if ( datatype == SCOREP_IPC_BYTE ||
-             datatype == SCOREP_IPC_CHAR ||
-             datatype == SCOREP_IPC_UNSIGNED_CHAR )
-        {
-            int recvbuf_index = 0;
-            for ( int i = 0; i < size; i++ )
-            {
-                for ( int j = 0; j < count; j++ )
-                {
-                    ( ( char* )recvbuf )[ recvbuf_index++ ] = ( ( char* )symmetric_buffer_b )[ j + ( i * count ) ];
-                }
-            }
-        }
-        else
-        {
-            memcpy( recvbuf, symmetric_buffer_b, size * count * sizeof_ipc_datatypes[ datatype ] );
-        }
+        memcpy( recvbuf, symmetric_buffer_b, size * bytes );
     }
 
     pshmem_barrier( start, stride, size, barrier_psync );
@@ -576,6 +613,10 @@ SCOREP_IpcGroup_Gather( SCOREP_Ipc_Group*   group,
 }
 
 
+/*
+ * Like SCOREP_IpcGroup_Gather, the root first passes the offsets of the blocks
+ * to the PEs.
+ */
 int
 SCOREP_IpcGroup_Gatherv( SCOREP_Ipc_Group*   group,
                          const void*         sendbuf,
@@ -593,135 +634,41 @@ SCOREP_IpcGroup_Gatherv( SCOREP_Ipc_Group*   group,
     UTILS_DEBUG_ENTRY( "(%d, %d, %d, %d/%d, %d)",
                        start, stride, size, sendcount, datatype, root );
 
-    int sendcount_extra = 0;
-#if HAVE( BROKEN_SHMEM_COLLECT )
-    sendcount_extra = 1;
-#endif
-
-    /*
-     * Sum up 'recvcount's from all processing elements
-     * and allocate symmetric memory blocks
-     */
-    int total_number_of_recv_elements = 0;
-    if ( datatype == SCOREP_IPC_BYTE ||
-         datatype == SCOREP_IPC_CHAR ||
-         datatype == SCOREP_IPC_UNSIGNED_CHAR )
+    size_t* offsets = NULL;
+    size_t  total   = 0;
+    if ( rank == root )
     {
-        int num_send_elements = ROUNDUPTO( sendcount + sendcount_extra, 4 );
-        UTILS_BUG_ON( num_send_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                      "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                      num_send_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
-
-        if ( rank == root )
+        offsets = malloc( size * sizeof( *offsets ) );
+        UTILS_ASSERT( offsets );
+        for ( int i = 0; i < size; i++ )
         {
-            for ( int i = 0; i < SCOREP_Ipc_GetSize(); i++ )
-            {
-                int num_recv_elements = ROUNDUPTO( recvcnts[ i ] + sendcount_extra, 4 );
-                total_number_of_recv_elements += num_recv_elements;
-            }
+            offsets[ i ] = total;
+            total       += ( size_t )recvcnts[ i ] * sizeof_ipc_datatypes[ datatype ];
         }
     }
-    else
-    {
-        UTILS_BUG_ON( ( sendcount + sendcount_extra ) * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                      "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                      ( sendcount + sendcount_extra ) * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
 
-        if ( rank == root )
-        {
-            for ( int i = 0; i < SCOREP_Ipc_GetSize(); i++ )
-            {
-                total_number_of_recv_elements += recvcnts[ i ] + sendcount_extra;
-            }
-        }
-    }
+    /* Also waits until the staging buffer of root is free */
+    distribute_layout( rank, start, stride, size, root, total, offsets );
+    free( offsets );
+
+    size_t bytes  = ( size_t )sendcount * sizeof_ipc_datatypes[ datatype ];
+    size_t offset = staging_layout[ 1 ];
     if ( rank == root )
     {
-        UTILS_BUG_ON( total_number_of_recv_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                      "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                      total_number_of_recv_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+        memcpy( ( char* )symmetric_buffer_b + offset, sendbuf, bytes );
     }
-
-    /* Copy buffer to symmetric memory block */
-    memcpy( symmetric_buffer_a, sendbuf, sendcount * sizeof_ipc_datatypes[ datatype ] );
-    memset( ( char* )symmetric_buffer_a + sendcount * sizeof_ipc_datatypes[ datatype ],
-            0, sendcount_extra * sizeof_ipc_datatypes[ datatype ] );
-
-    pshmem_barrier( start, stride, size, barrier_psync );
-
-    /* Broadcast operation */
-    int num_elements_sent;
-    switch ( datatype )
+    else
     {
-        case SCOREP_IPC_BYTE:
-        case SCOREP_IPC_CHAR:
-        case SCOREP_IPC_UNSIGNED_CHAR:
-            num_elements_sent = CEIL( sendcount + sendcount_extra, 4 );
-            pshmem_collect32( symmetric_buffer_b,
-                              symmetric_buffer_a,
-                              num_elements_sent,
-                              start, stride, size,
-                              collect_psync );
-            break;
-
-        case SCOREP_IPC_INT:
-        case SCOREP_IPC_UNSIGNED:
-        case SCOREP_IPC_INT32_T:
-        case SCOREP_IPC_UINT32_T:
-            pshmem_collect32( symmetric_buffer_b,
-                              symmetric_buffer_a,
-                              sendcount + sendcount_extra,
-                              start, stride, size,
-                              collect_psync );
-            break;
-
-        case SCOREP_IPC_INT64_T:
-        case SCOREP_IPC_UINT64_T:
-        case SCOREP_IPC_DOUBLE:
-            pshmem_collect64( symmetric_buffer_b,
-                              symmetric_buffer_a,
-                              sendcount + sendcount_extra,
-                              start, stride, size,
-                              collect_psync );
-            break;
-
-        default:
-            UTILS_BUG( "Gatherv: Invalid IPC datatype: %d", datatype );
+        pshmem_putmem( ( char* )symmetric_buffer_b + offset, sendbuf, bytes, root );
     }
 
+    /* Completes the puts */
     pshmem_barrier( start, stride, size, barrier_psync );
 
     /* Copy symmetric memory block to buffer */
     if ( rank == root )
     {
-        if ( datatype == SCOREP_IPC_BYTE ||
-             datatype == SCOREP_IPC_CHAR ||
-             datatype == SCOREP_IPC_UNSIGNED_CHAR )
-        {
-            int recvbuf_index  = 0;
-            int current_offset = 0;
-            for ( int i = 0; i < size; i++ )
-            {
-                for ( int j = 0; j < recvcnts[ i ]; j++ )
-                {
-                    ( ( char* )recvbuf )[ recvbuf_index++ ] = ( ( char* )symmetric_buffer_b )[ j + current_offset ];
-                }
-                current_offset += ROUNDUPTO( recvcnts[ i ] + sendcount_extra, 4 );
-            }
-        }
-        else
-        {
-            size_t recvbuf_offset   = 0;
-            size_t symmetric_offset = 0;
-            for ( int i = 0; i < size; i++ )
-            {
-                memcpy( ( char* )recvbuf + recvbuf_offset,
-                        ( char* )symmetric_buffer_b + symmetric_offset,
-                        recvcnts[ i ] * sizeof_ipc_datatypes[ datatype ] );
-                recvbuf_offset   += recvcnts[ i ] * sizeof_ipc_datatypes[ datatype ];
-                symmetric_offset += ( recvcnts[ i ] + sendcount_extra ) * sizeof_ipc_datatypes[ datatype ];
-            }
-        }
+        memcpy( recvbuf, symmetric_buffer_b, total );
     }
 
     pshmem_barrier( start, stride, size, barrier_psync );
@@ -756,9 +703,7 @@ SCOREP_IpcGroup_Allgather( SCOREP_Ipc_Group*   group,
     {
         num_elements = ROUNDUPTO( count, 4 );
     }
-    UTILS_BUG_ON( size * num_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  size * num_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+    require_buffer_size( size * num_elements * sizeof_ipc_datatypes[ datatype ] );
 
     /* Copy buffer to symmetric memory block */
     memcpy( symmetric_buffer_a, sendbuf, count * sizeof_ipc_datatypes[ datatype ] );
@@ -861,9 +806,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
     {
         num_elements = ROUNDUPTO( count, 2 );
     }
-    UTILS_BUG_ON( num_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  num_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+    require_buffer_size( num_elements * sizeof_ipc_datatypes[ datatype ] );
 
     /* Copy buffer to symmetric memory block */
     memcpy( symmetric_buffer_a, sendbuf, count * sizeof_ipc_datatypes[ datatype ] );
@@ -984,7 +927,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_BOR:
@@ -992,7 +935,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
                                            symmetric_buffer_a,
                                            count,
                                            start, stride, size,
-                                           ( long long* )pwork,
+                                           get_pwork( sizeof( long long ), count ),
                                            reduce_psync );
                 break;
             case SCOREP_IPC_MIN:
@@ -1000,7 +943,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_MAX:
@@ -1008,7 +951,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_SUM:
@@ -1016,7 +959,7 @@ SCOREP_IpcGroup_Reduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             default:
@@ -1064,9 +1007,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
     {
         num_elements = ROUNDUPTO( count, 2 );
     }
-    UTILS_BUG_ON( num_elements * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  num_elements * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+    require_buffer_size( num_elements * sizeof_ipc_datatypes[ datatype ] );
 
     /* Copy buffer to symmetric memory block */
     memcpy( symmetric_buffer_a, sendbuf, count * sizeof_ipc_datatypes[ datatype ] );
@@ -1187,7 +1128,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_BOR:
@@ -1195,7 +1136,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
                                            symmetric_buffer_a,
                                            count,
                                            start, stride, size,
-                                           ( long long* )pwork,
+                                           get_pwork( sizeof( long long ), count ),
                                            reduce_psync );
                 break;
             case SCOREP_IPC_MIN:
@@ -1203,7 +1144,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_MAX:
@@ -1211,7 +1152,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             case SCOREP_IPC_SUM:
@@ -1219,7 +1160,7 @@ SCOREP_IpcGroup_Allreduce( SCOREP_Ipc_Group*    group,
                                             symmetric_buffer_a,
                                             count,
                                             start, stride, size,
-                                            ( long long* )pwork,
+                                            get_pwork( sizeof( long long ), count ),
                                             reduce_psync );
                 break;
             default:
@@ -1250,9 +1191,7 @@ SCOREP_IpcGroup_Scatter( SCOREP_Ipc_Group*   group,
                          SCOREP_Ipc_Datatype datatype,
                          int                 root )
 {
-    UTILS_BUG_ON( count * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  count * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
+    require_buffer_size( count * sizeof_ipc_datatypes[ datatype ] );
 
     int rank   = SCOREP_Ipc_GetRank();
     int start  = resolve_group_start( group );
@@ -1314,10 +1253,6 @@ SCOREP_IpcGroup_Scatterv( SCOREP_Ipc_Group*   group,
                           SCOREP_Ipc_Datatype datatype,
                           int                 root )
 {
-    UTILS_BUG_ON( recvcount * sizeof_ipc_datatypes[ datatype ] > BUFFER_SIZE,
-                  "SHMEM symmetric buffer of insufficient size. %d bytes requested, %d bytes available.",
-                  recvcount * sizeof_ipc_datatypes[ datatype ], BUFFER_SIZE );
-
     int rank   = SCOREP_Ipc_GetRank();
     int start  = resolve_group_start( group );
     int stride = resolve_group_stride( group );
@@ -1326,6 +1261,21 @@ SCOREP_IpcGroup_Scatterv( SCOREP_Ipc_Group*   group,
     UTILS_DEBUG_ENTRY( "(%d, %d, %d, %d/%d, %d)",
                        start, stride, size, recvcount, datatype, root );
 
+    /* The staging buffers need to hold the largest block */
+    size_t max_bytes = 0;
+    if ( rank == root )
+    {
+        for ( int i = 0; i < size; i++ )
+        {
+            size_t bytes = ( size_t )sendcounts[ i ] * sizeof_ipc_datatypes[ datatype ];
+            if ( bytes > max_bytes )
+            {
+                max_bytes = bytes;
+            }
+        }
+    }
+    distribute_layout( rank, start, stride, size, root, max_bytes, NULL );
+
     if ( rank == root )
     {
         /* root is the only sender */
@@ -1382,7 +1332,7 @@ get_pwork( size_t size,
            int    count )
 {
     size_t nreduce_size = ( ( count / 2 ) + 1 ) * size;
-    if ( nreduce_size < current_pwork_size )
+    if ( nreduce_size > current_pwork_size )
     {
         pwork = pshrealloc( pwork, nreduce_size );
         UTILS_BUG_ON( !pwork, "Cannot allocate symmetric work array of size %zu",
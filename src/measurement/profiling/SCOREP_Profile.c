@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2018, 2020-2022, 2024,
+ * Copyright (c) 2009-2018, 2020-2022, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -47,7 +47,9 @@
 
 #include <SCOREP_Memory.h>
 #include <SCOREP_Timer_Ticks.h>
+#include <SCOREP_Timer_Utils.h>
 #include <SCOREP_Definitions.h>
+#include <SCOREP_Events.h>
 #include <SCOREP_Metric_Management.h>
 #include <SCOREP_Unwinding.h>
 #include <scorep_location_management.h>
@@ -101,6 +103,9 @@ static void parameter_uint64( SCOREP_Location* thread, uint64_t timestamp, SCORE
 
 static void write_sparse_metrics_enter( SCOREP_Location* location, uint64_t timestamp, SCOREP_SamplingSetHandle samplingSet, const uint64_t* values );
 static void write_sparse_metrics_exit( SCOREP_Location* location, uint64_t timestamp, SCOREP_SamplingSetHandle samplingSet, const uint64_t* values );
+
+static void enter_region( SCOREP_Location* location, uint64_t timestamp, SCOREP_RegionHandle regionHandle, uint64_t* metricValues );
+static void exit_region( SCOREP_Location* location, uint64_t timestamp, SCOREP_RegionHandle regionHandle, uint64_t* metricValues );
 /* *INDENT-ON* */
 
 static inline void
@@ -156,6 +161,7 @@ SCOREP_Profile_Initialize( size_t substrateId )
     {
         scorep_profile_param_instance =
             SCOREP_Definitions_NewParameter( "instance", SCOREP_PARAMETER_INT64 );
+        scorep_profile_init_parameter_buckets();
     }
     else
     {
@@ -601,6 +607,34 @@ on_location_deactivation( SCOREP_Location* locationData,
 }
 
 
+/**
+   Records the calibrated cost of an event and the number of enter and exit
+   events of every location as location properties.
+ */
+static void
+report_overhead( void )
+{
+    double ns_per_event = scorep_profile_ticks_per_event * 1e9
+                          / ( double )SCOREP_Timer_GetClockResolution();
+
+    for ( scorep_profile_node* root = scorep_profile.first_root_node;
+          root != NULL;
+          root = root->next_sibling )
+    {
+        SCOREP_Profile_LocationData* location =
+            scorep_profile_type_get_location_data( root->type_specific_data );
+
+        /* An uint64_t has up to 20 decimal digits. */
+        SCOREP_Location_AddLocationProperty( location->location_data,
+                                             "PROFILE_EVENTS", 21, "%" PRIu64,
+                                             location->number_of_events );
+        SCOREP_Location_AddLocationProperty( location->location_data,
+                                             "PROFILE_EVENT_COST", 32, "%.1f ns",
+                                             ns_per_event );
+    }
+}
+
+
 void
 SCOREP_Profile_Process( void )
 {
@@ -653,6 +687,11 @@ SCOREP_Profile_Process( void )
         while ( node != NULL );
     }
 
+    if ( scorep_profile_estimate_overhead )
+    {
+        report_overhead();
+    }
+
     /* Substitute collapse nodes by normal region nodes */
     scorep_profile_process_collapse();
 
@@ -722,6 +761,7 @@ SCOREP_Profile_Enter( SCOREP_Location*    thread,
     /* Check wether we exceed the depth */
     SCOREP_Profile_LocationData* location = scorep_profile_get_profile_data( thread );
     location->current_depth++;
+    location->number_of_events++;
 
     /* Enter on current position */
     scorep_profile_node* current_node = scorep_profile_get_current_node( location );
@@ -776,6 +816,7 @@ SCOREP_Profile_Exit( SCOREP_Location*    thread,
 
     SCOREP_PROFILE_ASSURE_INITIALIZED;
     location = scorep_profile_get_profile_data( thread );
+    location->number_of_events++;
 
     /* Store task metrics if exiting a parallel region */
     if ( type == SCOREP_REGION_PARALLEL )
@@ -807,6 +848,70 @@ SCOREP_Profile_Exit( SCOREP_Location*    thread,
 }
 
 
+#define OVERHEAD_CALIBRATION_ROUNDS 10
+#define OVERHEAD_CALIBRATION_PAIRS  50
+
+/**
+   Calibrates the cost of one enter or exit event for the estimation of the
+   measurement overhead. The events are recorded the same way as enter_region()
+   and exit_region() do, including the timer and dense metric reads, but into
+   a scratch call tree, which is released afterwards. The fastest of several
+   rounds is taken, to exclude interrupts of the calibration.
+   @param location The location that executes the program begin event.
+ */
+static void
+calibrate_overhead( SCOREP_Location* location )
+{
+    SCOREP_Profile_LocationData* profile_location = scorep_profile_get_profile_data( location );
+    scorep_profile_node*         current_node     = scorep_profile_get_current_node( profile_location );
+    uint64_t                     number_of_events = profile_location->number_of_events;
+    SCOREP_RegionHandle          region           = SCOREP_GetProgramRegion();
+    scorep_profile_type_data_t   node_data;
+    memset( &node_data, 0, sizeof( node_data ) );
+    scorep_profile_type_set_location_data( &node_data, profile_location );
+
+    scorep_profile_node* scratch_node =
+        scorep_profile_create_node( profile_location,
+                                    NULL,
+                                    SCOREP_PROFILE_NODE_THREAD_ROOT,
+                                    node_data, 0,
+                                    SCOREP_PROFILE_TASK_CONTEXT_TIED );
+    if ( scratch_node == NULL )
+    {
+        return;
+    }
+    scorep_profile_set_current_node( profile_location, scratch_node );
+
+    uint64_t min_ticks = UINT64_MAX;
+    for ( int round = 0; round < OVERHEAD_CALIBRATION_ROUNDS; round++ )
+    {
+        uint64_t start = SCOREP_Timer_GetClockTicks();
+        for ( int i = 0; i < OVERHEAD_CALIBRATION_PAIRS; i++ )
+        {
+            uint64_t timestamp = SCOREP_Timer_GetClockTicks();
+            enter_region( location, timestamp, region, SCOREP_Metric_Read( location ) );
+            timestamp = SCOREP_Timer_GetClockTicks();
+            exit_region( location, timestamp, region, SCOREP_Metric_Read( location ) );
+        }
+        uint64_t end = SCOREP_Timer_GetClockTicks();
+        if ( end > start && end - start < min_ticks )
+        {
+            min_ticks = end - start;
+        }
+    }
+
+    if ( min_ticks != UINT64_MAX )
+    {
+        scorep_profile_ticks_per_event = ( double )min_ticks
+                                         / ( 2 * OVERHEAD_CALIBRATION_PAIRS );
+    }
+
+    scorep_profile_set_current_node( profile_location, current_node );
+    scorep_profile_release_subtree( profile_location, scratch_node );
+    profile_location->number_of_events = number_of_events;
+}
+
+
 static void
 program_begin( SCOREP_Location*     location,
                uint64_t             timestamp,
@@ -817,6 +922,11 @@ program_begin( SCOREP_Location*     location,
                uint64_t             pid,
                uint64_t             tid )
 {
+    if ( scorep_profile_estimate_overhead )
+    {
+        calibrate_overhead( location );
+    }
+
     uint64_t* metric_values = SCOREP_Metric_Read( location );
     SCOREP_Profile_Enter( location,
                           timestamp,
@@ -1326,7 +1436,8 @@ parameter_uint64( SCOREP_Location*       thread,
 
     /* Initialize type specific data */
     scorep_profile_type_set_parameter_handle( &node_data, param );
-    scorep_profile_type_set_int_value( &node_data, value );
+    scorep_profile_type_set_int_value( &node_data,
+                                       scorep_profile_bucket_parameter_value( param, value ) );
 
     /* Set name */
 
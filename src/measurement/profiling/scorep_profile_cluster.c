@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2022,
+ * Copyright (c) 2009-2015, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -126,79 +126,86 @@ typedef struct scorep_reference_t
     uint64_t count;
 } scorep_reference_t;
 
-struct scorep_cluster_t;
+struct scorep_equiv_class_t;
 
 /**
-   This represents an clustered iteration. It is used to keep track
-   which iterations belong to a cluster. Iterations of a cluster
-   form a so called disjoint set which is a tree where the call-tree
-   of the root iteration represents the cluster. Other iterations
-   point to their root itertaions.
+   Objects of this type define a cluster. The average inclusive metric values
+   of a cluster form its feature vector for the distance calculation.
  */
-typedef struct scorep_clustered_iteration_t
+typedef struct scorep_cluster_t
 {
-    struct scorep_cluster_t*             cluster;         /* Pointer to the cluster (if root) */
-    uint32_t                             iteration_id;    /* The id of the iteration */
-    uint32_t                             rank;            /* Rank in disjoint sets tree. */
-    struct scorep_clustered_iteration_t* next;            /* Next element of the linked list */
-    struct scorep_clustered_iteration_t* parent;          /* Parent in the disjoint sets
-                                                             tree. This is a root if NULL */
-} scorep_clustered_iteration_t;
+    scorep_profile_node*         root;            /* Root call path of the cluster */
+    uint32_t                     cluster_id;      /* Cluster id. 0 if not defined yet */
+    uint32_t                     hash;            /* The hash of the associated tree */
+    uint32_t                     version;         /* Incremented whenever the cluster
+                                                     changes, invalidates its pairs
+                                                     in the merge heap */
+    uint32_t                     iteration_id;    /* Root of the disjoint set of
+                                                     iterations in this cluster */
+    uint32_t                     iteration_count; /* Number of iterations in cluster */
+    scorep_metric_data_t         mets_sum;        /* Sum of inclusive metric
+                                                     values for distance computation */
+    scorep_metric_data_t         mets_avg;        /* Average inclusive metric
+                                                     values for distance computation */
+    struct scorep_equiv_class_t* equiv_class;     /* Class of equivalent call trees */
+    struct scorep_cluster_t*     next;            /* Next cluster in the list of
+                                                     equivalent clusters */
+} scorep_cluster_t;
 
 /**
-   Elements of this type form a linked list which stores the cluster distances. */
-typedef struct scorep_cluster_distance_t
+   This is a class of clusters that have equivalent call trees. Only clusters of
+   equivalent call trees are merged.
+ */
+typedef struct scorep_equiv_class_t
 {
-    double                            value; /* Distance value */
-    struct scorep_cluster_distance_t* next;  /* Pointer to the next element of
-                                                the list */
-} scorep_cluster_distance_t;
+    scorep_cluster_t*            head;        /* Head of the list of clusters */
+    uint32_t                     hash;        /* The hash of the call trees */
+    struct scorep_equiv_class_t* next;        /* Next class in creation order */
+    struct scorep_equiv_class_t* next_bucket; /* Next class in the hash bucket */
+} scorep_equiv_class_t;
+
+/* Number of hash buckets for the equivalence classes */
+#define CLUSTER_EQUIV_CLASS_BUCKETS 256
 
 /**
-   Objects of this type define a cluster.
+   A candidate merge of two equivalent clusters. The pair is stale, if one of
+   the clusters changed after the distance was calculated.
  */
-typedef struct scorep_cluster_t
+typedef struct scorep_cluster_pair_t
 {
-    scorep_profile_node*       root;               /* Root call path of the cluster */
-    uint32_t                   cluster_id;         /* Cluster id. 0 if not defined yet */
-    uint32_t                   hash;               /* The hash of the associated tree */
-    scorep_cluster_distance_t* d;                  /* List of distances from all
-                                                      the equivalent groups that
-                                                      appear later in the list */
-    double                        min_val;         /* Lowest distance value */
-    scorep_cluster_distance_t*    min_pos;         /* Points to where min_val was found */
-    uint32_t                      iteration_count; /* Number of iterations in cluster */
-    scorep_metric_data_t          mets_sum;        /* Sum of inclusive metric
-                                                      values for distance computation */
-    scorep_metric_data_t          mets_avg;        /* Average inclusive metric
-                                                      values for distance computation */
-    scorep_clustered_iteration_t* disjoint_set;    /* Corresponding disjoint set */
-    struct scorep_cluster_t*      next;            /* Next cluster in the list of
-                                                      equivalent clusters */
-} scorep_cluster_t;
+    double            value;     /* Distance value */
+    scorep_cluster_t* a;         /* First cluster */
+    scorep_cluster_t* b;         /* Second cluster */
+    uint32_t          version_a; /* Version of a when the distance was calculated */
+    uint32_t          version_b; /* Version of b when the distance was calculated */
+} scorep_cluster_pair_t;
 
 /**
-   This is a list of clusters that have equivalent call trees. Only clusters of
-   wquivalent call trees are merged.
+   Binary min-heap of cluster pairs, ordered by distance. Stale pairs are
+   dropped when they reach the top, or when the heap runs full.
  */
-typedef struct scorep_equiv_cluster_list_t
+typedef struct scorep_cluster_heap_t
 {
-    scorep_cluster_t*                   head;    /* Head of the list */
-    double                              min_val; /* Lowest distance value here */
-    scorep_cluster_t*                   min_pos; /* Position of the lowest distance */
-    struct scorep_equiv_cluster_list_t* next;    /* Next element in the linked list */
-} scorep_equiv_cluster_list_t;
+    scorep_cluster_pair_t* pairs;
+    uint32_t               size;
+    uint32_t               capacity;
+} scorep_cluster_heap_t;
+
+/* Number of iterations per chunk of the disjoint sets array */
+#define CLUSTER_ITERATION_CHUNK_SIZE 1024
 
 /**
-   This stores the call-tree equivalence classes.
+   Keeps track which iterations belong to a cluster. Iterations of a cluster
+   form a disjoint set which is a tree where the root iteration is the
+   iteration_id of the cluster. For each iteration only the id of its parent
+   iteration is stored, 0 denotes a root. Iterations are numbered from 1.
  */
-typedef struct scorep_equiv_cluster_list_set_t
+typedef struct scorep_iteration_sets_t
 {
-    scorep_equiv_cluster_list_t* head;    /* This is just a linked list to be able
-                                             to iterate through the lists */
-    double                       min_val; /* Lowest distance value */
-    scorep_equiv_cluster_list_t* min_pos; /* Position of the lowest distance */
-} scorep_equiv_cluster_list_set_t;
+    uint32_t** chunks;           /* Chunks of parent ids */
+    uint32_t   number_of_chunks; /* Number of allocated chunks */
+    uint32_t   capacity;         /* Capacity of the chunks array */
+} scorep_iteration_sets_t;
 
 /**
    An element of the cluster queue represented by @a scorep_cluster_queue_t.
@@ -224,25 +231,27 @@ typedef struct scorep_cluster_queue_t
  */
 typedef struct scorep_clusterer_t
 {
-    uint32_t clustering_buffer;                                /* How many iterations can
-                                                                  be buffered before
-                                                                  processing queue */
-    uint32_t                         max_cl_count;             /* Maximum number of clusters */
-    uint32_t                         cl_count;                 /* Current number of clusters */
-    uint32_t                         cl_it_count;              /* Number of clustered_iterations */
-    scorep_clustered_iteration_t*    cl_it_head;               /* Head of the linked list of
-                                                                  clustered_iterations */
-    scorep_clustered_iteration_t**   cl_it_tail;               /* Tail of the linked list of
-                                                                  clustered iterations */
-    scorep_equiv_cluster_list_set_t* eq_cl_lt_set;             /* Data structure storing
-                                                                  the actual clusters */
-    scorep_reference_t*              ref_vals;                 /* Reference data for
-                                                                  normalization */
-    scorep_cluster_queue_t*          queue;                    /* Queue of iterations to be
-                                                                  clustered */
-    scorep_cluster_distance_t*       free_cluster_distances;   /* free objects list */
-    scorep_cluster_t*                free_clusters;            /* free objects list */
-    scorep_cluster_queue_elem_t*     free_cluster_queue_elems; /* free objects list */
+    uint32_t clustering_buffer;                            /* How many iterations can
+                                                              be buffered before
+                                                              processing queue */
+    uint32_t                     max_cl_count;             /* Maximum number of clusters */
+    uint32_t                     cl_count;                 /* Current number of clusters */
+    uint32_t                     cl_it_count;              /* Number of clustered iterations */
+    bool                         has_distances;            /* Whether the merge heap
+                                                              is populated */
+    scorep_iteration_sets_t      iterations;               /* Disjoint sets of the
+                                                              clustered iterations */
+    scorep_equiv_class_t*        equiv_classes;            /* All equivalence classes
+                                                              in creation order */
+    scorep_equiv_class_t**       equiv_classes_tail;       /* Tail of equiv_classes */
+    scorep_equiv_class_t*        equiv_class_buckets[ CLUSTER_EQUIV_CLASS_BUCKETS ];
+    scorep_cluster_heap_t        heap;                     /* Merge candidates */
+    scorep_reference_t*          ref_vals;                 /* Reference data for
+                                                              normalization */
+    scorep_cluster_queue_t*      queue;                    /* Queue of iterations to be
+                                                              clustered */
+    scorep_cluster_t*            free_clusters;            /* free objects list */
+    scorep_cluster_queue_elem_t* free_cluster_queue_elems; /* free objects list */
 } scorep_clusterer_t;
 
 /* Variable and constant declarations */
@@ -256,7 +265,6 @@ typedef struct scorep_clusterer_t
 scorep_clusterer_t* scorep_clusterer;
 
 /* Mutex */
-static UTILS_Mutex cluster_distance_lock;
 static UTILS_Mutex cluster_lock;
 static UTILS_Mutex cluster_queue_elem_lock;
 
@@ -295,51 +303,99 @@ add_iter_to_clustering( SCOREP_Profile_LocationData* location,
    Local helper functions
 ****************************************************************************/
 
+/**
+   Returns the location where the parent of an iteration is stored.
+   @param sets        The disjoint sets of the clusterer.
+   @param iterationId The id of the iteration.
+   @returns a pointer to the parent id of the iteration.
+ */
+static inline uint32_t*
+iteration_sets_get_parent( scorep_iteration_sets_t* sets,
+                           uint32_t                 iterationId )
+{
+    uint32_t index = iterationId - 1;
+    return &sets->chunks[ index / CLUSTER_ITERATION_CHUNK_SIZE ]
+           [ index % CLUSTER_ITERATION_CHUNK_SIZE ];
+}
+
+/**
+   Adds a new iteration as the root of its own disjoint set.
+   @param location    The Score-P location object of the executing location.
+   @param sets        The disjoint sets of the clusterer.
+   @param iterationId The id of the new iteration. Iterations need to be
+                      added in order.
+ */
+static void
+iteration_sets_add( SCOREP_Location*         location,
+                    scorep_iteration_sets_t* sets,
+                    uint32_t                 iterationId )
+{
+    uint32_t chunk = ( iterationId - 1 ) / CLUSTER_ITERATION_CHUNK_SIZE;
+    if ( chunk == sets->number_of_chunks )
+    {
+        if ( sets->number_of_chunks == sets->capacity )
+        {
+            sets->capacity = ( sets->capacity == 0 ? 16 : 2 * sets->capacity );
+            sets->chunks   = realloc( sets->chunks, sets->capacity * sizeof( *sets->chunks ) );
+            UTILS_ASSERT( sets->chunks );
+        }
+        sets->chunks[ chunk ] =
+            SCOREP_Location_AllocForProfile( location,
+                                             CLUSTER_ITERATION_CHUNK_SIZE * sizeof( uint32_t ) );
+        sets->number_of_chunks++;
+    }
+    *iteration_sets_get_parent( sets, iterationId ) = 0;
+}
+
 /**
    Find root of disjoint set from an iteration and speed up future searches.
-   @param itertaion Pointer to an itertaion which belongs to the disjoint set.
-   @returns the root iteration of the disjoint set.
+   @param sets        The disjoint sets of the clusterer.
+   @param iterationId An iteration which belongs to the disjoint set.
+   @returns the id of the root iteration of the disjoint set.
  */
-static scorep_clustered_iteration_t*
-disjoint_set_get_root( scorep_clustered_iteration_t* iteration )
+static uint32_t
+iteration_sets_get_root( scorep_iteration_sets_t* sets,
+                         uint32_t                 iterationId )
 {
-    if ( NULL == iteration->parent )
+    uint32_t root = iterationId;
+    uint32_t parent;
+    while ( 0 != ( parent = *iteration_sets_get_parent( sets, root ) ) )
+    {
+        root = parent;
+    }
+
+    /* Path compression */
+    while ( root != iterationId )
     {
-        return iteration;
+        uint32_t* parent_ptr = iteration_sets_get_parent( sets, iterationId );
+        iterationId = *parent_ptr;
+        *parent_ptr = root;
     }
-    return iteration->parent = disjoint_set_get_root( iteration->parent );
+    return root;
 }
 
 /**
-   This function merges two sets in the disjoint sets datastructure, which is
-   implemented here in the scorep_clustered_iteration_t objects.  a and b are
-   the two distjoint sets to be merged, while cluster is the cluster that they
-   will be associated with in the future.
-   @param a       An iteration of the disjoint set into which we merge b.
-   @param b       An iteration of the disjoint set which is merged into a.
-   @param cluster The cluster with which a and b will be associated with.
+   Merges the disjoint sets of the iterations of cluster @a b into those
+   of cluster @a a. The smaller set is attached to the root of the larger one.
+   Needs to be called before the iteration counts of the clusters are combined.
+   @param sets The disjoint sets of the clusterer.
+   @param a    The cluster into which we merge b.
+   @param b    The cluster which is merged into a.
  */
 static void
-disjoint_set_merge( scorep_clustered_iteration_t* a,
-                    scorep_clustered_iteration_t* b,
-                    scorep_cluster_t*             cluster )
+iteration_sets_merge( scorep_iteration_sets_t* sets,
+                      scorep_cluster_t*        a,
+                      scorep_cluster_t*        b )
 {
-    a = disjoint_set_get_root( a );
-    b = disjoint_set_get_root( b );
-    if ( a->rank < b->rank )
+    if ( a->iteration_count < b->iteration_count )
     {
-        scorep_clustered_iteration_t* temp;
-        temp = a;
-        a    = b;
-        b    = temp;
+        *iteration_sets_get_parent( sets, a->iteration_id ) = b->iteration_id;
+        a->iteration_id                                     = b->iteration_id;
     }
-    else if ( a->rank == b->rank )
+    else
     {
-        a->rank++;
+        *iteration_sets_get_parent( sets, b->iteration_id ) = a->iteration_id;
     }
-    b->parent                = a;
-    a->cluster               = cluster;
-    a->cluster->disjoint_set = a;
 }
 
 /**
@@ -399,56 +455,136 @@ calculate_cluster_distance( const scorep_cluster_t* a,
     return distance;
 }
 
-/**
-   Returns a new (or previously used) scorep_cluster_distance_t object.
-   @param location  The Score-P location object.
-   @param clusterer The clusterer object.
-   @returns the new object. It will automatically deleted when the
-            profile pages are freed.
- */
-static scorep_cluster_distance_t*
-new_cluster_distance( SCOREP_Location*    location,
-                      scorep_clusterer_t* clusterer )
+static inline bool
+cluster_pair_is_valid( const scorep_cluster_pair_t* pair )
 {
-    scorep_cluster_distance_t* cluster_distance;
-    UTILS_MutexLock( &cluster_distance_lock );
+    return pair->a->version == pair->version_a
+           && pair->b->version == pair->version_b;
+}
 
-    if ( NULL == clusterer->free_cluster_distances )
+static void
+cluster_heap_sift_up( scorep_cluster_heap_t* heap,
+                      uint32_t               pos )
+{
+    scorep_cluster_pair_t pair = heap->pairs[ pos ];
+    while ( pos > 0 )
     {
-        clusterer->free_cluster_distances =
-            SCOREP_Location_AllocForProfile( location,
-                                             sizeof( scorep_cluster_distance_t ) );
-        /* No next element in the list */
-        clusterer->free_cluster_distances->next = NULL;
+        uint32_t parent = ( pos - 1 ) / 2;
+        if ( heap->pairs[ parent ].value <= pair.value )
+        {
+            break;
+        }
+        heap->pairs[ pos ] = heap->pairs[ parent ];
+        pos                = parent;
     }
-    cluster_distance                  = clusterer->free_cluster_distances;
-    clusterer->free_cluster_distances = cluster_distance->next;
-    cluster_distance->next            = NULL;
+    heap->pairs[ pos ] = pair;
+}
 
-    UTILS_MutexUnlock( &cluster_distance_lock );
-    return cluster_distance;
+static void
+cluster_heap_sift_down( scorep_cluster_heap_t* heap,
+                        uint32_t               pos )
+{
+    scorep_cluster_pair_t pair = heap->pairs[ pos ];
+    for ( uint32_t child = 2 * pos + 1; child < heap->size; child = 2 * pos + 1 )
+    {
+        if ( child + 1 < heap->size
+             && heap->pairs[ child + 1 ].value < heap->pairs[ child ].value )
+        {
+            child++;
+        }
+        if ( pair.value <= heap->pairs[ child ].value )
+        {
+            break;
+        }
+        heap->pairs[ pos ] = heap->pairs[ child ];
+        pos                = child;
+    }
+    heap->pairs[ pos ] = pair;
 }
 
 /**
-   Adds a scorep_cluster_distance_t object to the list of unused.
-   @param distanceObj  The distance object that will be recycled.
-   @param clusterer    The associated clusterer.
-   @returns the next object in the list (which might be useful when
-            deleting a list of objects).
+   Removes all stale pairs from the heap and restores the heap property.
+   @param heap The merge heap.
  */
-static scorep_cluster_distance_t*
-delete_cluster_distance( scorep_cluster_distance_t* distanceObj,
-                         scorep_clusterer_t*        clusterer )
+static void
+cluster_heap_compact( scorep_cluster_heap_t* heap )
 {
-    scorep_cluster_distance_t* next;
-    UTILS_MutexLock( &cluster_distance_lock );
+    uint32_t size = 0;
+    for ( uint32_t i = 0; i < heap->size; i++ )
+    {
+        if ( cluster_pair_is_valid( &heap->pairs[ i ] ) )
+        {
+            heap->pairs[ size++ ] = heap->pairs[ i ];
+        }
+    }
+    heap->size = size;
+    for ( uint32_t i = size / 2; i > 0; i-- )
+    {
+        cluster_heap_sift_down( heap, i - 1 );
+    }
+}
 
-    next                              = distanceObj->next;
-    distanceObj->next                 = clusterer->free_cluster_distances;
-    clusterer->free_cluster_distances = distanceObj;
+/**
+   Calculates the distance of two clusters and inserts the pair into the
+   merge heap. If the heap is full, stale pairs are removed first. It grows
+   only if it is still more than half full afterwards, thus its size is
+   bounded by the number of valid pairs.
+   @param heap      The merge heap.
+   @param a         The first cluster.
+   @param b         The second cluster.
+   @param reference The metric reference set of the clusterer.
+ */
+static void
+cluster_heap_push( scorep_cluster_heap_t* heap,
+                   scorep_cluster_t*      a,
+                   scorep_cluster_t*      b,
+                   scorep_reference_t*    reference )
+{
+    if ( heap->size == heap->capacity )
+    {
+        cluster_heap_compact( heap );
+        if ( heap->size >= heap->capacity / 2 )
+        {
+            heap->capacity = ( heap->capacity == 0 ? 64 : 2 * heap->capacity );
+            heap->pairs    = realloc( heap->pairs, heap->capacity * sizeof( *heap->pairs ) );
+            UTILS_ASSERT( heap->pairs );
+        }
+    }
 
-    UTILS_MutexUnlock( &cluster_distance_lock );
-    return next;
+    scorep_cluster_pair_t* pair = &heap->pairs[ heap->size ];
+    pair->value     = calculate_cluster_distance( a, b, reference );
+    pair->a         = a;
+    pair->b         = b;
+    pair->version_a = a->version;
+    pair->version_b = b->version;
+    cluster_heap_sift_up( heap, heap->size++ );
+}
+
+/**
+   Retrieves the valid pair with the lowest distance from the heap. Stale
+   pairs on the way are discarded.
+   @param heap The merge heap.
+   @param pair Memory location into which the pair is written.
+   @returns false if no valid pair exists.
+ */
+static bool
+cluster_heap_pop( scorep_cluster_heap_t* heap,
+                  scorep_cluster_pair_t* pair )
+{
+    while ( heap->size > 0 )
+    {
+        *pair           = heap->pairs[ 0 ];
+        heap->pairs[ 0 ] = heap->pairs[ --heap->size ];
+        if ( heap->size > 0 )
+        {
+            cluster_heap_sift_down( heap, 0 );
+        }
+        if ( cluster_pair_is_valid( pair ) )
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 /**
@@ -456,27 +592,33 @@ delete_cluster_distance( scorep_cluster_distance_t* distanceObj,
    @param location            The Score-P location object of the executing
                               location.
    @param clusterer           Pointer to the clusterer object
-   @param clustered iteration Pointer to the initial (first)
-                              iteration of the new cluster
+   @param iterationId         The id of the initial (first) iteration of the
+                              new cluster.
    @param root                Pointer to the root node in the
                               call tree which represents the
                               clustered iterations.
    @returns the new object.
  */
 static scorep_cluster_t*
-new_cluster( SCOREP_Location*              location,
-             scorep_clusterer_t*           clusterer,
-             scorep_clustered_iteration_t* clustered_iteration,
-             scorep_profile_node*          root )
+new_cluster( SCOREP_Location*     location,
+             scorep_clusterer_t*  clusterer,
+             uint32_t             iterationId,
+             scorep_profile_node* root )
 {
     scorep_cluster_t* cluster;
     UTILS_MutexLock( &cluster_lock );
 
-    /* Create structural parts */
+    /* Create structural parts, including the metric part */
     if ( NULL == clusterer->free_clusters )
     {
+        size_t metric_array_size = sizeof( uint64_t ) * cluster_metric_number;
         clusterer->free_clusters =
             SCOREP_Location_AllocForProfile( location, sizeof( scorep_cluster_t ) );
+        clusterer->free_clusters->version                = 0;
+        clusterer->free_clusters->mets_sum.dense_metrics =
+            SCOREP_Location_AllocForProfile( location, metric_array_size );
+        clusterer->free_clusters->mets_avg.dense_metrics =
+            SCOREP_Location_AllocForProfile( location, metric_array_size );
         /* No next element in the list */
         clusterer->free_clusters->next = NULL;
     }
@@ -485,113 +627,40 @@ new_cluster( SCOREP_Location*              location,
 
     /* Initialize */
     cluster->root            = root;
-    cluster->cluster_id      = clusterer->cl_it_count + 1;
+    cluster->cluster_id      = iterationId;
     cluster->hash            = 0;
-    cluster->d               = NULL;
-    cluster->min_val         = DBL_MAX;
-    cluster->min_pos         = NULL;
+    cluster->iteration_id    = iterationId;
     cluster->iteration_count = 1;
+    cluster->equiv_class     = NULL;
+    cluster->next            = NULL;
 
-    /* Create metric part */
-    size_t metric_array_size = sizeof( uint64_t ) * cluster_metric_number;
-    cluster->mets_sum.dense_metrics = SCOREP_Location_AllocForProfile( location, metric_array_size );
-    cluster->mets_avg.dense_metrics = SCOREP_Location_AllocForProfile( location, metric_array_size );
     for ( int mr = 0; mr < cluster_metric_number; mr++ )
     {
         cluster->mets_sum.dense_metrics[ mr ] = 0.0;
         cluster->mets_avg.dense_metrics[ mr ] = 0.0;
     }
 
-    cluster->disjoint_set               = clustered_iteration;
-    cluster->disjoint_set->cluster      = cluster;
-    cluster->disjoint_set->iteration_id = clusterer->cl_it_count + 1;
-    cluster->disjoint_set->rank         = 0;
-    cluster->disjoint_set->next         = NULL;
-    cluster->disjoint_set->parent       = NULL;
-    cluster->next                       = NULL;
-
     UTILS_MutexUnlock( &cluster_lock );
     return cluster;
 }
 
 /**
    Recycles a scorep_cluster_t object by adding it to the list
-   of unused objects.
+   of unused objects. All its pairs in the merge heap get stale.
    @param cluster   Cluster obeject that will be recycled.
    @param clusterer The clusterer object
-   @returns the next cluster after the deleted one, in the
-            cluster's equvalence list.
  */
-static scorep_cluster_t*
+static void
 delete_cluster( scorep_cluster_t*   cluster,
                 scorep_clusterer_t* clusterer )
 {
-    scorep_cluster_t* next;
     UTILS_MutexLock( &cluster_lock );
 
-    next = cluster->next;
-    while ( NULL != cluster->d )
-    {
-        cluster->d = delete_cluster_distance( cluster->d, clusterer );
-    }
+    cluster->version++;
     cluster->next            = clusterer->free_clusters;
     clusterer->free_clusters = cluster;
 
     UTILS_MutexUnlock( &cluster_lock );
-    return next;
-}
-
-/**
-   Create a new scorep_clustered_iteration_t object.
-   @param location  The Score-P location object of the executing location.
-   @retuns the new object.
- */
-static scorep_clustered_iteration_t*
-new_clustered_iteration( SCOREP_Location* location )
-{
-    scorep_clustered_iteration_t* clustered_iteration;
-    clustered_iteration =
-        SCOREP_Location_AllocForProfile( location, sizeof( scorep_clustered_iteration_t ) );
-    /* Initialize */
-    memset( clustered_iteration, 0, sizeof( scorep_clustered_iteration_t ) );
-
-    return clustered_iteration;
-}
-
-/**
-   Create a new scorep_equiv_cluster_list_t object
-   @param location  The Score-P location object of the executing location.
-   @retuns the new object.
- */
-static scorep_equiv_cluster_list_t*
-new_equiv_cluster_list( SCOREP_Location* location )
-{
-    scorep_equiv_cluster_list_t* list;
-    list          = SCOREP_Location_AllocForProfile( location, sizeof( scorep_equiv_cluster_list_t ) );
-    list->min_val = DBL_MAX;
-    list->min_pos = NULL;
-    list->head    = NULL;
-    list->next    = NULL;
-
-    return list;
-}
-
-/**
-   Create a new scorep_equiv_cluster_list_set_t object
-   @param location  The Score-P location object of the executing location.
-   @retuns the new object.
- */
-static scorep_equiv_cluster_list_set_t*
-new_equiv_cluster_list_set( SCOREP_Location* location )
-{
-    scorep_equiv_cluster_list_set_t* list_set;
-    list_set = SCOREP_Location_AllocForProfile( location, sizeof( scorep_equiv_cluster_list_set_t ) );
-    /* Initialize */
-    list_set->min_val = DBL_MAX;
-    list_set->min_pos = NULL;
-    list_set->head    = NULL;
-
-    return list_set;
 }
 
 /**
@@ -695,18 +764,12 @@ new_clusterer( SCOREP_Location* location,
     clusterer = SCOREP_Location_AllocForProfile( location, sizeof( scorep_clusterer_t ) );
 
     /* Initialize */
-    clusterer->max_cl_count             = maxClusterCount;
-    clusterer->clustering_buffer        = scorep_profile_get_cluster_count();
-    clusterer->cl_count                 = 0;
-    clusterer->cl_it_count              = 0;
-    clusterer->cl_it_head               = NULL;
-    clusterer->cl_it_tail               = &( clusterer->cl_it_head );
-    clusterer->eq_cl_lt_set             = new_equiv_cluster_list_set( location );
-    clusterer->ref_vals                 = new_reference( location );
-    clusterer->queue                    = new_cluster_queue( location );
-    clusterer->free_cluster_distances   = NULL;
-    clusterer->free_clusters            = NULL;
-    clusterer->free_cluster_queue_elems = NULL;
+    memset( clusterer, 0, sizeof( scorep_clusterer_t ) );
+    clusterer->max_cl_count       = maxClusterCount;
+    clusterer->clustering_buffer  = scorep_profile_get_cluster_count();
+    clusterer->equiv_classes_tail = &( clusterer->equiv_classes );
+    clusterer->ref_vals           = new_reference( location );
+    clusterer->queue              = new_cluster_queue( location );
 
     return clusterer;
 }
@@ -715,14 +778,13 @@ new_clusterer( SCOREP_Location* location,
    Update reference values with the data from the given iteration.
    @param reference The metric reference object of the associated
                     clusterer
-   @param iteration The iteration object.
+   @param cluster   The cluster representing the new iteration.
  */
 static void
-update_reference_values( scorep_reference_t*           reference,
-                         scorep_clustered_iteration_t* iteration )
+update_reference_values( scorep_reference_t* reference,
+                         scorep_cluster_t*   cluster )
 {
-    scorep_cluster_t* cluster = iteration->cluster;
-    double            count   = reference->count;
+    double count = reference->count;
 
     for ( int mr = 0; mr < cluster_metric_number; mr++ )
     {
@@ -735,53 +797,20 @@ update_reference_values( scorep_reference_t*           reference,
 }
 
 /**
-   This function assumes that this cluster has no distance data at all and
-   needs to calculate all distances to clusters after itself in the list
-   @param location  The Score-P location object of the executing location.
-   @param cluster   The cluster object for which the distances are calculated
-   @param list      Pointer to the equivalenz cluster list.
+   Inserts the pairs of @a cluster with all other clusters of its
+   equivalence class into the merge heap.
+   @param cluster   The cluster.
    @param clusterer The clusterer object.
  */
 static void
-calculate_distances_for_new_cluster( SCOREP_Location*             location,
-                                     scorep_cluster_t*            cluster,
-                                     scorep_equiv_cluster_list_t* list,
-                                     scorep_clusterer_t*          clusterer )
+push_cluster_pairs( scorep_cluster_t*   cluster,
+                    scorep_clusterer_t* clusterer )
 {
-    scorep_cluster_distance_t** tail = &( cluster->d );
-    /* Set up a shortcut to the list set */
-    scorep_equiv_cluster_list_set_t* list_set = clusterer->eq_cl_lt_set;
-    /* Fill distance data of new cluster */
-    scorep_cluster_t* cl;
-    for ( cl = cluster->next; cl != NULL; cl = cl->next )
-    {
-        /* Calculate distance */
-        scorep_cluster_distance_t* distance =
-            new_cluster_distance( location, clusterer );
-        distance->value = calculate_cluster_distance( cluster, cl,
-                                                      clusterer->ref_vals );
-        /* Insert distance value */
-        *tail = distance;
-        tail  = &( distance->next );
-
-        /* Update minima */
-        if ( cluster->min_val > distance->value )
-        {
-            cluster->min_val = distance->value;
-            cluster->min_pos = distance;
-        }
-    }
-
-    /* Update minima in the higher parts of the data structure */
-    if ( list->min_val > cluster->min_val )
+    for ( scorep_cluster_t* cl = cluster->equiv_class->head; NULL != cl; cl = cl->next )
     {
-        list->min_val = cluster->min_val;
-        list->min_pos = cluster;
-
-        if ( list_set->min_val > list->min_val )
+        if ( cl != cluster )
         {
-            list_set->min_val = list->min_val;
-            list_set->min_pos = list;
+            cluster_heap_push( &clusterer->heap, cluster, cl, clusterer->ref_vals );
         }
     }
 }
@@ -1187,58 +1216,53 @@ init_cluster( scorep_cluster_t* cluster )
 
 /**
    Inserts a new cluster into the data structures. It finds the
-   appropriate list in the equiv_cluster_list_set. If not found,
-   creates it. The return value is the list used.
+   appropriate equivalence class via the hash of the call tree. If not
+   found, creates it.
    @param location  The Score-P location object of the executing location.
    @param cluster   The cluster that is inserted.
-   @param listSet   The list of equivalence sets of the associated clusterer.
-   @returns the equivalence class into which the cluster was inserted.
+   @param clusterer The associated clusterer.
  */
-static scorep_equiv_cluster_list_t*
-insert_cluster( SCOREP_Location*                 location,
-                scorep_cluster_t*                cluster,
-                scorep_equiv_cluster_list_set_t* listSet )
+static void
+insert_cluster( SCOREP_Location*    location,
+                scorep_cluster_t*   cluster,
+                scorep_clusterer_t* clusterer )
 {
-    /* We assume that the equivalence list is sorted by their hash value.
-       Traverse the equivalence cluster list until last points to
-       a lower value and list to a higher or equal value.
-     */
-    scorep_equiv_cluster_list_t* list, ** last = &( listSet->head );
-    for ( list = *last; NULL != list && list->head->hash < cluster->hash;
-          last = &( list->next ), list = *last )
-    {
-        ;
-    }
+    scorep_equiv_class_t** bucket =
+        &clusterer->equiv_class_buckets[ cluster->hash % CLUSTER_EQUIV_CLASS_BUCKETS ];
 
-    /* Compare the clusters call tree with all clusters with an equal
+    /* Compare the clusters call tree with all classes with an equal
        hash value
      */
-    for (; NULL != list && list->head->hash == cluster->hash;
-         last = &( list->next ), list = *last )
+    scorep_equiv_class_t* equiv_class;
+    for ( equiv_class = *bucket; NULL != equiv_class; equiv_class = equiv_class->next_bucket )
     {
-        if ( 0 == compare_call_trees( list->head->root, cluster->root,
-                                      list->head->iteration_count,
-                                      cluster->iteration_count ) )
+        if ( equiv_class->hash == cluster->hash
+             && 0 == compare_call_trees( equiv_class->head->root, cluster->root,
+                                         equiv_class->head->iteration_count,
+                                         cluster->iteration_count ) )
         {
-            //fprintf( stderr, "insert_cluster: Trees match\n" );
-            /* Insert cluster */
-            cluster->next = list->head;
-            list->head    = cluster;
-            return list;
+            break;
         }
+    }
+
+    if ( NULL == equiv_class )
+    {
+        /* Class not found, create new class */
+        equiv_class = SCOREP_Location_AllocForProfile( location, sizeof( scorep_equiv_class_t ) );
+        equiv_class->head        = NULL;
+        equiv_class->hash        = cluster->hash;
+        equiv_class->next        = NULL;
+        equiv_class->next_bucket = *bucket;
+        *bucket                  = equiv_class;
 
-        //fprintf( stderr, "insert_cluster: Trees don't match\n" );
+        *( clusterer->equiv_classes_tail ) = equiv_class;
+        clusterer->equiv_classes_tail      = &( equiv_class->next );
     }
-    /*  scorep_cntl_msg("No match found, creating new list");*/
-    /* List not found, create new list */
-    list = new_equiv_cluster_list( location );
-    /* Insert new list */
-    list->next = *last;
-    *last      = list;
-    /* Insert cluster */
-    list->head = cluster;
 
-    return list;
+    /* Insert cluster */
+    cluster->equiv_class = equiv_class;
+    cluster->next        = equiv_class->head;
+    equiv_class->head    = cluster;
 }
 
 /**
@@ -1314,6 +1338,65 @@ process_queue( scorep_clusterer_t*          clusterer,
     }
 }
 
+/**
+   Merges the two equivalent clusters with the lowest distance.
+   @param location  The executing location.
+   @param clusterer The associated clusterer.
+   @returns false if no two clusters can be merged.
+ */
+static bool
+merge_closest_clusters( SCOREP_Profile_LocationData* location,
+                        scorep_clusterer_t*          clusterer )
+{
+    scorep_cluster_pair_t pair;
+    if ( !cluster_heap_pop( &clusterer->heap, &pair ) )
+    {
+        return false;
+    }
+
+    scorep_cluster_t* cl_a = pair.a;
+    scorep_cluster_t* cl_b = pair.b;
+
+    UTILS_DEBUG( "cl_a: iteration_count: %d, hash: %d, cluster_id: %d",
+                 cl_a->iteration_count, cl_a->hash, cl_a->cluster_id );
+    UTILS_DEBUG( "cl_b: iteration_count: %d, hash: %d, cluster_id: %d",
+                 cl_b->iteration_count, cl_b->hash, cl_b->cluster_id );
+
+    /* Merge the disjoint sets corresponding to these clusters */
+    iteration_sets_merge( &clusterer->iterations, cl_a, cl_b );
+
+    /* Add up metric values from the two clusters in cl_a */
+    cl_a->iteration_count += cl_b->iteration_count;
+    for ( int mr = 0; mr < cluster_metric_number; mr++ )
+    {
+        cl_a->mets_sum.dense_metrics[ mr ] += cl_b->mets_sum.dense_metrics[ mr ];
+        cl_a->mets_avg.dense_metrics[ mr ]  =
+            cl_a->mets_sum.dense_metrics[ mr ] / cl_a->iteration_count;
+    }
+
+    /* Remove it from its parent list. If it contains a parallel regions,
+       the merge takes care of removing the forked threads. */
+    scorep_profile_remove_node( cl_b->root );
+
+    /* Add up the two call trees */
+    scorep_profile_merge_subtree( location, cl_a->root, cl_b->root );
+
+    /* Unlink and delete cl_b */
+    scorep_cluster_t** last = &( cl_b->equiv_class->head );
+    while ( *last != cl_b )
+    {
+        last = &( ( *last )->next );
+    }
+    *last = cl_b->next;
+    delete_cluster( cl_b, clusterer );
+
+    /* The distances of cl_a changed, replace its pairs */
+    cl_a->version++;
+    push_cluster_pairs( cl_a, clusterer );
+
+    return true;
+}
+
 /**
    Integrates a new iteration into the clustering.
    @param location  The executing location.
@@ -1326,56 +1409,53 @@ add_iter_to_clustering( SCOREP_Profile_LocationData* location,
                         scorep_clusterer_t*          clusterer )
 {
     UTILS_DEBUG_ENTRY( "" );
-    /* Create new clustered_iteration */
-    scorep_clustered_iteration_t* clustered_iteration =
-        new_clustered_iteration( location->location_data );
+
+    /* Register the new iteration */
+    uint32_t iteration_id = clusterer->cl_it_count + 1;
+    iteration_sets_add( location->location_data, &clusterer->iterations, iteration_id );
 
     /* Create new cluster */
     scorep_cluster_t* cluster = new_cluster( location->location_data,
                                              clusterer,
-                                             clustered_iteration,
+                                             iteration_id,
                                              path );
     /* Initialize cluster */
     init_cluster( cluster );
 
-    /* Insert cluster. If there is no list with a tree like this, a new list
+    /* Insert cluster. If there is no class with a tree like this, a new class
        will be created */
-    scorep_equiv_cluster_list_t* list = insert_cluster( location->location_data,
-                                                        cluster,
-                                                        clusterer->eq_cl_lt_set );
+    insert_cluster( location->location_data, cluster, clusterer );
 
     /* Update reference data */
-    update_reference_values( clusterer->ref_vals, clustered_iteration );
+    update_reference_values( clusterer->ref_vals, cluster );
 
-    /* Insert new iteration into the iteration list */
-    *( clusterer->cl_it_tail ) = clustered_iteration;
-    clusterer->cl_it_tail      = &( clustered_iteration->next );
     /* Increment number of clustered iterations */
     clusterer->cl_it_count++;
 
     if ( clusterer->cl_it_count > clusterer->max_cl_count )
     {
-        if ( clusterer->cl_it_count == clusterer->max_cl_count + 1 )
+        if ( !clusterer->has_distances )
         {
-            scorep_equiv_cluster_list_t* lt;
-            scorep_cluster_t*            cl;
-
             /* This is the first time we calculate distances, just before
                the first potential merge. This is to be able to have as many
                iterations in the reference data already as possible */
-            for ( lt = clusterer->eq_cl_lt_set->head; NULL != lt; lt = lt->next )
+            for ( scorep_equiv_class_t* equiv_class = clusterer->equiv_classes;
+                  NULL != equiv_class;
+                  equiv_class = equiv_class->next )
             {
-                for ( cl = lt->head; NULL != cl; cl = cl->next )
+                for ( scorep_cluster_t* cl = equiv_class->head; NULL != cl; cl = cl->next )
                 {
-                    calculate_distances_for_new_cluster( location->location_data,
-                                                         cl, lt, clusterer );
+                    for ( scorep_cluster_t* other = cl->next; NULL != other; other = other->next )
+                    {
+                        cluster_heap_push( &clusterer->heap, cl, other, clusterer->ref_vals );
+                    }
                 }
             }
+            clusterer->has_distances = true;
         }
         else
         {
-            calculate_distances_for_new_cluster( location->location_data,
-                                                 cluster, list, clusterer );
+            push_cluster_pairs( cluster, clusterer );
         }
     }
 
@@ -1385,204 +1465,19 @@ add_iter_to_clustering( SCOREP_Profile_LocationData* location,
     if ( clusterer->max_cl_count < clusterer->cl_count )
     {
         /* We have to merge clusters as we have more than the allowed maximum */
-        if ( DBL_MAX == clusterer->eq_cl_lt_set->min_val )
+        if ( merge_closest_clusters( location, clusterer ) )
         {
-            /* All cluster lists contain only a single cluster by now.
+            /* Merge done, decrement cluster count */
+            clusterer->cl_count--;
+        }
+        else
+        {
+            /* All equivalence classes contain only a single cluster by now.
                This is because there are too many structural equivalence classes.
                Let's be flexible and increase max_cl_count then. */
             fprintf( stderr, "Increase max_cl_count\n" );
             clusterer->max_cl_count++;
         }
-        else
-        {
-            /* It's possible to merge two clusters */
-
-            /* Go to the clusters with the lowest distance */
-
-            list = clusterer->eq_cl_lt_set->min_pos;
-            int mr;
-
-            scorep_cluster_t* cl_a = list->min_pos;
-
-            scorep_cluster_distance_t*  shortest_dist = cl_a->min_pos;
-            scorep_cluster_distance_t** last;
-
-            scorep_cluster_distance_t* temp_dist = cl_a->d;
-            int                        ctr_a, ctr_b, ctr_d, ctr_diff, ctr_cl;
-            scorep_cluster_t*          cl;
-            scorep_cluster_t*          before_cl_b = cl_a; /* cl_b is after cl_a in the list */
-
-            scorep_cluster_t*            cl_b = before_cl_b->next;
-            scorep_equiv_cluster_list_t* lt;
-
-            for ( ctr_diff = 1; temp_dist != shortest_dist;
-                  temp_dist = temp_dist->next, ctr_diff++ )
-            {
-                before_cl_b = cl_b;
-                cl_b        = cl_b->next;
-            }
-
-            UTILS_DEBUG( "cl_a: iteration_count: %d, hash: %d, cluster_id: %d",
-                         cl_a->iteration_count, cl_a->hash, cl_a->cluster_id );
-            UTILS_DEBUG( "cl_b: iteration_count: %d, hash: %d, cluster_id: %d",
-                         cl_b->iteration_count, cl_b->hash, cl_b->cluster_id );
-
-            /* Add up metric values from the two clusters in cl_a */
-            cl_a->iteration_count += cl_b->iteration_count;
-            for ( mr = 0; mr < cluster_metric_number; mr++ )
-            {
-                cl_a->mets_sum.dense_metrics[ mr ] += cl_b->mets_sum.dense_metrics[ mr ];
-                cl_a->mets_avg.dense_metrics[ mr ]  =
-                    cl_a->mets_sum.dense_metrics[ mr ] / cl_a->iteration_count;
-            }
-
-            /* Remove it from its parent list. If it contains a parallel regions,
-               the merge takes care of removing the forked threads. */
-            scorep_profile_remove_node( cl_b->root );
-
-            /* Add up the two call trees */
-            scorep_profile_merge_subtree( location, cl_a->root, cl_b->root );
-
-            /* Merge the disjoint sets corresponding to these clusters */
-            disjoint_set_merge( cl_a->disjoint_set, cl_b->disjoint_set, cl_a );
-
-            /* Count the number of elements in the list up to cl_a */
-            for ( cl = list->head, ctr_a = 0; cl != cl_a; cl = cl->next, ctr_a++ )
-            {
-                ;
-            }
-
-            /* Update all the distance values in all clusters before cl_a */
-            for ( cl = list->head, ctr_cl = 1; cl_a != cl; cl = cl->next, ctr_cl++ )
-            {
-                /* First, find the distance from cl_a and update it */
-                for ( last = &( cl->d ), temp_dist = *last, ctr_d = ctr_a - ctr_cl; 0 != ctr_d;
-                      last = &( temp_dist->next ), temp_dist = *last, ctr_d-- )
-                {
-                    ;
-                }
-                temp_dist->value =
-                    calculate_cluster_distance( cl, cl_a, clusterer->ref_vals );
-                /* Update cluster minimum */
-                if ( cl->min_val > temp_dist->value )
-                {
-                    cl->min_val = temp_dist->value;
-                    cl->min_pos = temp_dist;
-                }
-                else if ( cl->min_pos == temp_dist )
-                {
-                    /* It was exactly this distance that had the lowest value
-                       and it didn't get lower, so check if it's still the lowest */
-                    scorep_cluster_distance_t* d;
-                    cl->min_val = DBL_MAX;
-                    for ( d = cl->d; NULL != d; d = d->next )
-                    {
-                        if ( cl->min_val > d->value )
-                        {
-                            cl->min_val = d->value;
-                            cl->min_pos = d;
-                        }
-                    }
-                }
-                /* Second, find the distance from cl_b and delete it */
-                for ( ctr_d = ctr_diff; 0 != ctr_d;
-                      last = &( temp_dist->next ), temp_dist = *last, ctr_d-- )
-                {
-                    ;
-                }
-                /* Unlink and delete the distance */
-                if ( cl->min_pos == temp_dist )
-                {
-                    /* It was exactly this distance that had the lowest value, and
-                       now it's being deleted. So let's update the minimum */
-                    scorep_cluster_distance_t* d;
-                    temp_dist->value = DBL_MAX;
-                    cl->min_val      = DBL_MAX;
-                    for ( d = cl->d; NULL != d; d = d->next )
-                    {
-                        if ( cl->min_val > d->value )
-                        {
-                            cl->min_val = d->value;
-                            cl->min_pos = d;
-                        }
-                    }
-                }
-                *last = delete_cluster_distance( temp_dist, clusterer );
-            }
-
-            /* Remove the element for cl_b from the distance lists of the
-               clusters between cl_a and cl_b, including cl_a */
-            for ( cl = cl_a, ctr_cl = 1; cl_b != cl; cl = cl->next, ctr_cl++ )
-            {
-                /* Find the distance from cl_b and delete it */
-                for ( last = &( cl->d ), temp_dist = *last, ctr_d = ctr_diff - ctr_cl; 0 != ctr_d;
-                      last = &( temp_dist->next ), temp_dist = *last, ctr_d-- )
-                {
-                    ;
-                }
-                /* Unlink and delete the distance */
-                if ( cl->min_pos == temp_dist )
-                {
-                    /* It was exactly this distance that had the lowest value, and
-                       now it's being deleted. So let's update the minimum */
-                    scorep_cluster_distance_t* d;
-                    temp_dist->value = DBL_MAX;
-                    cl->min_val      = DBL_MAX;
-                    for ( d = cl->d; NULL != d; d = d->next )
-                    {
-                        if ( cl->min_val > d->value )
-                        {
-                            cl->min_val = d->value;
-                            cl->min_pos = d;
-                        }
-                    }
-                }
-                *last = delete_cluster_distance( temp_dist, clusterer );
-            }
-
-            /* Unlink and delete cl_b */
-            before_cl_b->next = delete_cluster( cl_b, clusterer );
-
-            /* Update all the distance values in cl_a */
-            cl_a->min_val = DBL_MAX;
-            for ( temp_dist = cl_a->d, cl = cl_a->next; temp_dist != NULL;
-                  temp_dist = temp_dist->next, cl = cl->next )
-            {
-                temp_dist->value =
-                    calculate_cluster_distance( cl_a, cl, clusterer->ref_vals );
-                /* Update minimum */
-                if ( cl_a->min_val > temp_dist->value )
-                {
-                    cl_a->min_val = temp_dist->value;
-                    cl_a->min_pos = temp_dist;
-                }
-            }
-
-            /* Ivalidate min_val at the list level and recalculate the minimum */
-            list->min_val = DBL_MAX;
-            for ( cl = list->head; NULL != cl; cl = cl->next )
-            {
-                if ( list->min_val > cl->min_val )
-                {
-                    list->min_val = cl->min_val;
-                    list->min_pos = cl;
-                }
-            }
-
-            /* Re-calculate global minimum */
-            clusterer->eq_cl_lt_set->min_val = DBL_MAX;
-            for ( lt = clusterer->eq_cl_lt_set->head; NULL != lt; lt = lt->next )
-            {
-                if ( clusterer->eq_cl_lt_set->min_val > lt->min_val )
-                {
-                    clusterer->eq_cl_lt_set->min_val = lt->min_val;
-                    clusterer->eq_cl_lt_set->min_pos = lt;
-                }
-            }
-
-            /* Merge done, decrement cluster count */
-            clusterer->cl_count--;
-        }
     }
     UTILS_DEBUG_EXIT( "" );
 }
@@ -2034,6 +1929,17 @@ void
 scorep_cluster_finalize( void )
 {
     clustering_enabled = false;
+
+    /* The remaining clusterer data lives in the profile memory */
+    if ( scorep_clusterer != NULL )
+    {
+        free( scorep_clusterer->heap.pairs );
+        free( scorep_clusterer->iterations.chunks );
+        scorep_clusterer->heap.pairs        = NULL;
+        scorep_clusterer->heap.size         = 0;
+        scorep_clusterer->heap.capacity     = 0;
+        scorep_clusterer->iterations.chunks = NULL;
+    }
 }
 
 void
@@ -2046,11 +1952,11 @@ scorep_cluster_postprocess( void )
 
     /* Enumerate all clusters from 1 to n */
     uint64_t counter = 1;
-    for ( scorep_equiv_cluster_list_t* list = scorep_clusterer->eq_cl_lt_set->head;
-          list != NULL;
-          list = list->next )
+    for ( scorep_equiv_class_t* equiv_class = scorep_clusterer->equiv_classes;
+          equiv_class != NULL;
+          equiv_class = equiv_class->next )
     {
-        for ( scorep_cluster_t* cluster = list->head;
+        for ( scorep_cluster_t* cluster = equiv_class->head;
               cluster != NULL;
               cluster = cluster->next )
         {
@@ -2089,7 +1995,7 @@ scorep_cluster_write_cube4( scorep_cube_writing_data* writeData )
         cube_def_attr( writeData->my_cube, "CLUSTERING", "ON" );
 
         /* Write cluster root */
-        root = disjoint_set_get_root( scorep_clusterer->cl_it_head )->cluster->root->parent;
+        root = scorep_clusterer->equiv_classes->head->root->parent;
         SCOREP_CallpathHandle handle =
             SCOREP_CallpathHandle_GetUnified( root->callpath_handle );
         uint32_t root_id =
@@ -2140,13 +2046,22 @@ scorep_cluster_write_cube4( scorep_cube_writing_data* writeData )
        Iterations are enumerated from 1 to n. */
     uint32_t* it_map = ( uint32_t* )calloc( global_it_count, sizeof( uint32_t ) );
     UTILS_ASSERT( it_map );
-    for (  scorep_clustered_iteration_t* it = scorep_clusterer->cl_it_head;
-           it != NULL;
-           it = it->next )
+    for ( scorep_equiv_class_t* equiv_class = scorep_clusterer->equiv_classes;
+          equiv_class != NULL;
+          equiv_class = equiv_class->next )
+    {
+        for ( scorep_cluster_t* cluster = equiv_class->head;
+              cluster != NULL;
+              cluster = cluster->next )
+        {
+            const char* name = SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( cluster->root->type_specific_data ) );
+            it_map[ cluster->iteration_id - 1 ] = atoi( &name[ 9 ] ); /* Format is 'instance=<number>' */
+        }
+    }
+    /* Other iterations take the cluster number of their root iteration */
+    for ( uint32_t it = 1; it <= scorep_clusterer->cl_it_count; it++ )
     {
-        scorep_profile_node* cluster = disjoint_set_get_root( it )->cluster->root;
-        const char*          name    = SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( cluster->type_specific_data ) );
-        it_map[ it->iteration_id - 1 ] = atoi( &name[ 9 ] ); /* Format is 'instance=<number>' */
+        it_map[ it - 1 ] = it_map[ iteration_sets_get_root( &scorep_clusterer->iterations, it ) - 1 ];
     }
 
     /* Collect data to rank 0 */
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2024,
+ * Copyright (c) 2009-2014, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2012, 2014
@@ -92,6 +92,21 @@ bool scorep_profile_enable_clustering;
  */
 bool scorep_profile_enable_core_files;
 
+/**
+   Stores the bucketing of integer parameter values
+ */
+char* scorep_profile_parameter_integer_buckets;
+
+/**
+   Stores the number of files for the TAU snapshot profile
+ */
+uint64_t scorep_profile_tau_snapshot_files;
+
+/**
+   Stores whether the measurement overhead is estimated per callpath
+ */
+bool scorep_profile_estimate_overhead;
+
 
 /**
    Option table for output format configuration.
@@ -279,6 +294,56 @@ static const SCOREP_ConfigVariable scorep_profile_confvars[] = {
         "stack at these points. It is not recommended to enable this feature for "
         "large scale measurements."
     },
+    {
+        "parameter_integer_buckets",
+        SCOREP_CONFIG_TYPE_STRING,
+        &scorep_profile_parameter_integer_buckets,
+        NULL,
+        "",
+        "Buckets for the values of integer parameters",
+        "By default, every distinct value of an integer parameter creates a "
+        "separate node in the call tree. If set to `log2`, values are combined "
+        "into power-of-two buckets, i.e., a value v is recorded as the largest "
+        "power of two not greater than |v|, keeping the sign. Alternatively, a "
+        "comma separated list of strictly increasing lower bounds, e.g. "
+        "`0,64,1024,65536`, can be given. A value is then recorded as the "
+        "largest bound not greater than the value; values below the first bound "
+        "are recorded as the first bound. Does not affect the `instance` "
+        "parameter of dynamic regions, nor the values written into traces."
+    },
+    {
+        "tau_snapshot_files",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_profile_tau_snapshot_files,
+        NULL,
+        "0",
+        "Number of files for the TAU snapshot profile",
+        "By default, every process writes its snapshot into its own file "
+        "`tau/snapshot.<rank>.0.0`. If set to a value N greater than zero, the "
+        "processes are divided into N consecutive blocks of ranks instead. The "
+        "first process of each block receives the snapshots of the other "
+        "processes in its block and writes them, ordered by rank, into the file "
+        "`tau/snapshot.aggregated.<n>`. The file `tau/snapshot.index` lists "
+        "for every rank the file, offset, and length of its snapshot. The "
+        "content of a snapshot is the same in both modes."
+    },
+    {
+        "estimate_overhead",
+        SCOREP_CONFIG_TYPE_BOOL,
+        &scorep_profile_estimate_overhead,
+        NULL,
+        "false",
+        "Estimate the measurement overhead per call path",
+        "When the measurement starts, the cost of one enter or exit event is "
+        "calibrated by recording a few hundred enter/exit pairs into a scratch "
+        "call tree, including the timer and dense metric reads. The number of "
+        "enter and exit events of every call path times this cost is written "
+        "as the metric `overhead` into the Cube4 profile. The calibrated cost "
+        "and the number of events per location are written as the location "
+        "properties `PROFILE_EVENT_COST` and `PROFILE_EVENTS`. The estimate "
+        "does not cover the work of other substrates, e.g., tracing, nor "
+        "other events like parameters and sparse metrics."
+    },
     SCOREP_CONFIG_TERMINATOR
 };
 
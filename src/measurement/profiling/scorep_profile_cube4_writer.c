@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2017, 2019, 2022-2024,
+ * Copyright (c) 2009-2015, 2017, 2019, 2022-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -308,6 +308,26 @@ get_number_of_threads( scorep_profile_node* node, void* data )
 }
 
 
+/**
+   Returns the estimated measurement overhead for @a node, i.e., the number of
+   enter and exit events of the callpath times the calibrated cost of an event.
+   This functions are given to scorep_profile_write_cube_metric.
+   @param node Pointer to a node which should return the metric value.
+   @param data Ignored.
+   @returns the estimated overhead of @a node.
+ */
+static double
+get_overhead_value( scorep_profile_node* node, void* data )
+{
+    if ( node->node_type != SCOREP_PROFILE_NODE_REGULAR_REGION )
+    {
+        return 0.0;
+    }
+    return 2.0 * ( double )node->count * scorep_profile_ticks_per_event
+           / ( ( double )SCOREP_Timer_GetClockResolution() );
+}
+
+
 /**
    Returns the number of hits for @a node.
    This functions are given to scorep_profile_write_cube_metric.
@@ -1078,6 +1098,11 @@ init_layout( const scorep_cube_writing_data* writeSet,
         layout->metric_list = SCOREP_CUBE_METRIC_NONE;
     }
 
+    if ( scorep_profile_estimate_overhead )
+    {
+        layout->metric_list += SCOREP_CUBE_METRIC_OVERHEAD;
+    }
+
     switch ( writeSet->format )
     {
         case SCOREP_PROFILE_OUTPUT_CUBE4:
@@ -1236,6 +1261,12 @@ scorep_profile_write_cube4( SCOREP_Profile_OutputFormat format )
                             &get_number_of_threads, NULL );
     }
 
+    if ( layout.metric_list & SCOREP_CUBE_METRIC_OVERHEAD )
+    {
+        write_cube_doubles( &write_set, comm, scorep_get_overhead_handle(),
+                            &get_overhead_value, NULL );
+    }
+
     /* Write additional dense metrics (e.g. hardware counters) */
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_PROFILE, "Writing dense metrics" );
 
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2012, 2014,
+ * Copyright (c) 2009-2012, 2014, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -63,6 +63,7 @@ extern uint64_t scorep_profile_cluster_mode;
 extern char*    scorep_profile_clustered_region;
 extern bool     scorep_profile_enable_clustering;
 extern bool     scorep_profile_enable_core_files;
+extern char*    scorep_profile_parameter_integer_buckets;
 
 /*----------------------------------------------------------------------------------------
    Global variables
@@ -88,6 +89,11 @@ scorep_profile_definition scorep_profile =
  */
 uint32_t scorep_profile_number_of_program_args = 0;
 
+/**
+    Calibrated cost of one enter or exit event in timer ticks.
+ */
+double scorep_profile_ticks_per_event = 0.0;
+
 /*----------------------------------------------------------------------------------------
    Constructors / destructors
    -------------------------------------------------------------------------------------*/
@@ -191,3 +197,9 @@ scorep_profile_do_core_files( void )
 {
     return scorep_profile_enable_core_files;
 }
+
+const char*
+scorep_profile_get_parameter_integer_buckets( void )
+{
+    return scorep_profile_parameter_integer_buckets;
+}
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013,
+ * Copyright (c) 2009-2013, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -133,6 +133,17 @@ extern scorep_profile_definition scorep_profile;
 
 extern uint32_t scorep_profile_number_of_program_args;
 
+/**
+   True if the measurement overhead is estimated per callpath.
+ */
+extern bool scorep_profile_estimate_overhead;
+
+/**
+   Calibrated cost of one enter or exit event in timer ticks. Only set if
+   the measurement overhead is estimated.
+ */
+extern double scorep_profile_ticks_per_event;
+
 
 /* **************************************************************************************
    Functions
@@ -198,6 +209,27 @@ scorep_profile_do_clustering( void );
 bool
 scorep_profile_do_core_files( void );
 
+/**
+   Returns the configuration value for SCOREP_PROFILING_PARAMETER_INTEGER_BUCKETS.
+ */
+const char*
+scorep_profile_get_parameter_integer_buckets( void );
+
+/**
+   Parses the configuration of the integer parameter buckets.
+ */
+void
+scorep_profile_init_parameter_buckets( void );
+
+/**
+   Maps the integer value of parameter @a param to its bucket as configured by
+   SCOREP_PROFILING_PARAMETER_INTEGER_BUCKETS. Returns @a value unchanged if no
+   bucketing is configured or @a param is the dynamic region instance.
+ */
+uint64_t
+scorep_profile_bucket_parameter_value( SCOREP_ParameterHandle param,
+                                       uint64_t               value );
+
 
 /**
    Returns the number of locations stored in the profile.
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2015, 2022,
+ * Copyright (c) 2009-2013, 2015, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2015,
@@ -116,6 +116,7 @@ scorep_profile_finalize_location( SCOREP_Profile_LocationData* location )
     location->foreign_stubs         = NULL;
     location->num_foreign_tasks     = 0;
     location->num_foreign_stubs     = 0;
+    location->number_of_events      = 0;
 }
 
 
@@ -154,6 +155,7 @@ scorep_profile_create_location_data( SCOREP_Location* locationData )
     location->num_foreign_tasks     = 0;
     location->num_foreign_stubs     = 0;
     location->location_data         = locationData;
+    location->number_of_events      = 0;
     location->migration_sum         = 1;
     location->migration_win         = 0;
 
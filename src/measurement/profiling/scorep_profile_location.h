@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2015,
+ * Copyright (c) 2009-2013, 2015, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2012, 2014,
@@ -83,6 +83,7 @@ struct SCOREP_Profile_LocationData
     SCOREP_Location*                     location_data;            /**< Pointer to the Score-P location */
     scorep_profile_fork_list_node*       fork_list_head;           /**< Pointer to the list head of fork points */
     scorep_profile_fork_list_node*       fork_list_tail;           /**< Pointer to the list tail of fork points */
+    uint64_t                             number_of_events;         /**< Number of enter and exit events */
 };
 
 /**
@@ -7,7 +7,7 @@
  * Copyright (c) 2016-2018,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2019,
+ * Copyright (c) 2019, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -28,9 +28,12 @@
 #include <scorep_profile_definition.h>
 #include <scorep_profile_location.h>
 
+#include <UTILS_Error.h>
+
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <errno.h>
 #include <inttypes.h>
 
 static void
@@ -228,6 +231,145 @@ substitute_dynamic_instances_in_node( scorep_profile_node* node,
     }
 }
 
+/* ***************************************************************************************
+   Bucketing of integer parameter values
+*****************************************************************************************/
+
+/** No bucketing, every value gets its own node */
+#define BUCKETS_NONE 0
+/** Power-of-two buckets */
+#define BUCKETS_LOG2 1
+/** Buckets from a list of lower bounds */
+#define BUCKETS_LIST 2
+
+static int      bucket_mode = BUCKETS_NONE;
+static int64_t* bucket_bounds;
+static size_t   number_of_bucket_bounds;
+
+void
+scorep_profile_init_parameter_buckets( void )
+{
+    const char* config = scorep_profile_get_parameter_integer_buckets();
+
+    free( bucket_bounds );
+    bucket_bounds           = NULL;
+    number_of_bucket_bounds = 0;
+    bucket_mode             = BUCKETS_NONE;
+
+    if ( config == NULL || *config == '\0' || 0 == strcmp( config, "none" ) )
+    {
+        return;
+    }
+    if ( 0 == strcmp( config, "log2" ) )
+    {
+        bucket_mode = BUCKETS_LOG2;
+        return;
+    }
+
+    /* Comma separated list of strictly increasing lower bounds */
+    size_t capacity = 1;
+    for ( const char* c = config; *c; c++ )
+    {
+        capacity += ( *c == ',' );
+    }
+    bucket_bounds = malloc( capacity * sizeof( *bucket_bounds ) );
+    UTILS_ASSERT( bucket_bounds );
+
+    const char* current = config;
+    while ( true )
+    {
+        char* end;
+        errno = 0;
+        int64_t bound = strtoll( current, &end, 0 );
+        while ( *end == ' ' )
+        {
+            end++;
+        }
+        if ( errno != 0 || end == current || ( *end != ',' && *end != '\0' )
+             || ( number_of_bucket_bounds > 0
+                  && bound <= bucket_bounds[ number_of_bucket_bounds - 1 ] ) )
+        {
+            UTILS_WARNING( "Invalid value for SCOREP_PROFILING_PARAMETER_INTEGER_BUCKETS: "
+                           "'%s'. Expected 'log2' or a comma separated list of "
+                           "strictly increasing integers. Integer parameters are "
+                           "not bucketed.", config );
+            free( bucket_bounds );
+            bucket_bounds           = NULL;
+            number_of_bucket_bounds = 0;
+            return;
+        }
+        bucket_bounds[ number_of_bucket_bounds++ ] = bound;
+        if ( *end == '\0' )
+        {
+            break;
+        }
+        current = end + 1;
+    }
+    bucket_mode = BUCKETS_LIST;
+}
+
+
+static uint64_t
+bucket_log2( uint64_t magnitude )
+{
+    uint64_t bound = 1;
+    while ( ( magnitude >> 1 ) >= bound )
+    {
+        bound <<= 1;
+    }
+    return bound;
+}
+
+
+uint64_t
+scorep_profile_bucket_parameter_value( SCOREP_ParameterHandle param,
+                                       uint64_t               value )
+{
+    if ( bucket_mode == BUCKETS_NONE || param == scorep_profile_param_instance )
+    {
+        return value;
+    }
+
+    bool is_signed = SCOREP_ParameterHandle_GetType( param ) == SCOREP_PARAMETER_INT64;
+
+    if ( bucket_mode == BUCKETS_LOG2 )
+    {
+        if ( value == 0 )
+        {
+            return 0;
+        }
+        if ( is_signed && ( int64_t )value < 0 )
+        {
+            /* Negative values are bucketed by their magnitude */
+            return 0 - bucket_log2( 0 - value );
+        }
+        return bucket_log2( value );
+    }
+
+    /* Largest bound not greater than value, values below the first bound
+       belong to the first bucket. */
+    if ( !is_signed && value > INT64_MAX )
+    {
+        return ( uint64_t )bucket_bounds[ number_of_bucket_bounds - 1 ];
+    }
+    size_t low  = 0;
+    size_t high = number_of_bucket_bounds;
+    while ( high - low > 1 )
+    {
+        size_t mid = low + ( high - low ) / 2;
+        if ( bucket_bounds[ mid ] <= ( int64_t )value )
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return ( uint64_t )bucket_bounds[ low ];
+}
+
+
 /* ***************************************************************************************
    Main algorithm function
 *****************************************************************************************/
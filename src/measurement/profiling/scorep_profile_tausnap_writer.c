@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2017,
+ * Copyright (c) 2009-2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -44,7 +44,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <assert.h>
+#include <errno.h>
 #include <sys/stat.h>
 
 #include <SCOREP_Memory.h>
@@ -63,11 +65,90 @@
 #include <scorep_profile_location.h>
 
 
+/**
+   Number of files into which the snapshots of all processes are written.
+   Zero if every process writes its own file.
+ */
+extern uint64_t scorep_profile_tau_snapshot_files;
+
+/**
+   Size of the pieces in which a snapshot is passed to the process which writes
+   it into an aggregated file. Fits into the message buffers of all IPC
+   implementations.
+ */
+#define TAU_SNAPSHOT_CHUNK_SIZE ( 8 * 1024 )
+
+/**
+   The snapshot of a process. It is created in memory and written out at once.
+ */
+typedef struct tau_buffer
+{
+    char*  data;
+    size_t size;
+    size_t capacity;
+} tau_buffer;
+
+
+static void
+buffer_printf( tau_buffer* buffer,
+               const char* format,
+               ... )
+{
+    va_list args;
+    va_start( args, format );
+    int length = vsnprintf( buffer->data + buffer->size,
+                            buffer->capacity - buffer->size,
+                            format, args );
+    va_end( args );
+    UTILS_ASSERT( length >= 0 );
+
+    if ( buffer->size + length >= buffer->capacity )
+    {
+        while ( buffer->size + length >= buffer->capacity )
+        {
+            buffer->capacity *= 2;
+        }
+        buffer->data = realloc( buffer->data, buffer->capacity );
+        UTILS_ASSERT( buffer->data );
+
+        va_start( args, format );
+        vsnprintf( buffer->data + buffer->size,
+                   buffer->capacity - buffer->size,
+                   format, args );
+        va_end( args );
+    }
+    buffer->size += length;
+}
+
+
+/**
+   Creates a formatted string. The caller must free the result.
+ */
+static char*
+format_string( const char* format,
+               ... )
+{
+    va_list args;
+    va_start( args, format );
+    int length = vsnprintf( NULL, 0, format, args );
+    va_end( args );
+    UTILS_ASSERT( length >= 0 );
+
+    char* path = malloc( length + 1 );
+    UTILS_ASSERT( path );
+
+    va_start( args, format );
+    vsnprintf( path, length + 1, format, args );
+    va_end( args );
+    return path;
+}
+
+
 /* Forward declaration */
 static void
 write_node_tau( scorep_profile_node* node,
                 char*                parentpath,
-                FILE*                file,
+                tau_buffer*          file,
                 uint64_t*            callpath_counter );
 
 /**
@@ -166,14 +247,14 @@ xmlize_string( const char* str )
                            number of processed callpathes.
  */
 static void
-write_tausnap_def( char*     path,
-                   FILE*     file,
-                   uint64_t* callpath_counter )
+write_tausnap_def( char*       path,
+                   tau_buffer* file,
+                   uint64_t*   callpath_counter )
 {
-    fprintf( file,
-             "<event id=\"%" PRIu64 "\"><name>%s</name></event>\n",
-             *callpath_counter,
-             path );
+    buffer_printf( file,
+                   "<event id=\"%" PRIu64 "\"><name>%s</name></event>\n",
+                   *callpath_counter,
+                   path );
     ( *callpath_counter )++;
 }
 
@@ -194,25 +275,14 @@ write_tausnap_def( char*     path,
 static void
 write_region_tau( scorep_profile_node* node,
                   char*                parentpath,
-                  FILE*                file,
+                  tau_buffer*          file,
                   uint64_t*            callpath_counter )
 {
     /* Construct callpath name */
-    char* name   = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( node->type_specific_data ) ) );
-    int   length = strlen( name ) + 1;
-    if ( parentpath )
-    {
-        length += strlen( parentpath ) + 7;
-    }
-    char* path = malloc( length );
-    if ( parentpath == NULL )
-    {
-        strcpy( path, name );
-    }
-    else
-    {
-        sprintf( path, "%s =&gt; %s", parentpath, name );
-    }
+    char* name = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( node->type_specific_data ) ) );
+    char* path = parentpath
+                 ? format_string( "%s =&gt; %s", parentpath, name )
+                 : UTILS_CStr_dup( name );
     free( name );
 
     /* write definition */
@@ -250,7 +320,7 @@ write_region_tau( scorep_profile_node* node,
 static void
 write_paramstring_tau( scorep_profile_node* node,
                        char*                parentpath,
-                       FILE*                file,
+                       tau_buffer*          file,
                        uint64_t*            callpath_counter )
 {
     /* Construct callpath name */
@@ -263,11 +333,7 @@ write_paramstring_tau( scorep_profile_node* node,
         const char* parentname = SCOREP_ParameterHandle_GetName( node->parent->type_specific_data.handle );
         parentpath = UTILS_CStr_dup( parentname );
     }
-    /* Length is "<path> (<name> = <value>)" plus terminating '\0' */
-    int length = strlen( parentpath ) + strlen( param_name ) + 24 + strlen( param_value ) + 1;
-    path = ( char* )malloc( length );
-// [ &lt;%s&gt; = &lt;%" PRIi64 "&gt; ]
-    sprintf( path, "%s [ &lt;%s&gt; = &lt;%s&gt; ]", parentpath, param_name, param_value );
+    path = format_string( "%s [ &lt;%s&gt; = &lt;%s&gt; ]", parentpath, param_name, param_value );
     free( param_name );
     free( param_value );
 
@@ -302,7 +368,7 @@ write_paramstring_tau( scorep_profile_node* node,
 static void
 write_paramint_tau( scorep_profile_node* node,
                     char*                parentpath,
-                    FILE*                file,
+                    tau_buffer*          file,
                     uint64_t*            callpath_counter )
 {
     /* Construct callpath name */
@@ -317,33 +383,15 @@ write_paramint_tau( scorep_profile_node* node,
     }
     if ( param == scorep_profile_param_instance )
     {
-        /* 12 digit max data length. */
-        int length = strlen( parentpath ) + 12 + 3 + 1;
-        path = ( char* )malloc( length );
-        sprintf( path, "%s [%" PRIu64 "]", parentpath,
-                 node->type_specific_data.value );
+        path = format_string( "%s [%" PRIu64 "]", parentpath,
+                              node->type_specific_data.value );
     }
     else
     {
-        /* 12 digit max data length. */
-        int length = strlen( parentpath ) +
-                     strlen( SCOREP_ParameterHandle_GetName( param ) ) +
-                     21 + 6 + 1;
-        SCOREP_ParameterType type = SCOREP_ParameterHandle_GetType( param );
-        path = ( char* )malloc( length );
 //![CDATA[int f2(int) [{simpleTau.cpp} {5,1}-{10,1}]   [ <y> = <2> ]]]
-        if ( type == SCOREP_PARAMETER_INT64 )
-        {
-            sprintf( path, "%s [ &lt;%s&gt; = &lt;%" PRIi64 "&gt; ]", parentpath,
-                     param_name,
-                     scorep_profile_type_get_int_value( node->type_specific_data ) );
-        }
-        else
-        {
-            sprintf( path, "%s [ &lt;%s&gt; = &lt;%" PRIi64 "&gt; ]", parentpath,
-                     param_name,
-                     scorep_profile_type_get_int_value( node->type_specific_data ) );
-        }
+        path = format_string( "%s [ &lt;%s&gt; = &lt;%" PRIi64 "&gt; ]", parentpath,
+                              param_name,
+                              scorep_profile_type_get_int_value( node->type_specific_data ) );
     }
     free( param_name );
 
@@ -379,7 +427,7 @@ write_paramint_tau( scorep_profile_node* node,
 static void
 write_node_tau( scorep_profile_node* node,
                 char*                parentpath,
-                FILE*                file,
+                tau_buffer*          file,
                 uint64_t*            callpath_counter )
 {
     if ( node == NULL )
@@ -422,21 +470,21 @@ get_metrics_start_from_array( scorep_profile_node* node, int index )
 
 static void
 write_metric_data_tau( scorep_profile_node*      node,
-                       FILE*                     file,
+                       tau_buffer*               file,
                        SCOREP_DefinitionManager* manager )
 {
     for ( int i = 0; i  < SCOREP_Metric_GetNumberOfStrictlySynchronousMetrics(); i++ )
     {
-        fprintf( file,
-                 " %" PRIu64 " %" PRIu64,
-                 get_metrics_sum_from_array( node,  i ),
-                 get_metrics_start_from_array( node, i ) );
+        buffer_printf( file,
+                       " %" PRIu64 " %" PRIu64,
+                       get_metrics_sum_from_array( node,  i ),
+                       get_metrics_start_from_array( node, i ) );
     }
 }
 
 static void
 write_metrics_tau( scorep_profile_node*      node,
-                   FILE*                     file,
+                   tau_buffer*               file,
                    SCOREP_DefinitionManager* manager )
 {
     SCOREP_MetricDef* metric_definition;
@@ -460,9 +508,9 @@ write_metrics_tau( scorep_profile_node*      node,
             metric_unit        = xmlize_string( metric_unit );
             metric_description = xmlize_string( metric_description );
 
-            fprintf( file, "<metric id=\"%d\"><name>%s</name>\n", i, metric_name );
-            fprintf( file, "<units>%s</units>\n", metric_unit );
-            fprintf( file, "</metric>\n" );
+            buffer_printf( file, "<metric id=\"%d\"><name>%s</name>\n", i, metric_name );
+            buffer_printf( file, "<units>%s</units>\n", metric_unit );
+            buffer_printf( file, "</metric>\n" );
             i++;
 
             free( metric_name );
@@ -489,7 +537,7 @@ write_metrics_tau( scorep_profile_node*      node,
  */
 static void
 write_data_tau( scorep_profile_node*      node,
-                FILE*                     file,
+                tau_buffer*               file,
                 uint64_t*                 callpath_counter,
                 SCOREP_DefinitionManager* manager )
 
@@ -501,14 +549,14 @@ write_data_tau( scorep_profile_node*      node,
      */
     if ( node->node_type != SCOREP_PROFILE_NODE_REGULAR_REGION || SCOREP_RegionHandle_GetType( scorep_profile_type_get_region_handle( node->type_specific_data ) ) != SCOREP_REGION_DYNAMIC )
     {
-        fprintf( file,
-                 "%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64,
-                 *callpath_counter, node->count,
-                 scorep_profile_get_number_of_child_calls( node ),
-                 ( scorep_profile_get_exclusive_time( node ) * 1000000 / tps ),
-                 ( node->inclusive_time.sum * 1000000 / tps ) );
+        buffer_printf( file,
+                       "%" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64,
+                       *callpath_counter, node->count,
+                       scorep_profile_get_number_of_child_calls( node ),
+                       ( scorep_profile_get_exclusive_time( node ) * 1000000 / tps ),
+                       ( node->inclusive_time.sum * 1000000 / tps ) );
         write_metric_data_tau( node, file, manager );
-        fprintf( file, "\n" );
+        buffer_printf( file, "\n" );
         ( *callpath_counter )++;
     }
     if ( node->callpath_handle != SCOREP_INVALID_CALLPATH )
@@ -546,7 +594,7 @@ static item* tail;
 
 static void
 write_atomicdata_tau( scorep_profile_node*      node,
-                      FILE*                     file,
+                      tau_buffer*               file,
                       uint64_t*                 callpath_counter,
                       SCOREP_DefinitionManager* manager )
 {
@@ -570,9 +618,9 @@ write_atomicdata_tau( scorep_profile_node*      node,
             curr = curr->next;
         }
 
-        fprintf( file, "%d %" PRIu64 " %.16G %.16G %.16G %.16G\n",
-                 eventID, metric->count, metric->max, metric->min,
-                 metric->sum / metric->count, metric->squares );
+        buffer_printf( file, "%d %" PRIu64 " %.16G %.16G %.16G %.16G\n",
+                       eventID, metric->count, metric->max, metric->min,
+                       metric->sum / metric->count, metric->squares );
         metric = metric->next_metric;
     }
 
@@ -597,7 +645,7 @@ write_atomicdata_tau( scorep_profile_node*      node,
 static void
 write_userevent_data_metric_tau( scorep_profile_node*      node,
                                  char*                     parentpath,
-                                 FILE*                     file,
+                                 tau_buffer*               file,
                                  SCOREP_DefinitionManager* manager )
 
 {
@@ -656,14 +704,12 @@ write_userevent_data_metric_tau( scorep_profile_node*      node,
             char* found = strchr( metric_name, ':' );
             if ( found != NULL )
             {
-                int   length     = strlen( metric_name ) + 1 + strlen( parentpath ) + 2;
-                char* metricpath = ( char* )malloc( length );
-                sprintf( metricpath, "%s %s", metric_name, parentpath );
+                char* metricpath = format_string( "%s %s", metric_name, parentpath );
                 free( metric_name );
                 metric_name = metricpath;
             }
-            fprintf( file, "<userevent id=\"%d\"><name>%s</name>", eventID, metric_name );
-            fprintf( file, "</userevent>\n" );
+            buffer_printf( file, "<userevent id=\"%d\"><name>%s</name>", eventID, metric_name );
+            buffer_printf( file, "</userevent>\n" );
 
             free( metric_name );
         }
@@ -677,21 +723,10 @@ write_userevent_data_metric_tau( scorep_profile_node*      node,
         if ( child != NULL )
         {
             /* Construct callpath name */
-            char* name   = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( child->type_specific_data ) ) );
-            int   length = strlen( name ) + 1;
-            if ( parentpath )
-            {
-                length += strlen( parentpath ) + 7;
-            }
-            char* path = malloc( length );
-            if ( parentpath == NULL )
-            {
-                strcpy( path, name );
-            }
-            else
-            {
-                sprintf( path, "%s =&gt; %s", parentpath, name );
-            }
+            char* name = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( child->type_specific_data ) ) );
+            char* path = parentpath
+                         ? format_string( "%s =&gt; %s", parentpath, name )
+                         : UTILS_CStr_dup( name );
             parentpath = path;
             free( name );
             free( path );
@@ -715,7 +750,7 @@ write_userevent_data_metric_tau( scorep_profile_node*      node,
 static void
 write_userevent_data_tau( scorep_profile_node*      child,
                           uint64_t                  threadnum,
-                          FILE*                     file,
+                          tau_buffer*               file,
                           SCOREP_DefinitionManager* manager )
 {
     head = NULL;
@@ -728,21 +763,10 @@ write_userevent_data_tau( scorep_profile_node*      child,
         while ( child != NULL )
         {
             /* Construct callpath name */
-            char* name   = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( node->type_specific_data ) ) );
-            int   length = strlen( name ) + 1;
-            if ( parentpath )
-            {
-                length += strlen( parentpath ) + 7;
-            }
-            char* path = ( char* )malloc( length );
-            if ( parentpath == NULL )
-            {
-                strcpy( path, name );
-            }
-            else
-            {
-                sprintf( path, "%s =&gt; %s", parentpath, name );
-            }
+            char* name = xmlize_string( SCOREP_RegionHandle_GetName( scorep_profile_type_get_region_handle( node->type_specific_data ) ) );
+            char* path = parentpath
+                         ? format_string( "%s =&gt; %s", parentpath, name )
+                         : UTILS_CStr_dup( name );
 
             parentpath = path;
             write_userevent_data_metric_tau( child, path, file, manager );
@@ -770,7 +794,7 @@ write_userevent_data_tau( scorep_profile_node*      child,
 static void
 write_thread_tau( scorep_profile_node*      node,
                   uint64_t                  threadnum,
-                  FILE*                     file,
+                  tau_buffer*               file,
                   SCOREP_DefinitionManager* manager )
 {
     /* The counter is used to enumerate the callpathes and
@@ -781,31 +805,31 @@ write_thread_tau( scorep_profile_node*      node,
     UTILS_ASSERT( node != NULL );
 
     /* Write thread definition */
-    fprintf( file,
-             "<thread id=\"%d.0.%" PRIu64 ".0\" node=\"%d"
-             "\" context=\"0\" thread=\"%" PRIu64 "\">\n",
-             SCOREP_Ipc_GetRank(), threadnum, SCOREP_Ipc_GetRank(), threadnum );
-    fprintf( file, "</thread>\n\n" );
-    fprintf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
-             SCOREP_Ipc_GetRank(), threadnum );
-    fprintf( file, "<metric id=\"0\"><name>TIME</name>\n" );
-    fprintf( file, "<units>ms</units>\n" );
-    fprintf( file, "</metric>\n" );
+    buffer_printf( file,
+                   "<thread id=\"%d.0.%" PRIu64 ".0\" node=\"%d"
+                   "\" context=\"0\" thread=\"%" PRIu64 "\">\n",
+                   SCOREP_Ipc_GetRank(), threadnum, SCOREP_Ipc_GetRank(), threadnum );
+    buffer_printf( file, "</thread>\n\n" );
+    buffer_printf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
+                   SCOREP_Ipc_GetRank(), threadnum );
+    buffer_printf( file, "<metric id=\"0\"><name>TIME</name>\n" );
+    buffer_printf( file, "<units>ms</units>\n" );
+    buffer_printf( file, "</metric>\n" );
     write_metrics_tau( node, file, manager );
-    fprintf( file, "</definitions>\n\n" );
+    buffer_printf( file, "</definitions>\n\n" );
 
 
     scorep_profile_node* child = node->first_child;
 
-    fprintf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
-             SCOREP_Ipc_GetRank(), threadnum );
+    buffer_printf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
+                   SCOREP_Ipc_GetRank(), threadnum );
     write_userevent_data_tau( child, threadnum, file,  manager );
 
-    fprintf( file, "</definitions>\n\n" );
+    buffer_printf( file, "</definitions>\n\n" );
 
     /* Write callpath definition */
-    fprintf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
-             SCOREP_Ipc_GetRank(), threadnum );
+    buffer_printf( file, "<definitions thread=\"%d.0.%" PRIu64 ".0\">\n",
+                   SCOREP_Ipc_GetRank(), threadnum );
     callpath_counter = 0;
 
     while ( child != NULL )
@@ -813,19 +837,19 @@ write_thread_tau( scorep_profile_node*      node,
         write_node_tau( child, NULL, file, &callpath_counter );
         child = child->next_sibling;
     }
-    fprintf( file, "</definitions>\n\n" );
+    buffer_printf( file, "</definitions>\n\n" );
 
 
     /* Write metrics data */
-    fprintf( file, "<profile thread=\"%d.0.%" PRIu64 ".0\">\n",
-             SCOREP_Ipc_GetRank(), threadnum );
-    fprintf( file, "<name>final</name>\n" );
-    fprintf( file, "<interval_data metrics=\"0" );
+    buffer_printf( file, "<profile thread=\"%d.0.%" PRIu64 ".0\">\n",
+                   SCOREP_Ipc_GetRank(), threadnum );
+    buffer_printf( file, "<name>final</name>\n" );
+    buffer_printf( file, "<interval_data metrics=\"0" );
     for ( int i = 0; i < SCOREP_Metric_GetNumberOfStrictlySynchronousMetrics(); i++ )
     {
-        fprintf( file, " %d", i + 1 );
+        buffer_printf( file, " %d", i + 1 );
     }
-    fprintf( file, "\">\n" );
+    buffer_printf( file, "\">\n" );
     child            = node->first_child;
     callpath_counter = 0;
     while ( child != NULL )
@@ -833,9 +857,9 @@ write_thread_tau( scorep_profile_node*      node,
         write_data_tau( child, file, &callpath_counter, manager );
         child = child->next_sibling;
     }
-    fprintf( file, "</interval_data>\n" );
+    buffer_printf( file, "</interval_data>\n" );
 /*Write Atomic Data*/
-    fprintf( file, "<atomic_data>\n" );
+    buffer_printf( file, "<atomic_data>\n" );
     child            = node->first_child;
     callpath_counter = 0;
     if ( child->next_sibling != NULL )
@@ -848,9 +872,9 @@ write_thread_tau( scorep_profile_node*      node,
         write_atomicdata_tau( child, file, &callpath_counter, manager );
         child = child->next_sibling;
     }
-    fprintf( file, "</atomic_data>\n" );
+    buffer_printf( file, "</atomic_data>\n" );
 
-    fprintf( file, "</profile>\n\n" );
+    buffer_printf( file, "</profile>\n\n" );
 }
 
 /**
@@ -958,6 +982,183 @@ write_tau_add_callpath_nodes( scorep_profile_node* parent )
     }
 }
 
+/**
+   Writes the snapshot of this process into its own file.
+ */
+static void
+write_process_file( const char* dirname,
+                    tau_buffer* buffer )
+{
+    char* filename = format_string( "%s/snapshot.%d.0.0", dirname, SCOREP_Ipc_GetRank() );
+    FILE* file     = fopen( filename, "w" );
+    free( filename );
+    if ( !file )
+    {
+        UTILS_ERROR_POSIX( "Failed to write profile. Unable to open file" );
+        return;
+    }
+
+    if ( fwrite( buffer->data, 1, buffer->size, file ) != buffer->size )
+    {
+        UTILS_ERROR_POSIX( "Failed to write profile" );
+    }
+    fclose( file );
+}
+
+
+/**
+   Returns the number of the aggregated file which contains the snapshot of
+   @a rank. The processes are distributed evenly in consecutive blocks.
+ */
+static uint64_t
+get_file_number( int      rank,
+                 int      numberOfProcesses,
+                 uint64_t numberOfFiles )
+{
+    return ( uint64_t )rank * numberOfFiles / numberOfProcesses;
+}
+
+
+/**
+   Returns the first rank whose snapshot is contained in the aggregated file
+   @a fileNumber. This process writes the file.
+ */
+static int
+get_first_rank_of_file( uint64_t fileNumber,
+                        int      numberOfProcesses,
+                        uint64_t numberOfFiles )
+{
+    return ( fileNumber * numberOfProcesses + numberOfFiles - 1 ) / numberOfFiles;
+}
+
+
+/**
+   Passes the snapshot of this process to the process which writes it into an
+   aggregated file.
+ */
+static void
+send_snapshot( tau_buffer* buffer,
+               int         writer )
+{
+    uint64_t size = buffer->size;
+    SCOREP_Ipc_Send( &size, 1, SCOREP_IPC_UINT64_T, writer );
+
+    for ( uint64_t offset = 0; offset < size; offset += TAU_SNAPSHOT_CHUNK_SIZE )
+    {
+        uint64_t chunk_size = size - offset < TAU_SNAPSHOT_CHUNK_SIZE
+                              ? size - offset : TAU_SNAPSHOT_CHUNK_SIZE;
+        SCOREP_Ipc_Send( buffer->data + offset, chunk_size, SCOREP_IPC_BYTE, writer );
+    }
+}
+
+
+/**
+   Writes the snapshots of the ranks [first, end) into the aggregated file
+   @a fileNumber, ordered by rank. This process is @a first. The snapshots of
+   the other processes are received one after the other, thus only one chunk
+   of them is held in memory at a time.
+ */
+static void
+write_aggregated_file( const char* dirname,
+                       tau_buffer* buffer,
+                       uint64_t    fileNumber,
+                       int         first,
+                       int         end )
+{
+    char* filename = format_string( "%s/snapshot.aggregated.%" PRIu64, dirname, fileNumber );
+    FILE* file     = fopen( filename, "w" );
+    free( filename );
+    if ( !file )
+    {
+        /* Still receive the snapshots, the other processes wait for it. */
+        UTILS_ERROR_POSIX( "Failed to write profile. Unable to open file" );
+    }
+
+    bool success = !file || fwrite( buffer->data, 1, buffer->size, file ) == buffer->size;
+
+    char chunk[ TAU_SNAPSHOT_CHUNK_SIZE ];
+    for ( int rank = first + 1; rank < end; rank++ )
+    {
+        uint64_t size;
+        SCOREP_Ipc_Recv( &size, 1, SCOREP_IPC_UINT64_T, rank );
+
+        for ( uint64_t offset = 0; offset < size; offset += TAU_SNAPSHOT_CHUNK_SIZE )
+        {
+            uint64_t chunk_size = size - offset < TAU_SNAPSHOT_CHUNK_SIZE
+                                  ? size - offset : TAU_SNAPSHOT_CHUNK_SIZE;
+            SCOREP_Ipc_Recv( chunk, chunk_size, SCOREP_IPC_BYTE, rank );
+            if ( file && success )
+            {
+                success = fwrite( chunk, 1, chunk_size, file ) == chunk_size;
+            }
+        }
+    }
+
+    if ( file )
+    {
+        if ( !success )
+        {
+            UTILS_ERROR_POSIX( "Failed to write profile" );
+        }
+        fclose( file );
+    }
+}
+
+
+/**
+   Writes the index of the aggregated files on rank 0. For every rank, it
+   lists the file which contains its snapshot and the offset and length of
+   the snapshot in this file. Collective over all processes.
+ */
+static void
+write_index( const char* dirname,
+             tau_buffer* buffer,
+             uint64_t    numberOfFiles )
+{
+    int       rank                = SCOREP_Ipc_GetRank();
+    int       number_of_processes = SCOREP_Ipc_GetSize();
+    uint64_t  size                = buffer->size;
+    uint64_t* sizes               = NULL;
+    if ( rank == 0 )
+    {
+        sizes = calloc( number_of_processes, sizeof( *sizes ) );
+        UTILS_ASSERT( sizes );
+    }
+    SCOREP_Ipc_Gather( &size, sizes, 1, SCOREP_IPC_UINT64_T, 0 );
+    if ( rank != 0 )
+    {
+        return;
+    }
+
+    char* filename = format_string( "%s/snapshot.index", dirname );
+    FILE* file     = fopen( filename, "w" );
+    free( filename );
+    if ( !file )
+    {
+        UTILS_ERROR_POSIX( "Failed to write profile index. Unable to open file" );
+        free( sizes );
+        return;
+    }
+
+    fprintf( file, "# rank file offset length\n" );
+    uint64_t offset = 0;
+    for ( int i = 0; i < number_of_processes; i++ )
+    {
+        uint64_t file_number = get_file_number( i, number_of_processes, numberOfFiles );
+        if ( i == get_first_rank_of_file( file_number, number_of_processes, numberOfFiles ) )
+        {
+            offset = 0;
+        }
+        fprintf( file, "%d snapshot.aggregated.%" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+                 i, file_number, offset, sizes[ i ] );
+        offset += sizes[ i ];
+    }
+
+    fclose( file );
+    free( sizes );
+}
+
+
 /* rImplemetatio  of the top function for writing a TAU snapshot profile.
  */
 void
@@ -967,9 +1168,6 @@ scorep_profile_write_tau_snapshot( void )
     scorep_profile_node* thread    = scorep_profile.first_root_node;
 
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_PROFILE, "Write profile in TAU snapshot format" );
-    FILE* file;
-    char  filename[ 600 ];
-    char  dirname[ 500 ];
 
     /* The unification is always processed, even in serial case. Thus, we have
         always access to the unified definitions on rank 0.
@@ -981,42 +1179,82 @@ scorep_profile_write_tau_snapshot( void )
         assert( scorep_unified_definition_manager );
     }
 
-    /* Create sub directory 'tau' */
-    sprintf( dirname, "%s/tau", SCOREP_GetExperimentDirName() );
-    if ( mkdir( dirname, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH ) != 0 )
+    int      rank                = SCOREP_Ipc_GetRank();
+    int      number_of_processes = SCOREP_Ipc_GetSize();
+    uint64_t number_of_files     = scorep_profile_tau_snapshot_files;
+    if ( number_of_files > ( uint64_t )number_of_processes )
     {
-        if ( errno != EEXIST )
-        {
-            UTILS_ERROR_POSIX( "Unable to create directory for snapshot profile" );
-            return;
-        }
+        number_of_files = number_of_processes;
     }
 
-    /* Open file */
-    sprintf( filename, "%s/snapshot.%d.0.0", dirname, SCOREP_Ipc_GetRank() );
-    file = fopen( filename, "w" );
-    if ( !file )
+    /* In aggregated mode, only the writers of the files need the directory */
+    uint64_t file_number = 0;
+    int      first       = rank;
+    int      end         = rank + 1;
+    if ( number_of_files > 0 )
     {
-        UTILS_ERROR_POSIX( "Failed to write profile. Unable to open file" );
+        file_number = get_file_number( rank, number_of_processes, number_of_files );
+        first       = get_first_rank_of_file( file_number, number_of_processes, number_of_files );
+        end         = get_first_rank_of_file( file_number + 1, number_of_processes, number_of_files );
+    }
+
+    /* Create sub directory 'tau' */
+    char* dirname = format_string( "%s/tau", SCOREP_GetExperimentDirName() );
+    bool  failed  = false;
+    if ( rank == first
+         && mkdir( dirname, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH ) != 0
+         && errno != EEXIST )
+    {
+        UTILS_ERROR_POSIX( "Unable to create directory for snapshot profile" );
+        failed = true;
+    }
+    if ( failed && number_of_files == 0 )
+    {
+        free( dirname );
         return;
     }
+
     /*Add the summary nodes to the calltree*/
     scorep_profile_node* root = scorep_profile.first_root_node;
     write_tau_add_callpath_nodes( root );
 
+    tau_buffer buffer;
+    buffer.size     = 0;
+    buffer.capacity = 64 * 1024;
+    buffer.data     = malloc( buffer.capacity );
+    UTILS_ASSERT( buffer.data );
+
     /* Write starting tag */
-    fprintf( file, "<profile_xml>\n" );
+    buffer_printf( &buffer, "<profile_xml>\n" );
 
     /* Write thread data */
     while ( thread != NULL )
     {
-        write_thread_tau( thread, threadnum, file, manager );
+        write_thread_tau( thread, threadnum, &buffer, manager );
         thread = thread->next_sibling;
         threadnum++;
     }
 
-    /* Write closing tag and close file */
-    fprintf( file, "</profile_xml>\n" );
+    /* Write closing tag */
+    buffer_printf( &buffer, "</profile_xml>\n" );
 
-    fclose( file );
+    if ( number_of_files == 0 )
+    {
+        write_process_file( dirname, &buffer );
+    }
+    else
+    {
+        if ( rank == first )
+        {
+            write_aggregated_file( dirname, &buffer, file_number, first, end );
+        }
+        else
+        {
+            send_snapshot( &buffer, first );
+        }
+        write_index( dirname, &buffer, number_of_files );
+    }
+
+    free( buffer.data );
+    free( dirname );
 }
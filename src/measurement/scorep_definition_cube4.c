@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2017, 2019-2020, 2022-2024,
+ * Copyright (c) 2009-2017, 2019-2020, 2022-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -165,6 +165,7 @@ static cube_metric* time_min_handle;
 static cube_metric* visits_handle;
 static cube_metric* num_threads_handle;
 static cube_metric* hits_handle;
+static cube_metric* overhead_handle;
 
 /**
    Node type definition for temporary internal system tree structure for Cube definition
@@ -529,6 +530,12 @@ scorep_get_num_threads_handle( void )
     return num_threads_handle;
 }
 
+cube_metric*
+scorep_get_overhead_handle( void )
+{
+    return overhead_handle;
+}
+
 /* ****************************************************************************
  * Internal definition writer functions
  *****************************************************************************/
@@ -566,6 +573,15 @@ write_metric_definitions( cube_t*                       myCube,
                                            "Number of threads", NULL, CUBE_METRIC_EXCLUSIVE );
     }
 
+    if ( layout->metric_list & SCOREP_CUBE_METRIC_OVERHEAD )
+    {
+        overhead_handle = cube_def_met( myCube, "Measurement Overhead", "overhead",
+                                        "DOUBLE", "sec", "",
+                                        "@mirror@scorep_metrics.html#overhead",
+                                        "Estimated measurement overhead", NULL,
+                                        CUBE_METRIC_EXCLUSIVE );
+    }
+
     if ( layout->dense_metric_type == SCOREP_CUBE_DATA_SCALAR )
     {
         time_sum_handle = cube_def_met( myCube, "Time", "time", "DOUBLE", "sec", "",
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011, 2013, 2019, 2024,
+ * Copyright (c) 2009-2011, 2013, 2019, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011, 2014
@@ -83,7 +83,8 @@ typedef enum
     SCOREP_CUBE_METRIC_NONE         = 0,
     SCOREP_CUBE_METRIC_VISITS       = 1,
     SCOREP_CUBE_METRIC_NUM_THREADS  = 2,
-    SCOREP_CUBE_METRIC_TASK_METRICS = 4
+    SCOREP_CUBE_METRIC_TASK_METRICS = 4,
+    SCOREP_CUBE_METRIC_OVERHEAD     = 8
 } scorep_cube_metric_list;
 
 /**
@@ -283,4 +284,10 @@ scorep_get_min_time_handle( void );
 cube_metric*
 scorep_get_num_threads_handle( void );
 
+/**
+   Returns the handle used for metric 'estimated measurement overhead'.
+ */
+cube_metric*
+scorep_get_overhead_handle( void );
+
 #endif /* SCOREP_DEFINITION_CUBE4_H */
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011, 2015, 2017-2018, 2024,
+ * Copyright (c) 2009-2011, 2015, 2017-2018, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -71,6 +71,8 @@ static bool     env_overwrite_experiment_directory;
 static char*    env_machine_name;
 static char*    env_executable;
 static bool     force_cfg_files;
+static uint64_t env_clock_resync_interval;
+static uint64_t env_string_parameter_max_values;
 
 /*
  * Tracing setup
@@ -227,6 +229,34 @@ static const SCOREP_ConfigVariable core_confvars[] = {
         "If this is set to `false`, the directory will only be created if any "
         "substrate actually writes data."
     },
+    {
+        "clock_resync_interval",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &env_clock_resync_interval,
+        NULL,
+        "0",
+        "Interval in seconds between in-run clock synchronizations",
+        "By default, clock offsets between processes are only measured at "
+        "begin and end of the measurement, and the drift in between is assumed "
+        "to be linear. If set to a positive value, the offsets are measured "
+        "again roughly every this many seconds at a synchronizing collective "
+        "over all processes (e.g., `MPI_Barrier` or `MPI_Allreduce` on "
+        "`MPI_COMM_WORLD`). The trace timestamps are then corrected "
+        "piecewise-linearly between these points. Only in effect when tracing "
+        "with a non-global timer. A value of 0 disables this."
+    },
+    {
+        "string_parameter_max_values",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &env_string_parameter_max_values,
+        NULL,
+        "0",
+        "Maximum number of distinct values per string parameter and location",
+        "Once a string parameter had this many distinct values on a location, "
+        "all further new values are recorded as the value `<other>`. This "
+        "bounds the growth of the call tree in the profile for parameters with "
+        "many distinct values. A value of 0 means no limit."
+    },
     SCOREP_CONFIG_TERMINATOR
 };
 
@@ -329,6 +359,20 @@ SCOREP_Env_DoForceCfgFiles( void )
     return force_cfg_files;
 }
 
+uint64_t
+SCOREP_Env_GetClockResyncInterval( void )
+{
+    assert( env_variables_initialized );
+    return env_clock_resync_interval;
+}
+
+uint64_t
+SCOREP_Env_GetStringParameterMaxValues( void )
+{
+    assert( env_variables_initialized );
+    return env_string_parameter_max_values;
+}
+
 void
 SCOREP_RegisterAllConfigVariables( void )
 {
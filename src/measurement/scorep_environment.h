@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011, 2017, 2024,
+ * Copyright (c) 2009-2011, 2017, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -108,6 +108,19 @@ SCOREP_Env_DoUnwinding( void );
 bool
 SCOREP_Env_DoForceCfgFiles( void );
 
+/*
+ * Interval in seconds between in-run clock synchronizations, 0 if disabled
+ */
+uint64_t
+SCOREP_Env_GetClockResyncInterval( void );
+
+/*
+ * Maximum number of distinct values per string parameter and location,
+ * 0 if unlimited
+ */
+uint64_t
+SCOREP_Env_GetStringParameterMaxValues( void );
+
 UTILS_END_C_DECLS
 
 
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015,
+ * Copyright (c) 2009-2015, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -42,10 +42,12 @@
 #include "scorep_status.h"
 #include <SCOREP_RuntimeManagement.h>
 #include <SCOREP_Location.h>
+#include "scorep_sample_buffer.h"
 
 
 /**
- * Returns the current Score-P timestamp.
+ * Returns the current Score-P timestamp. Samples buffered for @a location
+ * are passed to the substrates first, as they precede the current event.
  *
  * @param location          Current Score-P location
  *
@@ -54,10 +56,37 @@
 static inline uint64_t
 scorep_get_timestamp( SCOREP_Location* location )
 {
+    if ( scorep_sample_buffer_in_use )
+    {
+        scorep_sample_buffer_dispatch( location );
+    }
+
     uint64_t timestamp = SCOREP_Timer_GetClockTicks();
     SCOREP_Location_SetLastTimestamp( location, timestamp );
     return timestamp;
 }
 
 
+/**
+ * Passes samples buffered for @a location that precede an event with the
+ * explicit timestamp @a timestamp to the substrates. Samples are only
+ * buffered for CPU locations, and only the thread of the location may pass
+ * them on.
+ *
+ * @param location          Location of the event
+ * @param timestamp         Timestamp of the event
+ */
+static inline void
+scorep_pass_samples_until( SCOREP_Location* location,
+                           uint64_t         timestamp )
+{
+    if ( scorep_sample_buffer_in_use
+         && SCOREP_Location_GetType( location ) == SCOREP_LOCATION_TYPE_CPU_THREAD
+         && location == SCOREP_Location_GetCurrentCPULocation() )
+    {
+        scorep_sample_buffer_dispatch_until( location, timestamp );
+    }
+}
+
+
 #endif /* SCOREP_EVENTS_COMMON_H */
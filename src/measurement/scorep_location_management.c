@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2016, 2018, 2021-2022,
+ * Copyright (c) 2009-2016, 2018, 2021-2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -89,6 +89,9 @@ struct SCOREP_Location
     SCOREP_Allocator_PageManager* page_managers[ SCOREP_NUMBER_OF_MEMORY_TYPES ];
     void*                         substrate_data[ SCOREP_SUBSTRATES_NUM_SUBSTRATES ];
 
+    struct scorep_parameter_string_cache* parameter_string_cache;
+    struct scorep_sample_buffer*          sample_buffer;
+
     SCOREP_Location*              parent;
     SCOREP_Location*              next;    // store location objects in list for easy cleanup
 
@@ -413,6 +416,36 @@ SCOREP_Location_SetSubstrateData( SCOREP_Location* location,
     location->substrate_data[ substrateId ] = substrateData;
 }
 
+
+struct scorep_parameter_string_cache*
+SCOREP_Location_GetParameterStringCache( SCOREP_Location* location )
+{
+    return location->parameter_string_cache;
+}
+
+
+void
+SCOREP_Location_SetParameterStringCache( SCOREP_Location*                      location,
+                                         struct scorep_parameter_string_cache* cache )
+{
+    location->parameter_string_cache = cache;
+}
+
+
+struct scorep_sample_buffer*
+SCOREP_Location_GetSampleBuffer( SCOREP_Location* location )
+{
+    return location->sample_buffer;
+}
+
+
+void
+SCOREP_Location_SetSampleBuffer( SCOREP_Location*             location,
+                                 struct scorep_sample_buffer* buffer )
+{
+    location->sample_buffer = buffer;
+}
+
 uint64_t
 SCOREP_Location_CalculateGlobalId( int rank, uint32_t thread )
 {
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2018,
+ * Copyright (c) 2009-2015, 2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -88,6 +88,36 @@ SCOREP_Location_SetSubstrateData( SCOREP_Location* location,
                                   size_t           substrateId );
 
 
+struct scorep_parameter_string_cache;
+
+/*
+ * Per-location cache of string parameter values, see
+ * scorep_parameter_string_cache.h. NULL until first used.
+ */
+struct scorep_parameter_string_cache*
+SCOREP_Location_GetParameterStringCache( SCOREP_Location* location );
+
+
+void
+SCOREP_Location_SetParameterStringCache( SCOREP_Location*                      location,
+                                         struct scorep_parameter_string_cache* cache );
+
+
+struct scorep_sample_buffer;
+
+/*
+ * Per-location buffer of samples not yet passed to the substrates, see
+ * scorep_sample_buffer.h. NULL if samples are not buffered.
+ */
+struct scorep_sample_buffer*
+SCOREP_Location_GetSampleBuffer( SCOREP_Location* location );
+
+
+void
+SCOREP_Location_SetSampleBuffer( SCOREP_Location*             location,
+                                 struct scorep_sample_buffer* buffer );
+
+
 /*
  * The caller must ensure thread safety. Currently called at measurement
  * time for the current location at flush time, and at finalization time.
@@ -0,0 +1,235 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * @brief Location-local interning of string parameter values.
+ */
+
+#include <config.h>
+
+#include "scorep_parameter_string_cache.h"
+
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Memory.h>
+
+#include "scorep_environment.h"
+#include "scorep_location_management.h"
+
+#include <jenkins_hash.h>
+
+#include <stdint.h>
+#include <string.h>
+
+
+/** Number of slots of the pointer-indexed cache, needs to be a power of two. */
+#define RECENT_SIZE 64
+
+/** Initial number of buckets of the value table, needs to be a power of two. */
+#define INITIAL_BUCKETS 256
+
+/** Name of the value all values beyond the limit are mapped to. */
+#define OTHER_VALUE "<other>"
+
+
+typedef struct value_entry value_entry;
+struct value_entry
+{
+    value_entry*           next;
+    SCOREP_ParameterHandle parameter;
+    SCOREP_StringHandle    string;
+    /* The pointer this value was passed with last time. */
+    const char*            value;
+};
+
+
+typedef struct parameter_entry parameter_entry;
+struct parameter_entry
+{
+    parameter_entry*       next;
+    SCOREP_ParameterHandle parameter;
+    uint64_t               number_of_values;
+    SCOREP_StringHandle    other;
+};
+
+
+struct scorep_parameter_string_cache
+{
+    value_entry*     recent[ RECENT_SIZE ];
+    value_entry**    buckets;
+    uint32_t         bucket_mask;
+    uint64_t         number_of_values;
+    uint64_t         max_values;
+    parameter_entry* parameters;
+};
+
+
+static inline uint32_t
+recent_slot( SCOREP_ParameterHandle parameter,
+             const char*            value )
+{
+    uintptr_t key = ( ( uintptr_t )value >> 3 ) ^ ( ( uintptr_t )parameter * UINT32_C( 0x9E3779B1 ) );
+    return ( uint32_t )( key ^ ( key >> 16 ) ) & ( RECENT_SIZE - 1 );
+}
+
+
+static inline uint32_t
+bucket_index( const struct scorep_parameter_string_cache* cache,
+              SCOREP_ParameterHandle                      parameter,
+              uint32_t                                    hash )
+{
+    return ( hash ^ ( ( uint32_t )parameter * UINT32_C( 0x9E3779B1 ) ) ) & cache->bucket_mask;
+}
+
+
+static struct scorep_parameter_string_cache*
+get_cache( SCOREP_Location* location )
+{
+    struct scorep_parameter_string_cache* cache =
+        SCOREP_Location_GetParameterStringCache( location );
+    if ( cache )
+    {
+        return cache;
+    }
+
+    cache = SCOREP_Location_AllocForMisc( location, sizeof( *cache ) );
+    memset( cache, 0, sizeof( *cache ) );
+    cache->buckets = SCOREP_Location_AllocForMisc( location,
+                                                   INITIAL_BUCKETS * sizeof( *cache->buckets ) );
+    memset( cache->buckets, 0, INITIAL_BUCKETS * sizeof( *cache->buckets ) );
+    cache->bucket_mask = INITIAL_BUCKETS - 1;
+    cache->max_values  = SCOREP_Env_GetStringParameterMaxValues();
+
+    SCOREP_Location_SetParameterStringCache( location, cache );
+    return cache;
+}
+
+
+/*
+ * Doubles the number of buckets. The old bucket array stays in the
+ * location's misc memory, which is only released at finalization.
+ */
+static void
+grow_buckets( SCOREP_Location*                      location,
+              struct scorep_parameter_string_cache* cache )
+{
+    uint32_t      old_size    = cache->bucket_mask + 1;
+    value_entry** old_buckets = cache->buckets;
+
+    cache->buckets = SCOREP_Location_AllocForMisc( location,
+                                                   2 * old_size * sizeof( *cache->buckets ) );
+    memset( cache->buckets, 0, 2 * old_size * sizeof( *cache->buckets ) );
+    cache->bucket_mask = 2 * old_size - 1;
+
+    for ( uint32_t i = 0; i < old_size; i++ )
+    {
+        value_entry* entry = old_buckets[ i ];
+        while ( entry )
+        {
+            value_entry* next   = entry->next;
+            uint32_t     bucket = bucket_index(
+                cache, entry->parameter,
+                SCOREP_LOCAL_HANDLE_DEREF( entry->string, String )->hash_value );
+            entry->next              = cache->buckets[ bucket ];
+            cache->buckets[ bucket ] = entry;
+            entry                    = next;
+        }
+    }
+}
+
+
+static parameter_entry*
+get_parameter( SCOREP_Location*                      location,
+               struct scorep_parameter_string_cache* cache,
+               SCOREP_ParameterHandle                parameter )
+{
+    for ( parameter_entry* entry = cache->parameters; entry; entry = entry->next )
+    {
+        if ( entry->parameter == parameter )
+        {
+            return entry;
+        }
+    }
+
+    parameter_entry* entry = SCOREP_Location_AllocForMisc( location, sizeof( *entry ) );
+    entry->parameter        = parameter;
+    entry->number_of_values = 0;
+    entry->other            = SCOREP_INVALID_STRING;
+    entry->next             = cache->parameters;
+    cache->parameters       = entry;
+    return entry;
+}
+
+
+SCOREP_StringHandle
+scorep_parameter_string_cache_get( SCOREP_Location*       location,
+                                   SCOREP_ParameterHandle parameter,
+                                   const char*            value )
+{
+    struct scorep_parameter_string_cache* cache = get_cache( location );
+
+    /* Fast path: same pointer as last time, verify the content did not change. */
+    uint32_t     slot  = recent_slot( parameter, value );
+    value_entry* entry = cache->recent[ slot ];
+    if ( entry && entry->value == value && entry->parameter == parameter
+         && strcmp( SCOREP_LOCAL_HANDLE_DEREF( entry->string, String )->string_data, value ) == 0 )
+    {
+        return entry->string;
+    }
+
+    /* Lookup by content, same hash as the string definitions. */
+    size_t   length = strlen( value );
+    uint32_t hash   = jenkins_hash( value, length, 0 );
+    uint32_t bucket = bucket_index( cache, parameter, hash );
+    for ( entry = cache->buckets[ bucket ]; entry; entry = entry->next )
+    {
+        SCOREP_StringDef* string = SCOREP_LOCAL_HANDLE_DEREF( entry->string, String );
+        if ( entry->parameter == parameter
+             && string->hash_value == hash
+             && string->string_length == length
+             && memcmp( string->string_data, value, length ) == 0 )
+        {
+            entry->value          = value;
+            cache->recent[ slot ] = entry;
+            return entry->string;
+        }
+    }
+
+    /* A new value for this location. */
+    parameter_entry* parameter_data = get_parameter( location, cache, parameter );
+    if ( cache->max_values != 0 && parameter_data->number_of_values >= cache->max_values )
+    {
+        if ( parameter_data->other == SCOREP_INVALID_STRING )
+        {
+            parameter_data->other = SCOREP_Definitions_NewString( OTHER_VALUE );
+        }
+        return parameter_data->other;
+    }
+    parameter_data->number_of_values++;
+
+    entry            = SCOREP_Location_AllocForMisc( location, sizeof( *entry ) );
+    entry->parameter = parameter;
+    entry->string    = SCOREP_Definitions_NewString( value );
+    entry->value     = value;
+
+    entry->next              = cache->buckets[ bucket ];
+    cache->buckets[ bucket ] = entry;
+    cache->recent[ slot ]    = entry;
+
+    if ( ++cache->number_of_values > 2 * ( ( uint64_t )cache->bucket_mask + 1 ) )
+    {
+        grow_buckets( location, cache );
+    }
+
+    return entry->string;
+}
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+#ifndef SCOREP_PARAMETER_STRING_CACHE_H
+#define SCOREP_PARAMETER_STRING_CACHE_H
+
+/**
+ * @file
+ *
+ * @brief Location-local interning of string parameter values.
+ *
+ * Each location caches the string definitions of the values it triggered
+ * for string parameters. A repeated value is resolved without taking the
+ * definitions lock, either by the pointer it was last passed with, or by its
+ * content. Once a parameter has `SCOREP_STRING_PARAMETER_MAX_VALUES` distinct
+ * values on a location, further new values are mapped to the value
+ * `<other>`.
+ */
+
+#include <SCOREP_Location.h>
+#include <SCOREP_DefinitionHandles.h>
+
+
+/**
+ * Returns the string definition for @a value of @a parameter on @a location,
+ * or the `<other>` string if the value limit of this parameter is reached.
+ * Must only be called by the thread currently writing events for
+ * @a location.
+ */
+SCOREP_StringHandle
+scorep_parameter_string_cache_get( SCOREP_Location*       location,
+                                   SCOREP_ParameterHandle parameter,
+                                   const char*            value );
+
+
+#endif /* SCOREP_PARAMETER_STRING_CACHE_H */
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * @brief Location-local buffer of samples taken in a signal handler.
+ */
+
+#include <config.h>
+
+#include "scorep_sample_buffer.h"
+
+#include <SCOREP_Events.h>
+#include <SCOREP_Memory.h>
+#include <scorep_substrates_definition.h>
+
+#include "scorep_location_management.h"
+
+#include <stddef.h>
+
+
+typedef struct buffered_sample
+{
+    uint64_t                        timestamp;
+    SCOREP_CallingContextHandle     current_calling_context;
+    SCOREP_CallingContextHandle     previous_calling_context;
+    uint32_t                        unwind_distance;
+    SCOREP_InterruptGeneratorHandle interrupt_generator;
+} buffered_sample;
+
+
+/*
+ * A ring of samples. The signal handler and the thread it interrupts are the
+ * only users of the buffer.
+ */
+struct scorep_sample_buffer
+{
+    volatile uint32_t first;
+    volatile uint32_t count;
+    uint32_t          capacity;
+    buffered_sample   samples[];
+};
+
+
+bool scorep_sample_buffer_in_use = false;
+
+
+void
+SCOREP_SetSampleBufferSize( SCOREP_Location* location,
+                            uint32_t         numberOfSamples )
+{
+    if ( numberOfSamples == 0 )
+    {
+        return;
+    }
+
+    struct scorep_sample_buffer* buffer =
+        SCOREP_Location_AllocForMisc( location,
+                                      offsetof( struct scorep_sample_buffer, samples )
+                                      + numberOfSamples * sizeof( buffered_sample ) );
+    buffer->first    = 0;
+    buffer->count    = 0;
+    buffer->capacity = numberOfSamples;
+
+    SCOREP_Location_SetSampleBuffer( location, buffer );
+    scorep_sample_buffer_in_use = true;
+}
+
+
+void
+SCOREP_FlushSampleBuffer( SCOREP_Location* location )
+{
+    scorep_sample_buffer_dispatch( location );
+}
+
+
+bool
+scorep_sample_buffer_push( SCOREP_Location*                location,
+                           uint64_t                        timestamp,
+                           SCOREP_CallingContextHandle     currentCallingContext,
+                           SCOREP_CallingContextHandle     previousCallingContext,
+                           uint32_t                        unwindDistance,
+                           SCOREP_InterruptGeneratorHandle interruptGeneratorHandle )
+{
+    struct scorep_sample_buffer* buffer = SCOREP_Location_GetSampleBuffer( location );
+    if ( !buffer )
+    {
+        return false;
+    }
+
+    if ( buffer->count == buffer->capacity )
+    {
+        scorep_sample_buffer_dispatch( location );
+    }
+
+    buffered_sample* sample = &buffer->samples[ ( buffer->first + buffer->count ) % buffer->capacity ];
+    sample->timestamp                = timestamp;
+    sample->current_calling_context  = currentCallingContext;
+    sample->previous_calling_context = previousCallingContext;
+    sample->unwind_distance          = unwindDistance;
+    sample->interrupt_generator      = interruptGeneratorHandle;
+    buffer->count++;
+
+    return true;
+}
+
+
+void
+scorep_sample_buffer_dispatch( SCOREP_Location* location )
+{
+    scorep_sample_buffer_dispatch_until( location, UINT64_MAX );
+}
+
+
+void
+scorep_sample_buffer_dispatch_until( SCOREP_Location* location,
+                                     uint64_t         timestamp )
+{
+    struct scorep_sample_buffer* buffer = SCOREP_Location_GetSampleBuffer( location );
+    if ( !buffer )
+    {
+        return;
+    }
+
+    while ( buffer->count != 0 && buffer->samples[ buffer->first ].timestamp <= timestamp )
+    {
+        /* Consume the sample before passing it on, the substrates may
+         * trigger further events. */
+        buffered_sample sample = buffer->samples[ buffer->first ];
+        buffer->first = ( buffer->first + 1 ) % buffer->capacity;
+        buffer->count--;
+
+        SCOREP_CALL_SUBSTRATE_DISPATCH( Sample, SAMPLE,
+                                        ( location,
+                                          sample.timestamp,
+                                          sample.current_calling_context,
+                                          sample.previous_calling_context,
+                                          sample.unwind_distance,
+                                          sample.interrupt_generator,
+                                          NULL ) );
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+#ifndef SCOREP_SAMPLE_BUFFER_H
+#define SCOREP_SAMPLE_BUFFER_H
+
+/**
+ * @file
+ *
+ * @brief Location-local buffer of samples taken in a signal handler.
+ *
+ * SCOREP_Sample() is called from the interrupt handlers of the sampling
+ * service. It only takes the timestamp and unwinds the stack there, as both
+ * need the interrupted state. Passing the sample to the substrates is
+ * deferred until the next event of the location, when the substrates can
+ * safely write trace records or update the profile. Events with an explicit
+ * timestamp on the location of the current thread only pass on the samples
+ * taken until this timestamp. Buffered samples are
+ * also passed on before recording is switched on or off, after a trace
+ * buffer flush, when the location stops sampling, and at the end of the
+ * measurement. Only if the buffer is full, all buffered samples are passed
+ * on from within the signal handler.
+ */
+
+#include <SCOREP_Location.h>
+#include <SCOREP_DefinitionHandles.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/** True if any location buffers its samples. */
+extern bool scorep_sample_buffer_in_use;
+
+
+/**
+ * Buffers a sample of @a location, passing on all buffered samples first if
+ * the buffer is full. Must only be called by the thread of @a location.
+ *
+ * @return False if @a location does not buffer its samples.
+ */
+bool
+scorep_sample_buffer_push( SCOREP_Location*                location,
+                           uint64_t                        timestamp,
+                           SCOREP_CallingContextHandle     currentCallingContext,
+                           SCOREP_CallingContextHandle     previousCallingContext,
+                           uint32_t                        unwindDistance,
+                           SCOREP_InterruptGeneratorHandle interruptGeneratorHandle );
+
+
+/**
+ * Passes all buffered samples of @a location to the substrates, in the order
+ * they were taken. Must only be called by the thread of @a location.
+ */
+void
+scorep_sample_buffer_dispatch( SCOREP_Location* location );
+
+
+/**
+ * Passes the buffered samples of @a location taken not after @a timestamp to
+ * the substrates, in the order they were taken. Must only be called by the
+ * thread of @a location.
+ */
+void
+scorep_sample_buffer_dispatch_until( SCOREP_Location* location,
+                                     uint64_t         timestamp );
+
+
+#endif /* SCOREP_SAMPLE_BUFFER_H */
@@ -4,7 +4,7 @@
  * Copyright (c) 2015,
  * Technische Universitaet Muenchen, Germany
  *
- * Copyright (c) 2015, 2017,
+ * Copyright (c) 2015, 2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2015-2016, 2019,
@@ -66,11 +66,15 @@ uint32_t scorep_substrates_max_substrates = 0;
 SCOREP_Substrates_Callback* scorep_substrates_mgmt                = NULL;
 uint32_t                    scorep_substrates_max_mgmt_substrates = 0;
 
+const scorep_substrates_dispatch* scorep_substrates_dispatch_table = NULL;
+
 /* internal stuff used to switch between enabled and disabled */
 static SCOREP_Substrates_Callback* substrates_enabled;
 static uint32_t                    max_substrates_enabled;
 static SCOREP_Substrates_Callback* substrates_disabled;
 static uint32_t                    max_substrates_disabled;
+static scorep_substrates_dispatch  dispatch_enabled[ SCOREP_SUBSTRATES_NUM_EVENTS ];
+static scorep_substrates_dispatch  dispatch_disabled[ SCOREP_SUBSTRATES_NUM_EVENTS ];
 
 /* ************************************** subsystem struct */
 
@@ -322,6 +326,7 @@ SCOREP_Substrates_EnableRecording( void )
 {
     scorep_substrates                = substrates_enabled;
     scorep_substrates_max_substrates = max_substrates_enabled;
+    scorep_substrates_dispatch_table = dispatch_enabled;
 }
 
 
@@ -330,6 +335,7 @@ SCOREP_Substrates_DisableRecording( void )
 {
     scorep_substrates                = substrates_disabled;
     scorep_substrates_max_substrates = max_substrates_disabled;
+    scorep_substrates_dispatch_table = dispatch_disabled;
 }
 
 static void
@@ -403,6 +409,34 @@ substrates_pack( SCOREP_Substrates_Callback*  source,
 }
 
 
+/**
+ * Fills the dispatch table used by SCOREP_CALL_SUBSTRATE_DISPATCH from the
+ * packed callback array @a packed.
+ */
+static void
+substrates_init_dispatch( const SCOREP_Substrates_Callback* packed,
+                          uint32_t                          subLength,
+                          scorep_substrates_dispatch*       dispatch )
+{
+    for ( uint32_t event = 0; event < SCOREP_SUBSTRATES_NUM_EVENTS; event++ )
+    {
+        const SCOREP_Substrates_Callback* callbacks = &packed[ event * subLength ];
+
+        uint32_t number_of_callbacks = 0;
+        while ( callbacks[ number_of_callbacks ] != NULL )
+        {
+            number_of_callbacks++;
+        }
+
+        dispatch[ event ].number_of_callbacks = number_of_callbacks;
+        dispatch[ event ].callbacks[ 0 ]      = number_of_callbacks > 0 ? callbacks[ 0 ] : NULL;
+        dispatch[ event ].callbacks[ 1 ]      = number_of_callbacks > 1 ? callbacks[ 1 ] : NULL;
+
+        UTILS_DEBUG( "Event %" PRIu32 ": %" PRIu32 " substrate callbacks", event, number_of_callbacks );
+    }
+}
+
+
 void
 SCOREP_Substrates_EarlyInitialize( void )
 {
@@ -532,9 +566,14 @@ SCOREP_Substrates_EarlyInitialize( void )
     free( substrates_disabled_unpacked );
     free( scorep_substrates_mgmt_unpacked );
 
+    /* derive the dispatch tables for SCOREP_CALL_SUBSTRATE_DISPATCH */
+    substrates_init_dispatch( substrates_enabled, max_substrates_enabled, dispatch_enabled );
+    substrates_init_dispatch( substrates_disabled, max_substrates_disabled, dispatch_disabled );
+
     /* initially, we are enabled */
     scorep_substrates                = substrates_enabled;
     scorep_substrates_max_substrates = max_substrates_enabled;
+    scorep_substrates_dispatch_table = dispatch_enabled;
 }
 
 
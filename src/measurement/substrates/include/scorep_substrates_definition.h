@@ -4,7 +4,7 @@
  * Copyright (c) 2015-2016,
  * Technische Universitaet Muenchen, Germany
  *
- * Copyright (c) 2015-2018,
+ * Copyright (c) 2015-2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2015-2018, 2022,
@@ -47,6 +47,36 @@
         } \
     } while ( 0 )
 
+/**
+ * Macro defining the substrate call construct for frequent events.
+ *
+ * Instead of looping over the NULL-terminated callback list of the event,
+ * dispatch on the number of registered substrates as determined in
+ * SCOREP_Substrates_EarlyInitialize. The common configurations (no
+ * substrate, profiling or tracing only, profiling and tracing) call their
+ * callbacks without a loop, all other configurations fall back to
+ * SCOREP_CALL_SUBSTRATE.
+ */
+#define SCOREP_CALL_SUBSTRATE_DISPATCH( Event, EVENT, ARGS ) \
+    do \
+    { \
+        const scorep_substrates_dispatch* substrate_dispatch = &scorep_substrates_dispatch_table[ SCOREP_EVENT_##EVENT ]; \
+        switch ( substrate_dispatch->number_of_callbacks ) \
+        { \
+            case 0: \
+                break; \
+            case 1: \
+                ( ( SCOREP_Substrates_##Event##Cb )substrate_dispatch->callbacks[ 0 ] )ARGS; \
+                break; \
+            case 2: \
+                ( ( SCOREP_Substrates_##Event##Cb )substrate_dispatch->callbacks[ 0 ] )ARGS; \
+                ( ( SCOREP_Substrates_##Event##Cb )substrate_dispatch->callbacks[ 1 ] )ARGS; \
+                break; \
+            default: \
+                SCOREP_CALL_SUBSTRATE( Event, EVENT, ARGS ); \
+        } \
+    } while ( 0 )
+
 /**
  * Macro initializing substrate callback
  */
@@ -184,6 +214,19 @@ typedef enum SCOREP_Substrates_MgmtType
 extern const SCOREP_Substrates_Callback* scorep_substrates;
 extern uint32_t                          scorep_substrates_max_substrates;
 
+/* Per-event dispatch information used by SCOREP_CALL_SUBSTRATE_DISPATCH.
+ * Holds the number of callbacks registered for the event and, if there are
+ * at most two, the callbacks themselves. Switched together with
+ * scorep_substrates when recording gets enabled or disabled. Consider
+ * read-only except in SCOREP_Substrates_Management.c. */
+typedef struct scorep_substrates_dispatch
+{
+    uint32_t                   number_of_callbacks;
+    SCOREP_Substrates_Callback callbacks[ 2 ];
+} scorep_substrates_dispatch;
+
+extern const scorep_substrates_dispatch* scorep_substrates_dispatch_table;
+
 
 extern SCOREP_Substrates_Callback* scorep_substrates_mgmt;
 extern uint32_t                    scorep_substrates_max_mgmt_substrates;
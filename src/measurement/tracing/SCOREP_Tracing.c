@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2015, 2017-2018,
+ * Copyright (c) 2009-2015, 2017-2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -533,13 +533,18 @@ write_definitions( void )
         /* lets assume, that the other ranks also abort, if the root aborts */
     }
 
-    /* Write for all local locations the same local definition file */
     ret = OTF2_Archive_OpenDefFiles( scorep_otf2_archive );
     if ( OTF2_SUCCESS != ret )
     {
         UTILS_FATAL( "Could not open OTF2 definition files: %s",
                      OTF2_Error_GetDescription( ret ) );
     }
+
+    /* All local locations get the same id maps, write each map into all
+     * definition files before creating the next one */
+    scorep_tracing_write_mappings( scorep_otf2_archive );
+
+    /* Write for all local locations the same local definition file */
     SCOREP_DEFINITIONS_MANAGER_FOREACH_DEFINITION_BEGIN( &scorep_local_definition_manager, Location, location )
     {
         OTF2_DefWriter* local_definition_writer = OTF2_Archive_GetDefWriter(
@@ -551,7 +556,6 @@ write_definitions( void )
             SCOREP_Memory_HandleOutOfMemory();
         }
 
-        scorep_tracing_write_mappings( local_definition_writer );
         scorep_tracing_write_clock_offsets( local_definition_writer );
         scorep_tracing_write_local_definitions( local_definition_writer );
 
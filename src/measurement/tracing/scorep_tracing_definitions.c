@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2017, 2022-2024,
+ * Copyright (c) 2009-2017, 2022-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -1562,63 +1562,71 @@ scorep_tracing_get_mapped_definitions_upper_bound( void )
 
 
 /**
- * Generate and write the id mapping for definition type @a type into the
- * OTF2 local definition writer @a definition_writer.
+ * Write the id map @a map of definition type @a type into the definition
+ * files of all local locations. All locations of this process share the
+ * local definitions, thus the same map is written for each of them.
+ */
+static void
+write_mapping_table( OTF2_Archive*     archive,
+                     OTF2_MappingType  type,
+                     const OTF2_IdMap* map )
+{
+    SCOREP_DEFINITIONS_MANAGER_FOREACH_DEFINITION_BEGIN( &scorep_local_definition_manager, Location, location )
+    {
+        OTF2_DefWriter* local_definition_writer = OTF2_Archive_GetDefWriter(
+            archive,
+            definition->global_location_id );
+        if ( !local_definition_writer )
+        {
+            /* aborts */
+            SCOREP_Memory_HandleOutOfMemory();
+        }
+
+        OTF2_ErrorCode status = OTF2_DefWriter_WriteMappingTable(
+            local_definition_writer,
+            type,
+            map );
+        UTILS_ASSERT( status == OTF2_SUCCESS );
+    }
+    SCOREP_DEFINITIONS_MANAGER_FOREACH_DEFINITION_END();
+}
+
+
+/**
+ * Generate the id mapping for definition type @a type, write it for all
+ * local locations, and free it again. Only one map exists at a time.
  *
  * @note @a TYPE denotes the all-caps OTF2 name of the definition type.
  */
-#define WRITE_MAPPING( definition_writer, bitSize, type, OTF2_TYPE ) \
-    do \
-    { \
-        UTILS_DEBUG_PRINTF( SCOREP_DEBUG_DEFINITIONS, "Writing %s mappings", #type ); \
-        if ( scorep_local_definition_manager.type.mapping && \
-             scorep_local_definition_manager.type.counter > 0 ) \
-        { \
-            OTF2_IdMap* map = OTF2_IdMap_CreateFromUint ## bitSize ## Array( \
-                scorep_local_definition_manager.type.counter, \
-                ( const uint ## bitSize ## _t* )scorep_local_definition_manager.type.mapping, \
-                true ); \
-            /* map can be NULL if the mapping is the identity */ \
-            if ( map ) \
-            { \
-                OTF2_ErrorCode status = OTF2_DefWriter_WriteMappingTable( \
-                    definition_writer, \
-                    OTF2_MAPPING_ ## OTF2_TYPE, \
-                    map ); \
-                UTILS_ASSERT( status == OTF2_SUCCESS ); \
-                OTF2_IdMap_Free( map ); \
-            } \
-        } \
-    } \
-    while ( 0 )
+#define WRITE_MAPPING( bitSize, type, OTF2_TYPE )     do     {         UTILS_DEBUG_PRINTF( SCOREP_DEBUG_DEFINITIONS, "Writing %s mappings", #type );         if ( scorep_local_definition_manager.type.mapping &&              scorep_local_definition_manager.type.counter > 0 )         {             OTF2_IdMap* map = OTF2_IdMap_CreateFromUint ## bitSize ## Array(                 scorep_local_definition_manager.type.counter,                 ( const uint ## bitSize ## _t* )scorep_local_definition_manager.type.mapping,                 true );             /* map can be NULL if the mapping is the identity */             if ( map )             {                 write_mapping_table( archive, OTF2_MAPPING_ ## OTF2_TYPE, map );                 OTF2_IdMap_Free( map );             }         }     }     while ( 0 )
 
 
 void
-scorep_tracing_write_mappings( OTF2_DefWriter* localDefinitionWriter )
+scorep_tracing_write_mappings( OTF2_Archive* archive )
 {
-    WRITE_MAPPING( localDefinitionWriter, 32, string, STRING );
+    WRITE_MAPPING( 32, string, STRING );
 
     /*
      * Location definitions need special treatment as their global id is 64bit
      * and they are not derived by the unification algorithm.
      */
-    WRITE_MAPPING( localDefinitionWriter, 64, location, LOCATION );
-
-    WRITE_MAPPING( localDefinitionWriter, 32, location_group, LOCATION_GROUP );
-    WRITE_MAPPING( localDefinitionWriter, 32, region, REGION );
-    WRITE_MAPPING( localDefinitionWriter, 32, group, GROUP );
-    WRITE_MAPPING( localDefinitionWriter, 32, interim_communicator, COMM );
-    WRITE_MAPPING( localDefinitionWriter, 32, rma_window, RMA_WIN );
-    WRITE_MAPPING( localDefinitionWriter, 32, sampling_set, METRIC );
-    WRITE_MAPPING( localDefinitionWriter, 32, attribute, ATTRIBUTE );
-    WRITE_MAPPING( localDefinitionWriter, 32, source_code_location, SOURCE_CODE_LOCATION );
-    WRITE_MAPPING( localDefinitionWriter, 32, calling_context, CALLING_CONTEXT );
-    WRITE_MAPPING( localDefinitionWriter, 32, interrupt_generator, INTERRUPT_GENERATOR );
-    WRITE_MAPPING( localDefinitionWriter, 32, io_file, IO_FILE );
-    WRITE_MAPPING( localDefinitionWriter, 32, io_handle, IO_HANDLE );
+    WRITE_MAPPING( 64, location, LOCATION );
+
+    WRITE_MAPPING( 32, location_group, LOCATION_GROUP );
+    WRITE_MAPPING( 32, region, REGION );
+    WRITE_MAPPING( 32, group, GROUP );
+    WRITE_MAPPING( 32, interim_communicator, COMM );
+    WRITE_MAPPING( 32, rma_window, RMA_WIN );
+    WRITE_MAPPING( 32, sampling_set, METRIC );
+    WRITE_MAPPING( 32, attribute, ATTRIBUTE );
+    WRITE_MAPPING( 32, source_code_location, SOURCE_CODE_LOCATION );
+    WRITE_MAPPING( 32, calling_context, CALLING_CONTEXT );
+    WRITE_MAPPING( 32, interrupt_generator, INTERRUPT_GENERATOR );
+    WRITE_MAPPING( 32, io_file, IO_FILE );
+    WRITE_MAPPING( 32, io_handle, IO_HANDLE );
 
     // do we need Callpath and Parameter mappings for tracing?
-    WRITE_MAPPING( localDefinitionWriter, 32, parameter, PARAMETER );
+    WRITE_MAPPING( 32, parameter, PARAMETER );
 }
 
 static void
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011,
+ * Copyright (c) 2009-2011, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -40,8 +40,13 @@
  *
  */
 
+/**
+ * Writes the id maps of all local definitions into the definition files of
+ * all local locations. Each map is created once and freed before the next
+ * one is created.
+ */
 void
-scorep_tracing_write_mappings( OTF2_DefWriter* localDefinitionWriter );
+scorep_tracing_write_mappings( OTF2_Archive* archive );
 
 void
 scorep_tracing_write_clock_offsets( OTF2_DefWriter* localDefinitionWriter );
@@ -4,6 +4,9 @@
  * Copyright (c) 2013-2015, 2017, 2020, 2025,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license. See the COPYING file in the package base
  * directory for details.
@@ -48,6 +51,11 @@ SCOREP_Libwrap_Enable( SCOREP_LibwrapHandle* handle );
 /**
  * Call this function to register a wrapper for one function.
  *
+ * The region is not defined here, @a regionHandle is set to
+ * SCOREP_INVALID_REGION. The wrapper needs to access it via
+ * SCOREP_LIBWRAP_REGION, which defines it on first use. @a prettyName,
+ * @a symbolName, and @a file are copied and need not stay valid.
+ *
  * @param handle               Score-P library wrapper object
  * @param prettyName           Region display name (i.e., demangled)
  * @param symbolName           Symbol name (i.e., mangled)
@@ -55,7 +63,7 @@ SCOREP_Libwrap_Enable( SCOREP_LibwrapHandle* handle );
  * @param line                 Line number in source file
  * @param wrapper              Function address of the wrapper
  * @param[out] originalHandle  Pointer to the orignal handle
- * @param[out] regionHandle    Pointer to the region handle
+ * @param[out] regionHandle    Pointer to the region handle, may be NULL
  */
 void
 SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
@@ -69,6 +77,42 @@ SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
                                 SCOREP_Libwrap_OriginalHandle* originalHandle,
                                 SCOREP_RegionHandle*           regionHandle );
 
+/**
+ * Defines the region registered as @a regionHandle with
+ * SCOREP_Libwrap_RegisterWrapper, if not yet done.
+ *
+ * @param regionHandle         Pointer to the region handle
+ *
+ * @return The defined region.
+ */
+SCOREP_RegionHandle
+SCOREP_Libwrap_DefineRegion( SCOREP_RegionHandle* regionHandle );
+
+/**
+ * @def SCOREP_LIBWRAP_REGION
+ * The region handle @a region registered with SCOREP_Libwrap_RegisterWrapper,
+ * defined on first use.
+ *
+ * @param region            Region handle variable
+ */
+#define SCOREP_LIBWRAP_REGION( region ) \
+    ( ( region ) != SCOREP_INVALID_REGION ? ( region ) : SCOREP_Libwrap_DefineRegion( &( region ) ) )
+
+void*
+SCOREP_Libwrap_GetOriginal( SCOREP_Libwrap_OriginalHandle originalHandle );
+
+/**
+ * The original function of @a originalHandle. The handle points to the
+ * cached function pointer, the call into the library wrapping service is
+ * only needed until the original is resolved.
+ */
+static inline void*
+scorep_libwrap_get_original( SCOREP_Libwrap_OriginalHandle originalHandle )
+{
+    void* function = *( void** )originalHandle;
+    return function ? function : SCOREP_Libwrap_GetOriginal( originalHandle );
+}
+
 #ifndef SCOREP_LIBWRAP_ORIGINAL
 
 /**
@@ -78,10 +122,7 @@ SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
  * @param func              Function name
  */
 #define SCOREP_LIBWRAP_ORIGINAL( func ) \
-    ( ( SCOREP_LIBWRAP_ORIGINAL_TYPE( func )* )SCOREP_Libwrap_GetOriginal( SCOREP_LIBWRAP_ORIGINAL_HANDLE( func ) ) )
-
-void*
-SCOREP_Libwrap_GetOriginal( SCOREP_Libwrap_OriginalHandle originalHandle );
+    ( ( SCOREP_LIBWRAP_ORIGINAL_TYPE( func )* )scorep_libwrap_get_original( SCOREP_LIBWRAP_ORIGINAL_HANDLE( func ) ) )
 
 #endif /* SCOREP_LIBWRAP_ORIGINAL */
 
@@ -4,7 +4,7 @@
  * Copyright (c) 2014, 2017, 2020, 2025,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -66,6 +66,32 @@ enum wrapping_state
     WRAPPING_ENABLED
 };
 
+/*
+ * Data structure for one wrapped symbol, SCOREP_Libwrap_OriginalHandle points
+ * to it. These outlive the measurement, as the wrappers may still be called
+ * after it.
+ */
+typedef struct libwrap_original libwrap_original;
+struct libwrap_original
+{
+    /* The original function once resolved. Needs to be the first member,
+     * SCOREP_LIBWRAP_ORIGINAL reads it directly. */
+    void*                   function;
+    gotcha_wrappee_handle_t wrappee;
+    libwrap_original*       next;
+
+    /* The region is defined on first use, see SCOREP_Libwrap_DefineRegion.
+     * The names point into strings, private copies of the caller's strings. */
+    SCOREP_RegionHandle*    region;
+    const char*             pretty_name;
+    const char*             symbol_name;
+    const char*             file;
+    int                     line;
+    SCOREP_ParadigmType     paradigm;
+    SCOREP_RegionType       region_type;
+    char                    strings[];
+};
+
 /** Data structure for library wrapper handle */
 struct SCOREP_LibwrapHandle
 {
@@ -73,6 +99,7 @@ struct SCOREP_LibwrapHandle
     SCOREP_LibwrapHandle*           next;
     UTILS_Mutex                     lock;
     enum wrapping_state             wrapping_state;
+    libwrap_original*               originals;
     gotcha_binding_t*               gotcha_bindings;
     size_t                          gotcha_bindings_actions;  /* in #elements */
     size_t                          gotcha_bindings_capacity; /* in bytes */
@@ -467,6 +494,21 @@ SCOREP_Libwrap_Create( SCOREP_LibwrapHandle**          outHandle,
     UTILS_DEBUG_EXIT();
 }
 
+/* Copies @a string to @a *buffer and advances it past the copy */
+static const char*
+copy_string( char**      buffer,
+             const char* string,
+             size_t      length )
+{
+    if ( !string )
+    {
+        return NULL;
+    }
+    char* copy = memcpy( *buffer, string, length );
+    *buffer += length;
+    return copy;
+}
+
 void
 SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
                                 const char*                    prettyName,
@@ -488,24 +530,38 @@ SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
                   handle->attributes->display_name );
 
     UTILS_DEBUG_ENTRY( "%s, %s, %s:%d", handle->attributes->name, symbolName, file, line );
+
+    /* The caller's strings need not outlive this call, but GOTCHA and the
+     * lazy region definition need them later. String definitions are only
+     * created if the region gets defined. */
+    size_t pretty_name_length = prettyName ? strlen( prettyName ) + 1 : 0;
+    size_t symbol_name_length = strlen( symbolName ) + 1;
+    size_t file_length        = file ? strlen( file ) + 1 : 0;
+
+    libwrap_original* original = calloc( 1, sizeof( *original )
+                                         + pretty_name_length
+                                         + symbol_name_length
+                                         + file_length );
+    UTILS_ASSERT( original );
+    char* strings = original->strings;
+
+    original->region      = regionOut;
+    original->pretty_name = copy_string( &strings, prettyName, pretty_name_length );
+    original->symbol_name = copy_string( &strings, symbolName, symbol_name_length );
+    original->file        = copy_string( &strings, file, file_length );
+    original->line        = line;
+    original->paradigm    = paradigm;
+    original->region_type = regionType;
     if ( regionOut )
     {
-        *regionOut = SCOREP_Definitions_NewRegion( prettyName,
-                                                   symbolName,
-                                                   file ? SCOREP_Definitions_NewSourceFile( file )
-                                                   : SCOREP_INVALID_SOURCE_FILE,
-                                                   line,
-                                                   SCOREP_INVALID_LINE_NO,
-                                                   paradigm,
-                                                   regionType );
-        symbolName = SCOREP_RegionHandle_GetCanonicalName( *regionOut );
-    }
-    else
-    {
-        SCOREP_StringHandle symbol_handle = SCOREP_Definitions_NewString( symbolName );
-        symbolName = SCOREP_StringHandle_Get( symbol_handle );
+        *regionOut = SCOREP_INVALID_REGION;
     }
 
+    original->next    = handle->originals;
+    handle->originals = original;
+
+    *originalHandleOut = original;
+
     if ( handle->gotcha_bindings_actions == ( handle->gotcha_bindings_capacity / sizeof( *handle->gotcha_bindings ) ) )
     {
         /* I/O and OpenCL have 100<#symbols<170 each.
@@ -517,9 +573,9 @@ SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
     }
 
     gotcha_binding_t* wrap_actions = &handle->gotcha_bindings[ handle->gotcha_bindings_actions++ ];
-    wrap_actions->name            = symbolName;
+    wrap_actions->name            = original->symbol_name;
     wrap_actions->wrapper_pointer = wrapper;
-    wrap_actions->function_handle = originalHandleOut;
+    wrap_actions->function_handle = &original->wrappee;
 
     UTILS_MutexUnlock( &handle->lock );
 
@@ -529,7 +585,74 @@ SCOREP_Libwrap_RegisterWrapper( SCOREP_LibwrapHandle*          handle,
 void*
 SCOREP_Libwrap_GetOriginal( SCOREP_Libwrap_OriginalHandle originalHandle )
 {
-    return gotcha_get_wrappee( originalHandle );
+    libwrap_original* original = originalHandle;
+    if ( original->function )
+    {
+        return original->function;
+    }
+
+    /*
+     * The original may not yet be resolved if its library was not yet
+     * loaded, cache it only when found.
+     */
+    void* function = gotcha_get_wrappee( original->wrappee );
+    if ( function )
+    {
+        original->function = function;
+    }
+    return function;
+}
+
+static libwrap_original*
+find_original( SCOREP_RegionHandle* region )
+{
+    for ( SCOREP_LibwrapHandle* handle = libwrap_handles; handle; handle = handle->next )
+    {
+        UTILS_MutexLock( &handle->lock );
+        libwrap_original* original = handle->originals;
+        while ( original && original->region != region )
+        {
+            original = original->next;
+        }
+        UTILS_MutexUnlock( &handle->lock );
+
+        if ( original )
+        {
+            return original;
+        }
+    }
+
+    return NULL;
+}
+
+SCOREP_RegionHandle
+SCOREP_Libwrap_DefineRegion( SCOREP_RegionHandle* region )
+{
+    UTILS_ASSERT( region );
+
+    UTILS_MutexLock( &libwrap_object_lock );
+
+    if ( *region == SCOREP_INVALID_REGION )
+    {
+        libwrap_original* original = find_original( region );
+        UTILS_BUG_ON( original == NULL,
+                      "Region handle was not registered with a library wrapper." );
+
+        UTILS_DEBUG( "Defining region for %s", original->symbol_name );
+        *region = SCOREP_Definitions_NewRegion( original->pretty_name,
+                                                original->symbol_name,
+                                                original->file
+                                                ? SCOREP_Definitions_NewSourceFile( original->file )
+                                                : SCOREP_INVALID_SOURCE_FILE,
+                                                original->line,
+                                                SCOREP_INVALID_LINE_NO,
+                                                original->paradigm,
+                                                original->region_type );
+    }
+
+    UTILS_MutexUnlock( &libwrap_object_lock );
+
+    return *region;
 }
 
 /* ****************************************************************** */
@@ -567,6 +690,9 @@ libwrap_plugin_api_register_wrapper( SCOREP_LibwrapHandle* handle,
         wrapper,
         originalHandleOut,
         regionOut );
+
+    /* Plug-ins pass the region by value to enter_region, define it now. */
+    SCOREP_Libwrap_DefineRegion( regionOut );
     SCOREP_RegionHandle_SetGroup( *regionOut, handle->attributes->display_name );
 }
 
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014,
+ * Copyright (c) 2009-2014, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -47,6 +47,8 @@
 
 #include "scorep_metric_perf_confvars.inc.c"
 
+#include "scorep_metric_proc_confvars.inc.c"
+
 static SCOREP_ErrorCode
 metric_subsystem_register( size_t subsystem_id )
 {
@@ -62,6 +64,9 @@ metric_subsystem_register( size_t subsystem_id )
     SCOREP_ConfigRegisterCond( "metric",
                                scorep_metric_perf_confvars,
                                HAVE_BACKEND_METRIC_PERF );
+    SCOREP_ConfigRegisterCond( "metric",
+                               scorep_metric_proc_confvars,
+                               HAVE_BACKEND_METRIC_PROC );
 
     return SCOREP_SUCCESS;
 }
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2018,
+ * Copyright (c) 2009-2018, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -85,6 +85,9 @@
 #if HAVE( METRIC_PERF )
 #include "scorep_metric_perf.h"
 #endif
+#if HAVE( METRIC_PROC )
+#include "scorep_metric_proc.h"
+#endif
 
 #include <unistd.h>
 #include <sys/types.h>
@@ -102,7 +105,10 @@ static const SCOREP_MetricSource* scorep_metric_sources[] = {
     &SCOREP_Metric_Plugins,
 #endif
 #if HAVE( METRIC_PERF )
-    &SCOREP_Metric_Perf
+    &SCOREP_Metric_Perf,
+#endif
+#if HAVE( METRIC_PROC )
+    &SCOREP_Metric_Proc
 #endif
 };
 
@@ -925,7 +931,16 @@ initialize_location_metric_cb( SCOREP_Location* location,
                     }
                     if ( prevent_async_metrics )
                     {
-                        break;
+                        /* Release the event sets, sources may have started
+                         * to collect data for them already */
+                        for ( size_t source_index = 0; source_index < SCOREP_NUMBER_OF_METRIC_SOURCES; source_index++ )
+                        {
+                            if ( current_metrics_vector[ source_index ] > 0 )
+                            {
+                                scorep_metric_sources[ source_index ]->metric_source_free_additional_metric_event_set( event_set_collection[ source_index ][ metric_synchronicity ][ metric_type ] );
+                            }
+                        }
+                        continue;
                     }
 
                     /* Create a new location metric set */
@@ -0,0 +1,925 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ *  @file
+ *
+ *  @brief This module samples node and cgroup metrics from /proc and /sys.
+ */
+
+#include <config.h>
+
+#include "SCOREP_Metric_Source.h"
+
+#include <SCOREP_InMeasurement.h>
+#include <SCOREP_Timer_Ticks.h>
+
+#include <UTILS_Debug.h>
+#include <UTILS_Error.h>
+#include <UTILS_CStr.h>
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/** @defgroup SCOREP_Metric_PROC /proc and cgroup Metric Source
+ *  @ingroup SCOREP_Metric
+ *
+ *  This metric source provides node-level and cgroup metrics, like available
+ *  memory, page faults, context switches, CPU frequency, memory pressure, and
+ *  CPU throttling of the cgroup. The metrics are requested by a
+ *  comma-separated list of names in \c SCOREP_METRIC_PROC, for example
+ *  @verbatim SCOREP_METRIC_PROC=mem_available,cgroup_throttled_time @endverbatim
+ *
+ *  The first location of each process starts a background thread that reads
+ *  the corresponding files every \c SCOREP_METRIC_PROC_INTERVAL microseconds.
+ *  The samples are written as asynchronous per-process metrics at the end of
+ *  the measurement, thus enter and exit events are not affected.
+ */
+
+/** Size of the buffer the files are read into. */
+#define PROC_BUFFER_SIZE 16384
+
+/** Initial number of samples per metric. */
+#define PROC_INITIAL_PAIRS 1024
+
+/** Counter indices */
+typedef enum
+{
+    PROC_MEM_AVAILABLE         = 0,
+    PROC_PGFAULT               = 1,
+    PROC_PGMAJFAULT            = 2,
+    PROC_CTXT                  = 3,
+    PROC_CPU_FREQ              = 4,
+    PROC_MEMORY_PRESSURE       = 5,
+    PROC_CGROUP_MEMORY_CURRENT = 6,
+    PROC_CGROUP_NR_THROTTLED   = 7,
+    PROC_CGROUP_THROTTLED_TIME = 8,
+
+    SCOREP_PROC_CNTR_MAXNUM
+} scorep_proc_metric_type;
+
+/** Files the counters are read from */
+typedef enum
+{
+    PROC_FILE_NONE,
+    PROC_FILE_MEMINFO,
+    PROC_FILE_VMSTAT,
+    PROC_FILE_STAT,
+    PROC_FILE_CPUFREQ,
+    PROC_FILE_PRESSURE_MEMORY,
+    PROC_FILE_CGROUP_MEMORY_CURRENT,
+    PROC_FILE_CGROUP_CPU_STAT
+} scorep_proc_file;
+
+/**
+ *  Data structure of /proc counter specification
+ */
+typedef struct scorep_proc_metric_struct
+{
+    /** Internal index of this metric */
+    const scorep_proc_metric_type index;
+    /** Name of this metric */
+    const char*                   name;
+    /** Base unit of this metric (e.g. seconds) */
+    const char*                   unit;
+    /** Longer description of this metric */
+    const char*                   description;
+    /** Mode of this metric (absolute or accumulated) */
+    SCOREP_MetricMode             mode;
+    /** Base of this metric (decimal or binary) */
+    SCOREP_MetricBase             base;
+    /** Exponent to scale values of this metric */
+    int64_t                       exponent;
+    /** File the value is read from */
+    scorep_proc_file              file;
+    /** First word of the line holding the value, NULL if the file holds
+     *  only the value */
+    const char*                   key;
+    /** Prefix of the value in the line, NULL if the value follows @a key */
+    const char*                   field;
+} scorep_proc_metric;
+
+/* *INDENT-OFF* */
+
+static scorep_proc_metric scorep_proc_metrics[ SCOREP_PROC_CNTR_MAXNUM ] =
+{
+    { PROC_MEM_AVAILABLE,         "mem_available",         "Bytes", "memory available for new allocations on the node",   SCOREP_METRIC_MODE_ABSOLUTE_POINT,    SCOREP_METRIC_BASE_BINARY,  10, PROC_FILE_MEMINFO,               "MemAvailable:",  NULL     },
+    { PROC_PGFAULT,               "pgfault",               "#",     "page faults on the node",                            SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, 0,  PROC_FILE_VMSTAT,                "pgfault",        NULL     },
+    { PROC_PGMAJFAULT,            "pgmajfault",            "#",     "major page faults on the node",                      SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, 0,  PROC_FILE_VMSTAT,                "pgmajfault",     NULL     },
+    { PROC_CTXT,                  "ctxt",                  "#",     "context switches on the node",                       SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, 0,  PROC_FILE_STAT,                  "ctxt",           NULL     },
+    { PROC_CPU_FREQ,              "cpu_freq",              "Hz",    "mean frequency of the CPUs the process may run on",  SCOREP_METRIC_MODE_ABSOLUTE_POINT,    SCOREP_METRIC_BASE_DECIMAL, 3,  PROC_FILE_CPUFREQ,               NULL,             NULL     },
+    { PROC_MEMORY_PRESSURE,       "memory_pressure",       "s",     "time some tasks stalled on memory",                  SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, -6, PROC_FILE_PRESSURE_MEMORY,       "some",           "total=" },
+    { PROC_CGROUP_MEMORY_CURRENT, "cgroup_memory_current", "Bytes", "memory used by the cgroup of the process",           SCOREP_METRIC_MODE_ABSOLUTE_POINT,    SCOREP_METRIC_BASE_BINARY,  0,  PROC_FILE_CGROUP_MEMORY_CURRENT, NULL,             NULL     },
+    { PROC_CGROUP_NR_THROTTLED,   "cgroup_nr_throttled",   "#",     "CPU throttling periods of the cgroup of the process", SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, 0,  PROC_FILE_CGROUP_CPU_STAT,       "nr_throttled",   NULL     },
+    { PROC_CGROUP_THROTTLED_TIME, "cgroup_throttled_time", "s",     "time the cgroup of the process was CPU throttled",   SCOREP_METRIC_MODE_ACCUMULATED_START, SCOREP_METRIC_BASE_DECIMAL, -6, PROC_FILE_CGROUP_CPU_STAT,       "throttled_usec", NULL     }
+};
+
+/* *INDENT-ON* */
+
+/** Metric definition data */
+typedef struct scorep_metric_definition_data scorep_metric_definition_data;
+struct scorep_metric_definition_data
+{
+    /** Vector of active counters */
+    scorep_proc_metric* active_metrics[ SCOREP_PROC_CNTR_MAXNUM ];
+    /** Number of active counters */
+    uint8_t             number_of_metrics;
+};
+
+/** Samples of one metric, handed over to the measurement system at the end */
+typedef struct scorep_proc_samples
+{
+    SCOREP_MetricTimeValuePair* pairs;
+    uint64_t                    number_of_pairs;
+    uint64_t                    capacity;
+    /** First value of accumulated metrics */
+    uint64_t                    start_value;
+    bool                        has_start_value;
+} scorep_proc_samples;
+
+/** Metric data structure */
+struct SCOREP_Metric_EventSet
+{
+    /** Metric definition data */
+    scorep_metric_definition_data* definitions;
+    /** Samples of each active metric */
+    scorep_proc_samples            samples[ SCOREP_PROC_CNTR_MAXNUM ];
+    /** Protects @a samples and @a stop */
+    pthread_mutex_t                lock;
+    /** Wakes up the sampler thread to stop it */
+    pthread_cond_t                 wakeup;
+    pthread_t                      sampler;
+    bool                           running;
+    bool                           stop;
+    /** Used by the sampler thread only */
+    char                           buffer[ PROC_BUFFER_SIZE ];
+};
+
+/** Definition data of per-process metrics */
+static scorep_metric_definition_data* metric_defs;
+
+/** Directory of the cgroup v2 of this process */
+static char cgroup_dir[ PATH_MAX ];
+
+/** CPUs this process may run on */
+static int*     cpus;
+static uint32_t number_of_cpus;
+
+/** Static variable to control initialize status of the metric source.
+ *  If it is 0 it is initialized. */
+static int scorep_metric_proc_initialize = 1;
+
+#include "scorep_metric_proc_confvars.inc.c"
+
+
+/* *********************************************************************
+ * Reading of /proc and /sys files
+ **********************************************************************/
+
+/** Reads the file @a path into @a buffer and terminates it.
+ *
+ *  @return Returns false if the file cannot be read.
+ */
+static bool
+read_file( const char* path,
+           char*       buffer,
+           size_t      size )
+{
+    int fd = open( path, O_RDONLY );
+    if ( fd < 0 )
+    {
+        return false;
+    }
+
+    size_t  length = 0;
+    ssize_t result;
+    while ( length < size - 1
+            && ( result = read( fd, buffer + length, size - 1 - length ) ) > 0 )
+    {
+        length += result;
+    }
+    close( fd );
+
+    buffer[ length ] = '\0';
+    return length > 0;
+}
+
+/** Parses the value of @a metric from @a buffer.
+ *
+ *  @return Returns false if the value is not contained.
+ */
+static bool
+parse_value( const scorep_proc_metric* metric,
+             const char*               buffer,
+             uint64_t*                 value )
+{
+    const char* line = buffer;
+    if ( metric->key )
+    {
+        size_t key_length = strlen( metric->key );
+        while ( strncmp( line, metric->key, key_length ) != 0
+                || !isspace( ( unsigned char )line[ key_length ] ) )
+        {
+            line = strchr( line, '\n' );
+            if ( !line )
+            {
+                return false;
+            }
+            line++;
+        }
+        line += key_length;
+    }
+    if ( metric->field )
+    {
+        const char* end = strchr( line, '\n' );
+        line = strstr( line, metric->field );
+        if ( !line || ( end && line > end ) )
+        {
+            return false;
+        }
+        line += strlen( metric->field );
+    }
+
+    char* end;
+    *value = strtoull( line, &end, 10 );
+    return end != line;
+}
+
+/** Reads the mean frequency of all CPUs this process may run on. */
+static bool
+read_cpu_frequency( char*     buffer,
+                    size_t    size,
+                    uint64_t* value )
+{
+    uint64_t sum   = 0;
+    uint32_t count = 0;
+    for ( uint32_t i = 0; i < number_of_cpus; i++ )
+    {
+        char path[ 128 ];
+        snprintf( path, sizeof( path ),
+                  "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpus[ i ] );
+        if ( read_file( path, buffer, size ) )
+        {
+            sum += strtoull( buffer, NULL, 10 );
+            count++;
+        }
+    }
+    if ( count == 0 )
+    {
+        return false;
+    }
+    *value = sum / count;
+    return true;
+}
+
+/** Loads @a file into @a buffer.
+ *
+ *  @return Returns false if the file cannot be read.
+ */
+static bool
+load_file( scorep_proc_file file,
+           char*            buffer,
+           size_t           size )
+{
+    char path[ PATH_MAX + 32 ];
+    switch ( file )
+    {
+        case PROC_FILE_MEMINFO:
+            return read_file( "/proc/meminfo", buffer, size );
+        case PROC_FILE_VMSTAT:
+            return read_file( "/proc/vmstat", buffer, size );
+        case PROC_FILE_STAT:
+            return read_file( "/proc/stat", buffer, size );
+        case PROC_FILE_PRESSURE_MEMORY:
+            return read_file( "/proc/pressure/memory", buffer, size );
+        case PROC_FILE_CGROUP_MEMORY_CURRENT:
+            snprintf( path, sizeof( path ), "%s/memory.current", cgroup_dir );
+            return cgroup_dir[ 0 ] && read_file( path, buffer, size );
+        case PROC_FILE_CGROUP_CPU_STAT:
+            snprintf( path, sizeof( path ), "%s/cpu.stat", cgroup_dir );
+            return cgroup_dir[ 0 ] && read_file( path, buffer, size );
+        default:
+            return false;
+    }
+}
+
+/** Determines the cgroup v2 directory of this process. */
+static void
+find_cgroup_dir( void )
+{
+    char buffer[ PATH_MAX ];
+    cgroup_dir[ 0 ] = '\0';
+    if ( !read_file( "/proc/self/cgroup", buffer, sizeof( buffer ) ) )
+    {
+        return;
+    }
+
+    /* The cgroup v2 hierarchy is listed as '0::<path>' */
+    for ( char* line = buffer; line; line = strchr( line, '\n' ) ? strchr( line, '\n' ) + 1 : NULL )
+    {
+        if ( strncmp( line, "0::", 3 ) == 0 )
+        {
+            char* end = strchr( line, '\n' );
+            if ( end )
+            {
+                *end = '\0';
+            }
+            snprintf( cgroup_dir, sizeof( cgroup_dir ), "/sys/fs/cgroup%s", line + 3 );
+            return;
+        }
+    }
+}
+
+/** Determines the CPUs this process may run on. */
+static void
+find_cpus( void )
+{
+    cpu_set_t set;
+    number_of_cpus = 0;
+    if ( sched_getaffinity( 0, sizeof( set ), &set ) != 0 )
+    {
+        return;
+    }
+
+    cpus = malloc( CPU_COUNT( &set ) * sizeof( *cpus ) );
+    UTILS_ASSERT( cpus );
+    for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ )
+    {
+        if ( CPU_ISSET( cpu, &set ) )
+        {
+            cpus[ number_of_cpus++ ] = cpu;
+        }
+    }
+}
+
+
+/* *********************************************************************
+ * Sampler thread
+ **********************************************************************/
+
+static void
+append_pair( scorep_proc_samples* samples,
+             uint64_t             timestamp,
+             uint64_t             value )
+{
+    if ( samples->number_of_pairs == samples->capacity )
+    {
+        uint64_t                    capacity = samples->capacity ? 2 * samples->capacity : PROC_INITIAL_PAIRS;
+        SCOREP_MetricTimeValuePair* pairs    = realloc( samples->pairs, capacity * sizeof( *pairs ) );
+        if ( !pairs )
+        {
+            /* Drop the sample, the measurement continues */
+            return;
+        }
+        samples->pairs    = pairs;
+        samples->capacity = capacity;
+    }
+    samples->pairs[ samples->number_of_pairs ].timestamp = timestamp;
+    samples->pairs[ samples->number_of_pairs ].value     = value;
+    samples->number_of_pairs++;
+}
+
+/** Reads all metrics of @a eventSet once and stores their values. */
+static void
+take_sample( SCOREP_Metric_EventSet* eventSet )
+{
+    if ( !SCOREP_IS_MEASUREMENT_PHASE( WITHIN ) )
+    {
+        return;
+    }
+
+    uint64_t timestamp = SCOREP_Timer_GetClockTicks();
+    uint64_t values[ SCOREP_PROC_CNTR_MAXNUM ];
+    bool     valid[ SCOREP_PROC_CNTR_MAXNUM ];
+
+    scorep_proc_file loaded    = PROC_FILE_NONE;
+    bool             loaded_ok = false;
+    for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
+    {
+        const scorep_proc_metric* metric = eventSet->definitions->active_metrics[ i ];
+        if ( metric->file == PROC_FILE_CPUFREQ )
+        {
+            valid[ i ] = read_cpu_frequency( eventSet->buffer, PROC_BUFFER_SIZE, &values[ i ] );
+            loaded     = PROC_FILE_NONE;
+            continue;
+        }
+        if ( metric->file != loaded )
+        {
+            loaded    = metric->file;
+            loaded_ok = load_file( metric->file, eventSet->buffer, PROC_BUFFER_SIZE );
+        }
+        valid[ i ] = loaded_ok && parse_value( metric, eventSet->buffer, &values[ i ] );
+    }
+
+    pthread_mutex_lock( &eventSet->lock );
+    for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
+    {
+        if ( !valid[ i ] )
+        {
+            continue;
+        }
+        scorep_proc_samples* samples = &eventSet->samples[ i ];
+        if ( eventSet->definitions->active_metrics[ i ]->mode == SCOREP_METRIC_MODE_ACCUMULATED_START )
+        {
+            if ( !samples->has_start_value )
+            {
+                samples->start_value     = values[ i ];
+                samples->has_start_value = true;
+            }
+            values[ i ] -= samples->start_value;
+        }
+        append_pair( samples, timestamp, values[ i ] );
+    }
+    pthread_mutex_unlock( &eventSet->lock );
+}
+
+static void*
+sampler_main( void* arg )
+{
+    SCOREP_Metric_EventSet* event_set = arg;
+
+    pthread_mutex_lock( &event_set->lock );
+    while ( !event_set->stop )
+    {
+        pthread_mutex_unlock( &event_set->lock );
+        take_sample( event_set );
+        pthread_mutex_lock( &event_set->lock );
+
+        struct timespec deadline;
+        clock_gettime( CLOCK_REALTIME, &deadline );
+        deadline.tv_sec  += scorep_metric_proc_interval / 1000000;
+        deadline.tv_nsec += ( scorep_metric_proc_interval % 1000000 ) * 1000;
+        if ( deadline.tv_nsec >= 1000000000 )
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        while ( !event_set->stop
+                && pthread_cond_timedwait( &event_set->wakeup, &event_set->lock, &deadline ) != ETIMEDOUT )
+        {
+        }
+    }
+    pthread_mutex_unlock( &event_set->lock );
+
+    return NULL;
+}
+
+static void
+start_sampler( SCOREP_Metric_EventSet* eventSet )
+{
+    /* The sampler must not receive signals meant for the application or
+     * for the sampling of the measurement system. */
+    sigset_t all_signals;
+    sigset_t old_signals;
+    sigfillset( &all_signals );
+    pthread_sigmask( SIG_SETMASK, &all_signals, &old_signals );
+
+    /* The pthread adapter does not record this thread, as we are inside the
+     * measurement system. */
+    int result = pthread_create( &eventSet->sampler, NULL, &sampler_main, eventSet );
+    pthread_sigmask( SIG_SETMASK, &old_signals, NULL );
+
+    if ( result != 0 )
+    {
+        UTILS_WARNING( "[PROC] Cannot start sampler thread: %s", strerror( result ) );
+        return;
+    }
+    eventSet->running = true;
+}
+
+static void
+stop_sampler( SCOREP_Metric_EventSet* eventSet )
+{
+    if ( !eventSet->running )
+    {
+        return;
+    }
+
+    pthread_mutex_lock( &eventSet->lock );
+    eventSet->stop = true;
+    pthread_cond_signal( &eventSet->wakeup );
+    pthread_mutex_unlock( &eventSet->lock );
+
+    pthread_join( eventSet->sampler, NULL );
+    eventSet->running = false;
+}
+
+static void
+destroy_event_set( SCOREP_Metric_EventSet* eventSet )
+{
+    if ( eventSet == NULL )
+    {
+        return;
+    }
+
+    stop_sampler( eventSet );
+    for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
+    {
+        free( eventSet->samples[ i ].pairs );
+    }
+    pthread_cond_destroy( &eventSet->wakeup );
+    pthread_mutex_destroy( &eventSet->lock );
+    free( eventSet );
+}
+
+
+/* *********************************************************************
+ * Metric source management
+ **********************************************************************/
+
+/** @brief Parses the list of requested metric names.
+ *
+ *  @param listOfMetricNames        Content of environment variable specifying
+ *                                  requested metric names.
+ *  @param metricsSeparator         Character separating entries in list of
+ *                                  metric names.
+ *
+ *  @return Returns definition data of specified metrics.
+ */
+static scorep_metric_definition_data*
+scorep_metric_proc_open( const char* listOfMetricNames,
+                         const char* metricsSeparator )
+{
+    char* env_metrics = UTILS_CStr_dup( listOfMetricNames );
+    if ( strlen( env_metrics ) == 0 )
+    {
+        free( env_metrics );
+        return NULL;
+    }
+
+    scorep_metric_definition_data* definitions = calloc( 1, sizeof( scorep_metric_definition_data ) );
+    UTILS_ASSERT( definitions );
+
+    for ( char* token = env_metrics; *token; token++ )
+    {
+        *token = tolower( *token );
+    }
+
+    if ( strcmp( env_metrics, "all" ) == 0 )
+    {
+        for ( uint32_t i = 0; i < SCOREP_PROC_CNTR_MAXNUM; i++ )
+        {
+            definitions->active_metrics[ definitions->number_of_metrics++ ] = &scorep_proc_metrics[ i ];
+        }
+    }
+    else
+    {
+        char* token = strtok( env_metrics, metricsSeparator );
+        while ( token )
+        {
+            UTILS_ASSERT( definitions->number_of_metrics < SCOREP_PROC_CNTR_MAXNUM );
+
+            scorep_proc_metric_type index = SCOREP_PROC_CNTR_MAXNUM;
+            for ( int i = 0; i < SCOREP_PROC_CNTR_MAXNUM; i++ )
+            {
+                if ( strcmp( scorep_proc_metrics[ i ].name, token ) == 0 )
+                {
+                    index = scorep_proc_metrics[ i ].index;
+                }
+            }
+            UTILS_BUG_ON( index == SCOREP_PROC_CNTR_MAXNUM,
+                          "Invalid proc metric name ('%s') specified.", token );
+            definitions->active_metrics[ definitions->number_of_metrics++ ] = &scorep_proc_metrics[ index ];
+
+            token = strtok( NULL, metricsSeparator );
+        }
+    }
+
+    free( env_metrics );
+
+    return definitions;
+}
+
+/** @brief  Registers configuration variables for the metric sources.
+ *
+ *  @return It returns SCOREP_SUCCESS if successful,
+ *          otherwise an error code will be reported.
+ */
+static SCOREP_ErrorCode
+scorep_metric_proc_register( void )
+{
+    UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, " register proc metric source!" );
+
+    SCOREP_ErrorCode status = SCOREP_ConfigRegister( "metric", scorep_metric_proc_confvars );
+    if ( status != SCOREP_SUCCESS )
+    {
+        UTILS_WARNING( "Registration of PROC configuration variables failed." );
+    }
+
+    return status;
+}
+
+/** @brief Called on deregistration of the metric source.
+ */
+static void
+scorep_metric_proc_deregister( void )
+{
+    free( scorep_metric_proc );
+    free( scorep_metric_proc_separator );
+
+    UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, " proc metric source deregister!" );
+}
+
+/** @brief  Initialize /proc metric source.
+ *
+ *  All metrics of this source are asynchronous per-process metrics, thus
+ *  no 'strictly synchronous' metrics are provided.
+ *
+ *  @return Returns 0.
+ */
+static uint32_t
+scorep_metric_proc_initialize_source( void )
+{
+    if ( scorep_metric_proc_initialize )
+    {
+        UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, "[PROC] per-process metrics = %s", scorep_metric_proc );
+        metric_defs = scorep_metric_proc_open( scorep_metric_proc, scorep_metric_proc_separator );
+        if ( metric_defs != NULL )
+        {
+            if ( scorep_metric_proc_interval == 0 )
+            {
+                UTILS_WARNING( "[PROC] SCOREP_METRIC_PROC_INTERVAL must be positive, using 100000." );
+                scorep_metric_proc_interval = 100000;
+            }
+            find_cgroup_dir();
+            find_cpus();
+        }
+
+        scorep_metric_proc_initialize = 0;
+    }
+
+    return 0;
+}
+
+/** @brief Metric source finalization.
+ */
+static void
+scorep_metric_proc_finalize_source( void )
+{
+    if ( !scorep_metric_proc_initialize )
+    {
+        free( metric_defs );
+        metric_defs = NULL;
+        free( cpus );
+        cpus           = NULL;
+        number_of_cpus = 0;
+
+        scorep_metric_proc_initialize = 1;
+        UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, " finalize proc metric source." );
+    }
+}
+
+/** @brief  Location specific initialization function for metric sources.
+ *
+ *  Starts the sampler thread on the first location of the process.
+ *
+ *  @param location             Location data.
+ *  @param sync_type            Synchronicity of requested metrics.
+ *  @param metric_type          Scope of requested metrics.
+ */
+static SCOREP_Metric_EventSet*
+scorep_metric_proc_initialize_location( struct SCOREP_Location*    locationData,
+                                        SCOREP_MetricSynchronicity sync_type,
+                                        SCOREP_MetricPer           metric_type )
+{
+    if ( sync_type != SCOREP_METRIC_ASYNC
+         || metric_type != SCOREP_METRIC_PER_PROCESS
+         || metric_defs == NULL )
+    {
+        return NULL;
+    }
+
+    SCOREP_Metric_EventSet* event_set = calloc( 1, sizeof( SCOREP_Metric_EventSet ) );
+    UTILS_ASSERT( event_set );
+    event_set->definitions = metric_defs;
+    pthread_mutex_init( &event_set->lock, NULL );
+    pthread_cond_init( &event_set->wakeup, NULL );
+
+    start_sampler( event_set );
+
+    UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, "[PROC] This location samples per-process metrics." );
+
+    return event_set;
+}
+
+/** @brief Location specific finalization function for metric sources.
+ *
+ *  @param eventSet  Reference to active set of metrics.
+ */
+static void
+scorep_metric_proc_finalize_location( SCOREP_Metric_EventSet* eventSet )
+{
+    destroy_event_set( eventSet );
+}
+
+/** @brief Frees memory allocated for requested event set.
+ *
+ *  @param eventSet  Reference to active set of metrics.
+ */
+static void
+scorep_metric_proc_free_event_set( SCOREP_Metric_EventSet* eventSet )
+{
+    destroy_event_set( eventSet );
+}
+
+/** @brief Hands the samples taken so far over to the measurement system.
+ *
+ *  A forced update happens at the end of the measurement and stops the
+ *  sampler thread.
+ *
+ *  @param      eventSet            Reference to active set of metrics.
+ *  @param[out] timeValuePairs      Samples of each metric, to be freed by the caller.
+ *  @param[out] numPairs            Number of samples of each metric.
+ *  @param      forceUpdate         Stop sampling and return all samples.
+ */
+static void
+scorep_metric_proc_asynchronous_read( SCOREP_Metric_EventSet*      eventSet,
+                                      SCOREP_MetricTimeValuePair** timeValuePairs,
+                                      uint64_t**                   numPairs,
+                                      bool                         forceUpdate )
+{
+    UTILS_ASSERT( eventSet );
+    UTILS_ASSERT( timeValuePairs );
+
+    if ( forceUpdate )
+    {
+        stop_sampler( eventSet );
+    }
+
+    *numPairs = malloc( eventSet->definitions->number_of_metrics * sizeof( uint64_t ) );
+    UTILS_ASSERT( *numPairs );
+
+    pthread_mutex_lock( &eventSet->lock );
+    for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
+    {
+        timeValuePairs[ i ]  = eventSet->samples[ i ].pairs;
+        ( *numPairs )[ i ]   = eventSet->samples[ i ].number_of_pairs;
+        eventSet->samples[ i ].pairs           = NULL;
+        eventSet->samples[ i ].number_of_pairs = 0;
+        eventSet->samples[ i ].capacity        = 0;
+    }
+    pthread_mutex_unlock( &eventSet->lock );
+}
+
+/** @brief  Gets number of active metrics.
+ *
+ *  @param  eventSet    Reference to active set of metrics.
+ *
+ *  @return Returns number of active metrics.
+ */
+static uint32_t
+scorep_metric_proc_get_number_of_metrics( SCOREP_Metric_EventSet* eventSet )
+{
+    if ( eventSet == NULL )
+    {
+        return 0;
+    }
+
+    return eventSet->definitions->number_of_metrics;
+}
+
+/** @brief  Returns name of metric @metricIndex.
+ *
+ *  @param  eventSet    Reference to active set of metrics.
+ *  @param  metricIndex Index of requested metric.
+ *
+ *  @return Returns name of requested metric.
+ */
+static const char*
+scorep_metric_proc_get_metric_name( SCOREP_Metric_EventSet* eventSet,
+                                    uint32_t                metricIndex )
+{
+    UTILS_ASSERT( eventSet );
+
+    if ( metricIndex < eventSet->definitions->number_of_metrics )
+    {
+        return eventSet->definitions->active_metrics[ metricIndex ]->name;
+    }
+    return "";
+}
+
+/** @brief  Gets description of requested metric.
+ *
+ *  @param  eventSet    Reference to active set of metrics.
+ *  @param  metricIndex Index of requested metric.
+ *
+ *  @return Returns description of requested metric.
+ */
+static const char*
+scorep_metric_proc_get_metric_description( SCOREP_Metric_EventSet* eventSet,
+                                           uint32_t                metricIndex )
+{
+    UTILS_ASSERT( eventSet );
+
+    if ( metricIndex < eventSet->definitions->number_of_metrics )
+    {
+        return eventSet->definitions->active_metrics[ metricIndex ]->description;
+    }
+    return "";
+}
+
+/** @brief  Gets unit of requested metric.
+ *
+ *  @param  eventSet    Reference to active set of metrics.
+ *  @param  metricIndex Index of requested metric.
+ *
+ *  @return Returns unit of requested metric.
+ */
+static const char*
+scorep_metric_proc_get_metric_unit( SCOREP_Metric_EventSet* eventSet,
+                                    uint32_t                metricIndex )
+{
+    UTILS_ASSERT( eventSet );
+
+    if ( metricIndex < eventSet->definitions->number_of_metrics )
+    {
+        return eventSet->definitions->active_metrics[ metricIndex ]->unit;
+    }
+    return "";
+}
+
+/** @brief  Gets properties of requested metric.
+ *
+ *  @param  eventSet    Reference to active set of metrics.
+ *  @param  metricIndex Index of requested metric.
+ *
+ *  @return Returns properties of requested metric.
+ */
+static SCOREP_Metric_Properties
+scorep_metric_proc_get_metric_properties( SCOREP_Metric_EventSet* eventSet,
+                                          uint32_t                metricIndex )
+{
+    UTILS_ASSERT( eventSet );
+
+    SCOREP_Metric_Properties props;
+
+    if ( metricIndex < eventSet->definitions->number_of_metrics )
+    {
+        const scorep_proc_metric* metric = eventSet->definitions->active_metrics[ metricIndex ];
+        props.name           = metric->name;
+        props.description    = metric->description;
+        props.source_type    = SCOREP_METRIC_SOURCE_TYPE_OTHER;
+        props.mode           = metric->mode;
+        props.value_type     = SCOREP_METRIC_VALUE_UINT64;
+        props.base           = metric->base;
+        props.exponent       = metric->exponent;
+        props.unit           = metric->unit;
+        props.profiling_type = SCOREP_METRIC_PROFILING_TYPE_INCLUSIVE;
+    }
+    else
+    {
+        props.name           = "";
+        props.description    = "";
+        props.source_type    = SCOREP_INVALID_METRIC_SOURCE_TYPE;
+        props.mode           = SCOREP_INVALID_METRIC_MODE;
+        props.value_type     = SCOREP_INVALID_METRIC_VALUE_TYPE;
+        props.base           = SCOREP_INVALID_METRIC_BASE;
+        props.exponent       = 0;
+        props.unit           = "";
+        props.profiling_type = SCOREP_INVALID_METRIC_PROFILING_TYPE;
+    }
+
+    return props;
+}
+
+/** Implementation of the metric source initialization/finalization struct */
+const SCOREP_MetricSource SCOREP_Metric_Proc =
+{
+    SCOREP_METRIC_SOURCE_TYPE_OTHER,
+    &scorep_metric_proc_register,
+    &scorep_metric_proc_initialize_source,
+    &scorep_metric_proc_initialize_location,
+    NULL,                                           // no synchronization function needed
+    &scorep_metric_proc_free_event_set,
+    &scorep_metric_proc_finalize_location,
+    &scorep_metric_proc_finalize_source,
+    &scorep_metric_proc_deregister,
+    NULL,                                           // no strictly synchronous read function needed
+    NULL,                                           // no synchronous read function needed
+    &scorep_metric_proc_asynchronous_read,
+    &scorep_metric_proc_get_number_of_metrics,
+    &scorep_metric_proc_get_metric_name,
+    &scorep_metric_proc_get_metric_description,
+    &scorep_metric_proc_get_metric_unit,
+    &scorep_metric_proc_get_metric_properties
+};
@@ -0,0 +1,33 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+#ifndef SCOREP_METRIC_PROC_H
+#define SCOREP_METRIC_PROC_H
+
+
+/**
+ * @file
+ *
+ * @brief /proc and cgroup metric source definition object.
+ */
+
+#include "SCOREP_Metric_Source.h"
+
+/**
+   The metric source initialization and finalization function structure for the
+   /proc and cgroup metric source.
+ */
+extern const SCOREP_MetricSource SCOREP_Metric_Proc;
+
+
+#endif /* SCOREP_METRIC_PROC_H */
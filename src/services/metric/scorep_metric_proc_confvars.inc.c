@@ -0,0 +1,81 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+/**
+ * @file
+ *
+ *
+ */
+
+#include <SCOREP_Config.h>
+
+/** Contains the name of requested metrics. */
+static char* scorep_metric_proc = NULL;
+
+/** Contains the separator of metric names. */
+static char* scorep_metric_proc_separator = NULL;
+
+/** Sampling interval in microseconds. */
+static uint64_t scorep_metric_proc_interval = 0;
+
+/** List of configuration variables for the /proc and cgroup metric source.
+ *
+ *  Current configuration variables are:
+ *  @li @c SCOREP_METRIC_PROC list of requested metric names.
+ *  @li @c SCOREP_METRIC_PROC_SEP character that separates single metric names.
+ *  @li @c SCOREP_METRIC_PROC_INTERVAL sampling interval in microseconds.
+ */
+static const SCOREP_ConfigVariable scorep_metric_proc_confvars[] = {
+    {
+        "proc",
+        SCOREP_CONFIG_TYPE_STRING,
+        &scorep_metric_proc,
+        NULL,
+        "",
+        "System metric names to sample per process",
+        "List of requested metric names read from /proc, /sys, and the cgroup "
+        "of the process by a background thread.\n"
+        "\n"
+        "Possible values:\n"
+        "\240-\240`mem_available`: memory available for new allocations on the node\n"
+        "\240-\240`pgfault`: page faults on the node\n"
+        "\240-\240`pgmajfault`: major page faults on the node\n"
+        "\240-\240`ctxt`: context switches on the node\n"
+        "\240-\240`cpu_freq`: mean frequency of the CPUs the process may run on\n"
+        "\240-\240`memory_pressure`: time tasks stalled on memory (PSI)\n"
+        "\240-\240`cgroup_memory_current`: memory used by the cgroup\n"
+        "\240-\240`cgroup_nr_throttled`: CPU throttling periods of the cgroup\n"
+        "\240-\240`cgroup_throttled_time`: time the cgroup was CPU throttled\n"
+        "\240-\240`all`: all of the above\n"
+    },
+    {
+        "proc_sep",
+        SCOREP_CONFIG_TYPE_STRING,
+        &scorep_metric_proc_separator,
+        NULL,
+        ",",
+        "Separator of system metric names",
+        "Character that separates metric names in `SCOREP_METRIC_PROC`."
+    },
+    {
+        "proc_interval",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_metric_proc_interval,
+        NULL,
+        "100000",
+        "Sampling interval of system metrics in microseconds",
+        "Time between two samples of the metrics requested in "
+        "`SCOREP_METRIC_PROC`."
+    },
+    SCOREP_CONFIG_TERMINATOR
+};
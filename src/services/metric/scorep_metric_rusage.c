@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014,
+ * Copyright (c) 2009-2014, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -40,10 +40,14 @@
 
 #include "SCOREP_Metric_Source.h"
 
+#include <SCOREP_Timer_Ticks.h>
+
 #include <UTILS_Debug.h>
 #include <UTILS_CStr.h>
 
+#include <inttypes.h>
 #include <string.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <sys/resource.h>
@@ -198,6 +202,9 @@ struct scorep_metric_definition_data
     scorep_rusage_metric* active_metrics[ SCOREP_RUSAGE_CNTR_MAXNUM ];
     /** Number of active resource usage counters */
     uint8_t               number_of_metrics;
+    /** Descriptions including the staleness bound, if
+     *  SCOREP_METRIC_RUSAGE_MIN_INTERVAL is set */
+    char*                 descriptions[ SCOREP_RUSAGE_CNTR_MAXNUM ];
 };
 
 /** Metric data structure */
@@ -205,6 +212,10 @@ struct SCOREP_Metric_EventSet
 {
     /** Structure to store resource usage metric values */
     struct rusage                  ru;
+    /** Timestamp of the sample in @a ru */
+    uint64_t                       last_read;
+    /** Whether @a ru holds a sample already */
+    bool                           has_sample;
     /** Metric definition data */
     scorep_metric_definition_data* definitions;
 };
@@ -301,9 +312,39 @@ scorep_metric_rusage_open( const char* listOfMetricNames,
 
     free( env_metrics );
 
+    if ( scorep_metric_rusage_min_interval != 0 )
+    {
+        for ( uint32_t i = 0; i < metric_defs->number_of_metrics; i++ )
+        {
+            const char* description = metric_defs->active_metrics[ i ]->description;
+            size_t      length      = strlen( description ) + 64;
+            metric_defs->descriptions[ i ] = malloc( length );
+            UTILS_ASSERT( metric_defs->descriptions[ i ] );
+            snprintf( metric_defs->descriptions[ i ], length,
+                      "%s (sampled at most every %" PRIu64 " timer ticks)",
+                      description, scorep_metric_rusage_min_interval );
+        }
+    }
+
     return metric_defs;
 }
 
+/** @brief Frees definition data created by @ref scorep_metric_rusage_open.
+ */
+static void
+scorep_metric_rusage_close( scorep_metric_definition_data* metricDefs )
+{
+    if ( metricDefs == NULL )
+    {
+        return;
+    }
+    for ( uint32_t i = 0; i < metricDefs->number_of_metrics; i++ )
+    {
+        free( metricDefs->descriptions[ i ] );
+    }
+    free( metricDefs );
+}
+
 
 /* *********************************************************************
  * Metric source management
@@ -406,9 +447,9 @@ scorep_metric_rusage_finalize_source( void )
     /* Call only, if previously initialized */
     if ( !scorep_metric_rusage_initialize )
     {
-        free( metric_defs[ STRICTLY_SYNCHRONOUS_METRIC ] );
+        scorep_metric_rusage_close( metric_defs[ STRICTLY_SYNCHRONOUS_METRIC ] );
         metric_defs[ STRICTLY_SYNCHRONOUS_METRIC ] = NULL;
-        free( metric_defs[ PER_PROCESS_METRIC ] );
+        scorep_metric_rusage_close( metric_defs[ PER_PROCESS_METRIC ] );
         metric_defs[ PER_PROCESS_METRIC ] = NULL;
 
         /* Set initialization flag */
@@ -438,6 +479,7 @@ scorep_metric_rusage_initialize_location( struct SCOREP_Location*    locationDat
         UTILS_ASSERT( strictly_synchronous_event_set );
 
         strictly_synchronous_event_set->definitions = metric_defs[ STRICTLY_SYNCHRONOUS_METRIC ];
+        strictly_synchronous_event_set->has_sample  = false;
 
         return strictly_synchronous_event_set;
     }
@@ -457,6 +499,7 @@ scorep_metric_rusage_initialize_location( struct SCOREP_Location*    locationDat
         UTILS_ASSERT( per_process_metric_event_set );
 
         per_process_metric_event_set->definitions = metric_defs[ PER_PROCESS_METRIC ];
+        per_process_metric_event_set->has_sample  = false;
 
         return per_process_metric_event_set;
     }
@@ -490,18 +533,27 @@ scorep_metric_rusage_free_event_set( SCOREP_Metric_EventSet* eventSet )
     UTILS_DEBUG_PRINTF( SCOREP_DEBUG_METRIC, " metric source freed event set!" );
 }
 
-/** @brief Reads values of all metrics in the active event set containing
- *         strictly synchronous metrics.
+/** @brief Takes a new resource usage sample for @a eventSet, unless the
+ *         previous one is less than SCOREP_METRIC_RUSAGE_MIN_INTERVAL timer
+ *         ticks old and no update is enforced.
  *
- *  @param eventSet  Reference to active set of metrics.
- *  @param values    Reference to array that will be filled with values from active metrics.
+ *  @param eventSet     Reference to active set of metrics.
+ *  @param forceUpdate  Take a new sample regardless of its age.
  */
-static void
-scorep_metric_rusage_strictly_synchronous_read( SCOREP_Metric_EventSet* eventSet,
-                                                uint64_t*               values )
+static inline void
+update_sample( SCOREP_Metric_EventSet* eventSet,
+               bool                    forceUpdate )
 {
-    UTILS_ASSERT( eventSet );
-    UTILS_ASSERT( values );
+    uint64_t now = 0;
+    if ( scorep_metric_rusage_min_interval != 0 )
+    {
+        now = SCOREP_Timer_GetClockTicks();
+        if ( eventSet->has_sample && !forceUpdate
+             && now - eventSet->last_read < scorep_metric_rusage_min_interval )
+        {
+            return;
+        }
+    }
 
     /* Get resource usage statistics
      *
@@ -513,6 +565,25 @@ scorep_metric_rusage_strictly_synchronous_read( SCOREP_Metric_EventSet* eventSet
     int ret = getrusage( SCOREP_RUSAGE_SCOPE, &( eventSet->ru ) );
     UTILS_ASSERT( ret != -1 );
 
+    eventSet->last_read  = now;
+    eventSet->has_sample = true;
+}
+
+/** @brief Reads values of all metrics in the active event set containing
+ *         strictly synchronous metrics.
+ *
+ *  @param eventSet  Reference to active set of metrics.
+ *  @param values    Reference to array that will be filled with values from active metrics.
+ */
+static void
+scorep_metric_rusage_strictly_synchronous_read( SCOREP_Metric_EventSet* eventSet,
+                                                uint64_t*               values )
+{
+    UTILS_ASSERT( eventSet );
+    UTILS_ASSERT( values );
+
+    update_sample( eventSet, false );
+
     for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
     {
         switch ( eventSet->definitions->active_metrics[ i ]->index )
@@ -609,15 +680,7 @@ scorep_metric_rusage_synchronous_read( SCOREP_Metric_EventSet* eventSet,
     UTILS_ASSERT( values );
     UTILS_ASSERT( is_updated );
 
-    /* Get resource usage statistics
-     *
-     * SCOREP_RUSAGE_SCOPE refers to one of the two modes:
-     *  - RUSAGE_THREAD: statistics for calling thread
-     *  - RUSAGE_SELF:   statistics for calling process, in multi-threaded applications
-     *                   it is the sum of resources used by all threads of calling process
-     * Please see configuration output to determine which mode is used by Score-P on your system. */
-    int ret = getrusage( SCOREP_RUSAGE_SCOPE, &( eventSet->ru ) );
-    UTILS_ASSERT( ret != -1 );
+    update_sample( eventSet, force_update );
 
     for ( uint32_t i = 0; i < eventSet->definitions->number_of_metrics; i++ )
     {
@@ -734,6 +797,19 @@ scorep_metric_rusage_get_metric_name( SCOREP_Metric_EventSet* eventSet,
     }
 }
 
+/** Returns the description of metric @a metricIndex, including the staleness
+ *  bound if samples are reused. */
+static inline const char*
+get_description( scorep_metric_definition_data* definitions,
+                 uint32_t                       metricIndex )
+{
+    if ( definitions->descriptions[ metricIndex ] )
+    {
+        return definitions->descriptions[ metricIndex ];
+    }
+    return definitions->active_metrics[ metricIndex ]->description;
+}
+
 /** @brief  Gets description of requested metric.
  *
  *  @param  eventSet    Reference to active set of metrics.
@@ -749,7 +825,7 @@ scorep_metric_rusage_get_metric_description( SCOREP_Metric_EventSet* eventSet,
 
     if ( metricIndex < eventSet->definitions->number_of_metrics )
     {
-        return eventSet->definitions->active_metrics[ metricIndex ]->description;
+        return get_description( eventSet->definitions, metricIndex );
     }
     else
     {
@@ -798,7 +874,7 @@ scorep_metric_rusage_get_metric_properties( SCOREP_Metric_EventSet* eventSet,
     if ( metricIndex < eventSet->definitions->number_of_metrics )
     {
         props.name           = eventSet->definitions->active_metrics[ metricIndex ]->name;
-        props.description    = eventSet->definitions->active_metrics[ metricIndex ]->description;
+        props.description    = get_description( eventSet->definitions, metricIndex );
         props.source_type    = SCOREP_METRIC_SOURCE_TYPE_RUSAGE;
         props.mode           = eventSet->definitions->active_metrics[ metricIndex ]->mode;
         props.value_type     = SCOREP_METRIC_VALUE_UINT64;
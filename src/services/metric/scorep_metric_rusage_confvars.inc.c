@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014,
+ * Copyright (c) 2009-2014, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -46,6 +46,9 @@ static char* scorep_metric_rusage_per_process = NULL;
 /** Contains the separator of metric names. */
 static char* scorep_metric_rusage_separator = NULL;
 
+/** Minimal number of timer ticks between two getrusage calls of a location. */
+static uint64_t scorep_metric_rusage_min_interval = 0;
+
 /** List of configuration variables for the resource usage metric source.
  *
  *  This list contains variables to specify 'synchronous strict' and
@@ -57,6 +60,7 @@ static char* scorep_metric_rusage_separator = NULL;
  *  @li @c SCOREP_METRIC_RUSAGE list of requested metric names.
  *  @li @c SCOREP_METRIC_RUSAGE_PER_PROCESS list of requested metric names recorded per-process.
  *  @li @c SCOREP_METRIC_RUSAGE_SEP character that separates single metric names.
+ *  @li @c SCOREP_METRIC_RUSAGE_MIN_INTERVAL minimal number of timer ticks between two reads.
  */
 static const SCOREP_ConfigVariable scorep_metric_rusage_confvars[] = {
     {
@@ -87,5 +91,18 @@ static const SCOREP_ConfigVariable scorep_metric_rusage_confvars[] = {
         "Character that separates metric names in `SCOREP_METRIC_RUSAGE` and "
         "`SCOREP_METRIC_RUSAGE_PER_PROCESS`."
     },
+    {
+        "rusage_min_interval",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_metric_rusage_min_interval,
+        NULL,
+        "0",
+        "Minimal interval in timer ticks between two resource usage reads",
+        "If a location read its resource usage metrics less than this number "
+        "of timer ticks ago, the previous sample is reused instead of calling "
+        "`getrusage` again. Most resource usage counters are updated by the "
+        "operating system only once per scheduler tick. The bound is appended "
+        "to the metric descriptions. 0 reads the counters at every event."
+    },
     SCOREP_CONFIG_TERMINATOR
 };
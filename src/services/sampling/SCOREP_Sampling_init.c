@@ -4,7 +4,7 @@
  * Copyright (c) 2015, 2020,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -228,6 +228,8 @@ sampling_subsystem_init_location( SCOREP_Location* location,
         scorep_create_interrupt_sources( sampling_data, sampling_sources, num_sampling_sources );
         sampling_data->nr_data = num_sampling_sources;
 
+        SCOREP_SetSampleBufferSize( location, scorep_sampling_buffer_size );
+
         UTILS_MutexUnlock( &init_sampling_mutex );
 
         sig_atomic_t touch = scorep_sampling_is_known_pthread;
@@ -300,6 +302,9 @@ sampling_subsystem_deactivate_cpu_location( SCOREP_Location*        location,
     SCOREP_Sampling_LocationData* location_data =
         SCOREP_Location_GetSubsystemData( location, sampling_subsystem_id );
     scorep_disable_interrupt_sources( location_data, sampling_sources, num_sampling_sources );
+
+    /* No further samples can arrive, pass on the buffered ones. */
+    SCOREP_FlushSampleBuffer( location );
 }
 
 /**
@@ -4,6 +4,9 @@
  * Copyright (c) 2015, 2024,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license. See the COPYING file in the package base
  * directory for details.
@@ -33,6 +36,11 @@ static char* scorep_sampling_events;
  */
 static char* scorep_sampling_separator;
 
+/**
+ * Number of samples buffered per location before they are processed
+ */
+static uint64_t scorep_sampling_buffer_size;
+
 /**
  * Array of configuration variables.
  * They are registered to the measurement system and are filled during
@@ -80,5 +88,18 @@ static const SCOREP_ConfigVariable scorep_sampling_confvars[] = {
         "Separator of sampling event names",
         "Character that separates sampling event names in `SCOREP_SAMPLING_EVENTS`"
     },
+    {
+        "buffer_size",
+        SCOREP_CONFIG_TYPE_NUMBER,
+        &scorep_sampling_buffer_size,
+        NULL,
+        "64",
+        "Number of samples buffered per location before they are processed",
+        "The interrupt handler still takes the timestamp and unwinds the call "
+        "stack of a sample. Recording the sample in the profile or trace is "
+        "deferred until the next event of the thread, or until this many "
+        "samples are buffered. Samples are not buffered if metrics are "
+        "recorded. A value of 0 disables the buffering."
+    },
     SCOREP_CONFIG_TERMINATOR
 };
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2015-2016, 2019,
+ * Copyright (c) 2015-2016, 2019, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2019,
@@ -27,7 +27,6 @@
 #include <SCOREP_InMeasurement.h>
 
 #if HAVE( BACKEND_SCOREP_TIMER_TSC ) && !HAVE( SCOREP_ARMV8_TSC )
-#include <scorep_ipc.h>
 #include <UTILS_IO.h>
 #include <string.h>
 #include <stdlib.h>
@@ -190,12 +189,8 @@ SCOREP_Timer_Initialize( void )
             }
 #  endif    /* HAVE( SCOREP_X86_64_TSC ) || HAVE( SCOREP_X86_32_TSC ) */
 
-            /* TODO: assert that all processes use TIMER_TSC running at the
-             * same frequency. For this we need to MPP communicate but MPP might
-             * not be initialized here. The frequency is interpolated at the end
-             * of the measurement, if we detect different frequencies there, this
-             * measurement is useless. Both problems can be solved by introducing
-             * a timer record per process/location. */
+            /* The frequency is interpolated at the end of the measurement
+             * and recorded per process, see SCOREP_Timer_GetClockResolution(). */
             timer_tsc_t0 = SCOREP_Timer_GetClockTicks();
             /* Either BACKEND_SCOREP_TIMER_CLOCK_GETTIME or
              * BACKEND_SCOREP_TIMER_GETTIMEOFDAY are available, see check in
@@ -295,7 +290,9 @@ SCOREP_Timer_GetClockResolution( void )
             uint64_t timer_cmp_t1 =  ( uint64_t )tp.tv_sec * UINT64_C( 1000000 ) + ( uint64_t )tp.tv_usec;
 #  endif
             /* Use interpolation to determine frequency.
-             * Interpolate and check consistency only once during finalization. */
+             * Interpolate only once during finalization. The frequency is
+             * recorded per process, thus processes may run at different
+             * frequencies. */
             static bool     first_visit = true;
             static uint64_t timer_tsc_freq;
             if ( first_visit )
@@ -303,103 +300,6 @@ SCOREP_Timer_GetClockResolution( void )
                 first_visit = false;
                 UTILS_BUG_ON( timer_cmp_t1 - timer_cmp_t0 == 0, "Start and stop timestamps must differ." );
                 timer_tsc_freq = ( double )( timer_tsc_t1 - timer_tsc_t0 ) / ( timer_cmp_t1 - timer_cmp_t0 ) * timer_cmp_freq;
-
-                /* Assert that all processes use roughly the same frequency.
-                 * Problems with non-uniform frequencies to be solved by timer
-                 * per location-group record.*/
-                if ( SCOREP_Ipc_GetRank() != 0 )
-                {
-                    SCOREP_Ipc_Gather( &timer_tsc_freq, 0, 1, SCOREP_IPC_UINT64_T, 0 );
-                }
-                else
-                {
-                    int size = SCOREP_Ipc_GetSize();
-                    UTILS_BUG_ON( size == 0 );
-                    uint64_t frequencies[ size ];
-                    SCOREP_Ipc_Gather( &timer_tsc_freq,
-                                       frequencies,
-                                       1,
-                                       SCOREP_IPC_UINT64_T,
-                                       0 );
-
-                    /* Compute average of (non-negative) frequencies using integers, see
-                     * https://www.quora.com/How-can-I-compute-the-average-of-a-large-array-of-integers-without-running-into-overflow */
-                    uint64_t avg_frequency = 0;
-                    {
-                        uint64_t x = 0;
-                        uint64_t y = 0;
-                        for ( uint64_t i = 0; i < size; ++i )
-                        {
-                            x += frequencies[ i ] / size;
-                            uint64_t b = frequencies[ i ] % size;
-                            if ( y >= size - b )
-                            {
-                                x++;
-                                y -= size - b;
-                            }
-                            else
-                            {
-                                y += b;
-                            }
-                        }
-                        /* Average is exactly x + y / N, with 0 <= y < N.
-                         * Take the integer part only. */
-                        avg_frequency = x;
-                    }
-
-                    /* HPC CPU clock frequencies are in the order of 10^9 since
-                     * 2000. We observed CPUs frequencies to differ in the order
-                     * of 10^3. Thus, we will 'accept' frequencies in the range
-                     * [average_freq - threshold, average_freq + threshold] where
-                     * threshold is 'average_freq / 10^5' (i.e. in the order of
-                     * 10^4 or 0.01%).
-                     * For slower CPUs make sure the threshold larger than (the
-                     * arbitrarily chosen) 10. */
-                    uint64_t dividend  = 100000;
-                    uint64_t threshold = avg_frequency / dividend; /* Usually in the order of 10^4 */
-                    while ( threshold < 10 &&  dividend > 0 )
-                    {
-                        dividend  = dividend / 10;
-                        threshold = avg_frequency / dividend;
-                    }
-                    /* Check for frequency outliers. */
-                    uint64_t outliers[ size ];
-                    memset( outliers, 0, sizeof( uint64_t ) * size );
-                    bool has_outlier = false;
-                    for ( int i = 0; i < size; ++i )
-                    {
-                        uint64_t abs_diff;
-                        if ( avg_frequency > frequencies[ i ] )
-                        {
-                            abs_diff = avg_frequency - frequencies[ i ];
-                        }
-                        else
-                        {
-                            abs_diff = frequencies[ i ] - avg_frequency;
-                        }
-                        if ( abs_diff > threshold )
-                        {
-                            has_outlier   = true;
-                            outliers[ i ] = frequencies[ i ];
-                        }
-                    }
-
-                    /* Report if there are outliers. */
-                    if ( has_outlier )
-                    {
-                        UTILS_WARNING( "Calculated timer (tsc) frequencies differ from average frequency "
-                                       "(%" PRIu64 " Hz) by more than %" PRIu64 " Hz. "
-                                       "Consider using a timer with a fixed frequency like gettimeofday "
-                                       "or clock_gettime. Prolonging the measurement duration might "
-                                       "mitigate the frequency variations.",
-                                       avg_frequency, threshold );
-                        for ( int i = 0; i < size; ++i )
-                        {
-                            char* is_outlier = ( outliers[ i ] != 0 ) ? " (outlier)" : "";
-                            printf( "rank[%d]:\t frequency = %" PRIu64 " Hz%s\n", i, frequencies[ i ], is_outlier );
-                        }
-                    }
-                }
             }
             return timer_tsc_freq;
 # endif /* ! HAVE( SCOREP_ARMV8_TSC ) */
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2013-2014, 2017, 2019-2025,
+ * Copyright (c) 2013-2014, 2017, 2019-2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2014-2020, 2022, 2025,
@@ -856,8 +856,10 @@ SCOREP_Config_MemoryAdapter::printHelp( void )
               << "               ISO C:\n"
               << "                malloc,realloc,calloc,free,memalign,posix_memalign,valloc,\n"
               << "                aligned_alloc\n"
+              << "               POSIX and GNU extensions:\n"
+              << "                reallocarray,mmap,mremap,munmap (anonymous mappings only)\n"
               << "               ISO C++:\n"
-              << "                new,new[],delete,delete[]\n"
+              << "                new,new[],delete,delete[], including the aligned variants\n"
               << "               Intel KNL MCDRAM API:\n"
               << "                hbw_malloc,hbw_realloc,hbw_calloc,hbw_free,hbw_posix_memalign,\n"
               << "                hbw_posix_memalign_psize\n";
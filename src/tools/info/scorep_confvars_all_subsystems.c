@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2012,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2021, 2024,
+ * Copyright (c) 2009-2014, 2021, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2012,
@@ -48,6 +48,7 @@ extern const SCOREP_Subsystem SCOREP_Subsystem_LibwrapService;
 extern const SCOREP_Subsystem SCOREP_Subsystem_MetricService;
 extern const SCOREP_Subsystem SCOREP_Subsystem_UnwindingService;
 extern const SCOREP_Subsystem SCOREP_Subsystem_SamplingService;
+extern const SCOREP_Subsystem SCOREP_Subsystem_CompilerAdapter;
 extern const SCOREP_Subsystem SCOREP_Subsystem_UserAdapter;
 extern const SCOREP_Subsystem SCOREP_Subsystem_MpiAdapter;
 extern const SCOREP_Subsystem SCOREP_Subsystem_ShmemAdapter;
@@ -79,6 +80,7 @@ const SCOREP_Subsystem* scorep_subsystems[] = {
     &SCOREP_Subsystem_SamplingService,
     &SCOREP_Subsystem_Topologies,
     &SCOREP_Subsystem_PlatformTopology,
+    &SCOREP_Subsystem_CompilerAdapter,
     &SCOREP_Subsystem_UserAdapter,
     &SCOREP_Subsystem_Opari2UserAdapter,
     &SCOREP_Subsystem_MpiAdapter,
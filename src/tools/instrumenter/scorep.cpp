@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2020, 2023-2024,
+ * Copyright (c) 2009-2014, 2020, 2023-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013,
@@ -85,6 +85,15 @@ print_help( void )
               << "  --keep-files    Do not delete temporarily created files after successful\n"
               << "                  instrumentation. By default, temporary files are deleted\n"
               << "                  if no error occurs during instrumentation.\n"
+              << "  --jobs=<n>      Processes up to <n> source files concurrently, if multiple\n"
+              << "                  source files are compiled by one command. A value of 0\n"
+              << "                  uses the number of available processors. Default is 1.\n"
+              << "  --config-cache=<dir>\n"
+              << "                  Caches the output of the scorep-config tool in the\n"
+              << "                  directory <dir>, which is created if necessary. Thus,\n"
+              << "                  the config tool is only executed once per configuration\n"
+              << "                  and environment within all instrumenter invocations\n"
+              << "                  using <dir>.\n"
               << "  --instrument-filter=<file>\n"
               << "                  Specifies the filter file for filtering functions during\n"
               << "                  compile-time. Not supported by all instrumentation methods.\n"
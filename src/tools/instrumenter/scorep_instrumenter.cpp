@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2015, 2019-2022, 2024,
+ * Copyright (c) 2009-2013, 2015, 2019-2022, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -47,6 +47,12 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <string.h>
+#include <algorithm>
 
 #include <UTILS_Error.h>
 #include <UTILS_IO.h>
@@ -69,6 +75,8 @@
 
 #include <scorep_tools_utils.hpp>
 
+extern char** environ;
+
 void
 print_help();
 
@@ -164,6 +172,21 @@ SCOREP_Instrumenter::Run( void )
            the sources are modified and, thus, the object file ends up with
            a different name. In this case we do not execute the last step.
          */
+
+        /* Source files are processed concurrently in child processes if
+           requested via --jobs. Output to stdout, i.e., preprocessing
+           without compiling, needs to keep the order. Dry runs process
+           the files in order, but otherwise like a parallel run. The
+           first source file is always processed directly, as adapters may
+           adjust the command line state for all subsequent files, e.g., by
+           enabling the separate preprocessing step. */
+        int  jobs              = m_command_line.getJobs();
+        bool first_source_file = true;
+        if ( !m_command_line.isCompiling() )
+        {
+            jobs = 1;
+        }
+
         for ( std::vector<std::string>::iterator current_file = m_input_files.begin();
               current_file != m_input_files.end();
               current_file++ )
@@ -190,12 +213,6 @@ SCOREP_Instrumenter::Run( void )
                 // Determine object file name
                 object_file = create_object_name( *current_file );
 
-                /* Setup the config tool calls for the new input file. This
-                   will already setup the compiler and user instrumentation
-                   if desired
-                 */
-                prepare_config_tool_calls( *current_file );
-
                 /* If compiling and linking is performed in one step.
                    The compiler leave no object file.
                    Thus, we delete the object file, too.
@@ -205,105 +222,21 @@ SCOREP_Instrumenter::Run( void )
                     addTempFile( object_file );
                 }
 
-                /* If we create modified source, we must add the original
-                     source directory to the include dirs, because local
-                     files may be included
-                 */
-                std::string search_path                = extract_path( *current_file );
-                std::string opari2_include_search_path = " -I" +  search_path;
-                if ( !m_cuda_adapter->isNvcc() && is_c_file( *current_file ) )
-                {
-                    #if SCOREP_BACKEND_HAVE_C_IQUOTE_SUPPORT
-                    opari2_include_search_path = " -iquote " +  search_path;
-                    #endif /* SCOREP_BACKEND_HAVE_IQUOTE_SUPPORT */
-                }
-                else if ( !m_cuda_adapter->isNvcc() && is_cpp_file( *current_file ) )
+                if ( jobs > 1 && !first_source_file )
                 {
-                    #if SCOREP_BACKEND_HAVE_CXX_IQUOTE_SUPPORT
-                    opari2_include_search_path = " -iquote " +  search_path;
-                        #endif /* SCOREP_BACKEND_HAVE_IQUOTE_SUPPORT */
+                    start_source_file_job( *current_file, object_file, jobs );
                 }
-                std::string compiler_flags_save = m_compiler_flags;
-
-                // Perform preprocessing steps
-                if ( m_command_line.getPreprocessMode() != SCOREP_Instrumenter_CmdLine::DISABLE &&
-                     !is_assembler_file( *current_file ) )
+                else
                 {
-                    std::string orig_extension = get_extension( *current_file );
-                    *current_file = preprocess( *current_file );
-                    if ( m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
-                    {
-                        std::string prep_file = m_command_line.getOutputName();
-                        if ( m_command_line.isCompiling() || prep_file.empty() )
-                        {
-                            prep_file = remove_extension( remove_path( *current_file ) )
-                                        + ".prep"
-                                        + orig_extension;
-                            addTempFile( prep_file );
-                        }
-                        m_compiler_flags += opari2_include_search_path;
-                        preprocess_source_file( *current_file, prep_file );
-                        *current_file = prep_file;
-                    }
+                    process_source_file( *current_file, object_file );
                 }
-                m_compiler_flags = compiler_flags_save;
+                first_source_file = false;
 
-                // Perform compile step
+                // Add object file to the input file list for the link command
                 if ( m_command_line.isCompiling() )
                 {
-                    if ( m_opari_adapter->isEnabled() &&
-                         m_command_line.getPreprocessMode() != SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
-                    {
-                        m_compiler_flags += opari2_include_search_path;
-                    }
-                    *current_file = precompile( *current_file );
-
-                    #if SCOREP_BACKEND_COMPILER_FC_CRAY
-                    if ( m_opari_adapter->isEnabled() &&
-                         m_command_line.getCompilerName().find( "ftn" ) != std::string::npos )
-                    {
-                        m_compiler_flags += " -I.";
-                    }
-                    #endif
-
-                    // Even though Score-P has an explicit pre-processing step, this may not sufficient
-                    // when OPARI2 is invoked. The source file with code added by OPARI2 needs to be
-                    // pre-processed again. Normally, this is done implicitly. However, this may
-                    // break for Cray wrappers with GPU architectures loaded. Those compilers get confused by
-                    // the duplicate appearance of code for both the host and accelerator architecture if
-                    // they aren't aware that the code is pre-processed. Explicitly pre-processing the file
-                    // again AND changing the file extension to represent a pre-processed file solves this issue.
-                    // This solution turned out to be portable and more reliable than adding flags for
-                    // affected compilers (it also works for PrgEnv-amd on CPE 23.09 whereas flags failed
-                    // for example). Changing the file extension earlier breaks GCC for example, because
-                    // it strictly refuses to pre-process a file which is already marked as pre-processed
-                    // because of its file extension.
-                    // We need to disable this step for CUDA & HIP compilers, since both pre-process host
-                    // and device code at the same time and are confused by the re-pre-processing.
-                    std::string prep_file = *current_file;
-                    if ( m_opari_adapter->isEnabled() &&
-                         !m_cuda_adapter->isNvcc() &&
-                         !m_hip_adapter->isHipcc() &&
-                         m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
-                    {
-                        prep_file = remove_extension(  remove_path( *current_file ) )
-                                    + get_preprocessed_extension( *current_file );
-                        preprocess_source_file( *current_file, prep_file );
-                        addTempFile( prep_file );
-                    }
-                    compile_source_file( prep_file, object_file );
-
-                    // Add object file to the input file list for the link command
                     object_files.push_back( object_file );
                 }
-                else if ( m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP
-                          && m_command_line.getOutputName().empty() )
-                {
-                    /* Preprocessing to stdout */
-                    std::stringstream command;
-                    command << "cat " << *current_file;
-                    executeCommand( command.str() );
-                }
             }
             // If it is no source file, leave the file in the input list
             else
@@ -311,6 +244,7 @@ SCOREP_Instrumenter::Run( void )
                 object_files.push_back( *current_file );
             }
         }
+        wait_for_source_file_jobs( 0 );
         free( cwd_to_free );
 
         // Replace sources by compiled by their object file names for the link command
@@ -410,6 +344,268 @@ SCOREP_Instrumenter::create_object_name( const std::string& sourceFile )
     return object_file;
 }
 
+void
+SCOREP_Instrumenter::process_source_file( std::string        current_file,
+                                          const std::string& object_file )
+{
+    /* Setup the config tool calls for the new input file. This
+       will already setup the compiler and user instrumentation
+       if desired
+     */
+    prepare_config_tool_calls( current_file );
+
+    std::string source_file                = current_file;
+    std::string opari2_include_search_path = get_opari2_include_search_path( source_file );
+    std::string compiler_flags_save        = m_compiler_flags;
+
+    // Perform preprocessing steps
+    if ( m_command_line.getPreprocessMode() != SCOREP_Instrumenter_CmdLine::DISABLE &&
+         !is_assembler_file( current_file ) )
+    {
+        std::string orig_extension = get_extension( current_file );
+        current_file = preprocess( current_file );
+        if ( m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
+        {
+            std::string prep_file = m_command_line.getOutputName();
+            if ( m_command_line.isCompiling() || prep_file.empty() )
+            {
+                prep_file = remove_extension( remove_path( current_file ) )
+                            + ".prep"
+                            + orig_extension;
+                addTempFile( prep_file );
+            }
+            m_compiler_flags += opari2_include_search_path;
+            preprocess_source_file( current_file, prep_file );
+            current_file = prep_file;
+        }
+    }
+    m_compiler_flags = compiler_flags_save;
+
+    // Perform compile step
+    if ( m_command_line.isCompiling() )
+    {
+        m_compiler_flags += get_compile_step_flags( source_file, false );
+        current_file      = precompile( current_file );
+        m_compiler_flags += get_compile_step_flags( source_file, true );
+
+        // Even though Score-P has an explicit pre-processing step, this may not sufficient
+        // when OPARI2 is invoked. The source file with code added by OPARI2 needs to be
+        // pre-processed again. Normally, this is done implicitly. However, this may
+        // break for Cray wrappers with GPU architectures loaded. Those compilers get confused by
+        // the duplicate appearance of code for both the host and accelerator architecture if
+        // they aren't aware that the code is pre-processed. Explicitly pre-processing the file
+        // again AND changing the file extension to represent a pre-processed file solves this issue.
+        // This solution turned out to be portable and more reliable than adding flags for
+        // affected compilers (it also works for PrgEnv-amd on CPE 23.09 whereas flags failed
+        // for example). Changing the file extension earlier breaks GCC for example, because
+        // it strictly refuses to pre-process a file which is already marked as pre-processed
+        // because of its file extension.
+        // We need to disable this step for CUDA & HIP compilers, since both pre-process host
+        // and device code at the same time and are confused by the re-pre-processing.
+        std::string prep_file = current_file;
+        if ( m_opari_adapter->isEnabled() &&
+             !m_cuda_adapter->isNvcc() &&
+             !m_hip_adapter->isHipcc() &&
+             m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
+        {
+            prep_file = remove_extension(  remove_path( current_file ) )
+                        + get_preprocessed_extension( current_file );
+            preprocess_source_file( current_file, prep_file );
+            addTempFile( prep_file );
+        }
+        compile_source_file( prep_file, object_file );
+    }
+    else if ( m_command_line.getPreprocessMode() == SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP
+              && m_command_line.getOutputName().empty() )
+    {
+        /* Preprocessing to stdout */
+        std::stringstream command;
+        command << "cat " << current_file;
+        executeCommand( command.str() );
+    }
+}
+
+std::string
+SCOREP_Instrumenter::get_opari2_include_search_path( const std::string& sourceFile )
+{
+    /* If we create modified source, we must add the original
+         source directory to the include dirs, because local
+         files may be included
+     */
+    std::string search_path                = extract_path( sourceFile );
+    std::string opari2_include_search_path = " -I" +  search_path;
+    if ( !m_cuda_adapter->isNvcc() && is_c_file( sourceFile ) )
+    {
+        #if SCOREP_BACKEND_HAVE_C_IQUOTE_SUPPORT
+        opari2_include_search_path = " -iquote " +  search_path;
+        #endif /* SCOREP_BACKEND_HAVE_IQUOTE_SUPPORT */
+    }
+    else if ( !m_cuda_adapter->isNvcc() && is_cpp_file( sourceFile ) )
+    {
+        #if SCOREP_BACKEND_HAVE_CXX_IQUOTE_SUPPORT
+        opari2_include_search_path = " -iquote " +  search_path;
+            #endif /* SCOREP_BACKEND_HAVE_IQUOTE_SUPPORT */
+    }
+    return opari2_include_search_path;
+}
+
+std::string
+SCOREP_Instrumenter::get_compile_step_flags( const std::string& sourceFile,
+                                             bool               afterPrecompile )
+{
+    if ( !m_opari_adapter->isEnabled() )
+    {
+        return "";
+    }
+    if ( !afterPrecompile )
+    {
+        if ( m_command_line.getPreprocessMode() != SCOREP_Instrumenter_CmdLine::EXPLICIT_STEP )
+        {
+            return get_opari2_include_search_path( sourceFile );
+        }
+        return "";
+    }
+    #if SCOREP_BACKEND_COMPILER_FC_CRAY
+    if ( m_command_line.getCompilerName().find( "ftn" ) != std::string::npos )
+    {
+        return " -I.";
+    }
+    #endif
+    return "";
+}
+
+void
+SCOREP_Instrumenter::start_source_file_job( const std::string& source_file,
+                                            const std::string& object_file,
+                                            int                jobs )
+{
+    /* Intermediate files are named after the base name of the source file
+       and created in the current working directory. Thus, source files
+       with the same base name must not be processed concurrently. */
+    std::string base_name = remove_extension( remove_path( source_file ) );
+    for ( bool conflict = true; conflict; )
+    {
+        conflict = false;
+        for ( std::map<pid_t, std::string>::iterator job = m_jobs.begin();
+              job != m_jobs.end();
+              job++ )
+        {
+            if ( job->second == base_name )
+            {
+                conflict = true;
+                break;
+            }
+        }
+        if ( conflict )
+        {
+            wait_for_source_file_jobs( m_jobs.size() - 1 );
+        }
+    }
+    wait_for_source_file_jobs( jobs - 1 );
+
+    /* The compile step of a source file appends flags to the compiler flags
+       of all subsequent source files. A child process cannot pass them back,
+       thus add them here again. */
+    std::string compile_step_flags = get_compile_step_flags( source_file, false )
+                                     + get_compile_step_flags( source_file, true );
+
+    if ( m_command_line.isDryRun() )
+    {
+        /* Print the commands in order, but treat the state like for a
+           child process, thus they match those of a real parallel run. */
+        std::string compiler_flags_save = m_compiler_flags;
+        process_source_file( source_file, object_file );
+        m_compiler_flags = compiler_flags_save + compile_step_flags;
+        return;
+    }
+
+    /* Do not let the child process write buffered output of the parent
+       a second time. */
+    std::cout.flush();
+    std::cerr.flush();
+    fflush( NULL );
+
+    pid_t pid = fork();
+    if ( pid < 0 )
+    {
+        std::cerr << "[Score-P] ERROR: Unable to create process for: "
+                  << source_file << std::endl;
+        wait_for_source_file_jobs( 0 );
+        exit( EXIT_FAILURE );
+    }
+    if ( pid == 0 )
+    {
+        /* Child process: executeCommand already exits on failure. Remove
+           only the temporary files created for this source file, the
+           parent process owns all others. */
+        size_t first_temp_file = m_command_line.getTempFiles().size();
+        process_source_file( source_file, object_file );
+        clean_temp_files( first_temp_file );
+        std::cout.flush();
+        std::cerr.flush();
+        fflush( NULL );
+        _exit( EXIT_SUCCESS );
+    }
+    m_jobs[ pid ]     = base_name;
+    m_compiler_flags += compile_step_flags;
+}
+
+void
+SCOREP_Instrumenter::wait_for_source_file_jobs( size_t maxRunning )
+{
+    bool failed = false;
+    while ( m_jobs.size() > maxRunning )
+    {
+        /* Wait only for our own jobs, other child processes are waited for
+           by their creators, e.g., by pclose() in config_tool_call(). Block
+           on one job only if no job has finished yet. */
+        int   status = 0;
+        pid_t pid    = 0;
+        bool  lost   = false;
+        for ( std::map<pid_t, std::string>::iterator job = m_jobs.begin();
+              job != m_jobs.end() && pid == 0;
+              job++ )
+        {
+            pid = waitpid( job->first, &status, WNOHANG );
+            if ( pid < 0 && errno != EINTR )
+            {
+                /* Lost track of this job, consider it failed. */
+                pid  = job->first;
+                lost = true;
+            }
+            else if ( pid < 0 )
+            {
+                pid = 0;
+            }
+        }
+        if ( pid == 0 )
+        {
+            pid = waitpid( m_jobs.begin()->first, &status, 0 );
+            if ( pid < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            if ( pid < 0 )
+            {
+                pid  = m_jobs.begin()->first;
+                lost = true;
+            }
+        }
+        m_jobs.erase( pid );
+        if ( lost || !WIFEXITED( status ) || WEXITSTATUS( status ) != EXIT_SUCCESS )
+        {
+            /* The child reported the failed command already. Let the other
+               jobs finish before giving up. */
+            failed     = true;
+            maxRunning = 0;
+        }
+    }
+    if ( failed )
+    {
+        exit( EXIT_FAILURE );
+    }
+}
+
 void
 SCOREP_Instrumenter::addTempFile( const std::string& filename )
 {
@@ -417,14 +613,16 @@ SCOREP_Instrumenter::addTempFile( const std::string& filename )
 }
 
 void
-SCOREP_Instrumenter::clean_temp_files( void )
+SCOREP_Instrumenter::clean_temp_files( size_t first )
 {
     if ( !m_command_line.hasKeepFiles() )
     {
         const std::vector<std::string>& cmd_line_files = m_command_line.getTempFiles();
-        if ( !cmd_line_files.empty() )
+        if ( cmd_line_files.size() > first )
         {
-            executeCommand( vector_to_string( cmd_line_files, "rm ", "", " " ) );
+            std::vector<std::string> files( cmd_line_files.begin() + first,
+                                            cmd_line_files.end() );
+            executeCommand( vector_to_string( files, "rm ", "", " " ) );
         }
     }
 }
@@ -449,6 +647,175 @@ SCOREP_Instrumenter::prepare_config_tool_calls( const std::string& input_file )
     m_config_base = scorep_config + target + mode;
 }
 
+/* FNV-1a hash of @a str. */
+static unsigned long long
+hash_string( const std::string& str )
+{
+    unsigned long long hash = 14695981039346656037ULL;
+    for ( std::string::size_type i = 0; i < str.size(); i++ )
+    {
+        hash ^= ( unsigned char )str[ i ];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* Hash of all environment variables, except those which change between
+   invocations of a build without affecting the config tool. */
+static unsigned long long
+get_environment_hash( void )
+{
+    static const char* const ignored[] =
+    {
+        "PWD=", "OLDPWD=", "SHLVL=", "_=",
+        "MAKEFLAGS=", "MFLAGS=", "MAKELEVEL=", "MAKE_TERMOUT=", "MAKE_TERMERR=",
+        NULL
+    };
+
+    std::vector<std::string> variables;
+    for ( char** variable = environ; variable && *variable; variable++ )
+    {
+        bool is_ignored = false;
+        for ( const char* const* prefix = ignored; *prefix && !is_ignored; prefix++ )
+        {
+            is_ignored = strncmp( *variable, *prefix, strlen( *prefix ) ) == 0;
+        }
+        if ( !is_ignored )
+        {
+            variables.push_back( *variable );
+        }
+    }
+    std::sort( variables.begin(), variables.end() );
+
+    std::string environment;
+    for ( std::vector<std::string>::iterator variable = variables.begin();
+          variable != variables.end();
+          variable++ )
+    {
+        environment.append( *variable );
+        environment.push_back( '\0' );
+    }
+    return hash_string( environment );
+}
+
+/* Turns the output of a command into words for a shell command, which are
+   the same as those of its unquoted command substitution, except that they
+   are not subject to pathname expansion. */
+static std::string
+quote_command_output( const std::string& output )
+{
+    static const char* const whitespace = " \t\n\r";
+
+    std::string            quoted;
+    std::string::size_type begin = output.find_first_not_of( whitespace );
+    while ( begin != std::string::npos )
+    {
+        std::string::size_type end = output.find_first_of( whitespace, begin );
+        if ( !quoted.empty() )
+        {
+            quoted += " ";
+        }
+        quoted += backslash_special_chars( output.substr( begin, end - begin ) );
+        begin   = output.find_first_not_of( whitespace, end );
+    }
+    return quoted;
+}
+
+std::string
+SCOREP_Instrumenter::config_tool_call( const std::string& action )
+{
+    std::string call      = m_config_base + " " + action;
+    std::string cache_dir = m_command_line.getConfigCacheDir();
+    if ( cache_dir.empty() || m_command_line.isDryRun() )
+    {
+        return "`" + call + "`";
+    }
+
+    std::map<std::string, std::string>::iterator cached = m_config_cache.find( call );
+    if ( cached != m_config_cache.end() )
+    {
+        return cached->second;
+    }
+
+    /* The key contains the modification time of the config tool, thus the
+       cache gets invalidated by a re-installation of Score-P, and a hash of
+       the environment the config tool runs in. */
+    std::string       scorep_config = m_install_data.getScorepConfig();
+    std::stringstream key;
+    struct stat       config_stat;
+    if ( stat( scorep_config.c_str(), &config_stat ) == 0 )
+    {
+        key << config_stat.st_mtime << " ";
+    }
+    key << std::hex << get_environment_hash() << std::dec << " ";
+    key << call;
+
+    /* The hash of the key names the cache file, the key itself is stored
+       in the first line to detect collisions. */
+    std::string       key_string = key.str();
+    std::stringstream cache_file;
+    cache_file << cache_dir << "/scorep-config-" << std::hex << hash_string( key_string ) << ".cache";
+
+    std::string   output;
+    std::ifstream input( cache_file.str().c_str() );
+    std::string   cached_key;
+    if ( input && std::getline( input, cached_key ) && cached_key == key_string
+         && std::getline( input, output ) )
+    {
+        if ( m_command_line.getVerbosity() >= 2 )
+        {
+            std::cerr << "[Score-P] Using cached output of: " << call << std::endl;
+        }
+        m_config_cache[ call ] = quote_command_output( output );
+        return m_config_cache[ call ];
+    }
+
+    /* Cache miss, run the config tool. On failure fall back to the plain
+       call, the shell reports the error when executing the command. */
+    FILE* pipe = popen( call.c_str(), "r" );
+    if ( !pipe )
+    {
+        return "`" + call + "`";
+    }
+    char   buffer[ 4096 ];
+    size_t length;
+    output.clear();
+    while ( ( length = fread( buffer, 1, sizeof( buffer ), pipe ) ) > 0 )
+    {
+        output.append( buffer, length );
+    }
+    if ( pclose( pipe ) != 0 )
+    {
+        return "`" + call + "`";
+    }
+
+    /* Like command substitution, turn the output into a single line. */
+    for ( std::string::iterator c = output.begin(); c != output.end(); c++ )
+    {
+        if ( *c == '\n' || *c == '\r' )
+        {
+            *c = ' ';
+        }
+    }
+    m_config_cache[ call ] = quote_command_output( output );
+
+    /* Write the cache entry to a private file first and rename it, to not
+       expose partially written entries to concurrent instrumenter runs. */
+    std::stringstream temp_file;
+    temp_file << cache_file.str() << "." << getpid();
+    std::ofstream cache( temp_file.str().c_str() );
+    if ( cache )
+    {
+        cache << key_string << "\n" << output << "\n";
+        cache.close();
+        if ( !cache || rename( temp_file.str().c_str(), cache_file.str().c_str() ) != 0 )
+        {
+            remove( temp_file.str().c_str() );
+        }
+    }
+    return m_config_cache[ call ];
+}
+
 void
 SCOREP_Instrumenter::compile_source_file( const std::string& input_file,
                                           const std::string& output_file )
@@ -467,7 +834,7 @@ SCOREP_Instrumenter::compile_source_file( const std::string& input_file,
     std::stringstream command;
     command << SCOREP_Instrumenter_InstallData::getCompilerEnvironmentVars();
     command << m_command_line.getCompilerName();
-    command << " `" << m_config_base << " " <<  cflags << "`";
+    command << " " << config_tool_call( cflags );
     command << " " << m_compiler_flags;
     command << " " << m_command_line.getFlagsBeforeInterpositionLib();
     command << " " << m_command_line.getFlagsAfterInterpositionLib();
@@ -497,7 +864,7 @@ SCOREP_Instrumenter::preprocess_source_file( const std::string& source_file,
     command = SCOREP_Instrumenter_InstallData::getCompilerEnvironmentVars()
               + m_command_line.getCompilerName()
               + " " + m_command_line.getFlagsBeforeInterpositionLib()
-              + " `" + getConfigBaseCall() + " --cppflags=" + language + "`"
+              + " " + config_tool_call( "--cppflags=" + language )
               + " " + getCompilerFlags()
               + " " + m_command_line.getFlagsAfterInterpositionLib()
               + " " + source_file;
@@ -654,10 +1021,10 @@ SCOREP_Instrumenter::link_step( void )
 #if HAVE_BACKEND( COMPILER_CONSTRUCTOR_SUPPORT )
     if ( !m_command_line.isTargetSharedLib() )
     {
-        command << " `" << m_config_base << " --constructor`";
+        command << " " << config_tool_call( "--constructor" );
     }
 #endif
-    command << " `" << m_config_base << " --ldflags`";
+    command << " " << config_tool_call( "--ldflags" );
     command << " " << m_command_line.getFlagsBeforeInterpositionLib();
 
     std::string linker_start_group_flags;
@@ -671,16 +1038,16 @@ SCOREP_Instrumenter::link_step( void )
         linker_end_group_flags   = linker_prefix + "-end-group";
     }
 #if SCOREP_BACKEND_HAVE_LINKER_START_END_GROUP
-    command << libs_prefix << linker_start_group_flags << " `" << m_config_base << " --event-libs`";
+    command << libs_prefix << linker_start_group_flags << " " << config_tool_call( "--event-libs" );
     command << " " << m_command_line.getFlagsAfterInterpositionLib() << libs_suffix;
 #else
-    command << libs_prefix << " `" << m_config_base << " --event-libs`" << libs_suffix;
+    command << libs_prefix << " " << config_tool_call( "--event-libs" ) << libs_suffix;
     command << " " << m_command_line.getFlagsAfterInterpositionLib();
 #endif
 #if SCOREP_BACKEND_HAVE_LINKER_START_END_GROUP
-    command << libs_prefix << " `" << m_config_base << " --mgmt-libs`" << linker_end_group_flags << libs_suffix;
+    command << libs_prefix << " " << config_tool_call( "--mgmt-libs" ) << linker_end_group_flags << libs_suffix;
 #else
-    command << libs_prefix << " `" << m_config_base << " --mgmt-libs`" << libs_suffix;
+    command << libs_prefix << " " << config_tool_call( "--mgmt-libs" ) << libs_suffix;
 #endif
     if ( m_command_line.getOutputName() != "" )
     {
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2014, 2019-2020, 2022,
+ * Copyright (c) 2009-2014, 2019-2020, 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -45,7 +45,9 @@
 #include <iostream>
 #include <string>
 #include <deque>
+#include <map>
 #include <vector>
+#include <sys/types.h>
 
 class SCOREP_Instrumenter_Adapter;
 class SCOREP_Instrumenter_CompilerAdapter;
@@ -142,6 +144,17 @@ private:
     void
     prepare_config_tool_calls( const std::string& input_file );
 
+    /**
+       Returns the output of the config tool for @a action, as inserted into
+       a command. Without a config cache directory this is the command
+       substitution of the config tool call. Otherwise, the output is taken
+       from the cache or the config tool is executed and its output gets
+       stored in the cache.
+       @param action The config tool action, e.g., '--ldflags'.
+     */
+    std::string
+    config_tool_call( const std::string& action );
+
     /**
        Invokes the preprocessor on a source file.
        @param input_file  Source file which is compiled.
@@ -166,9 +179,11 @@ private:
 
     /**
        Removes temporarily created files.
+       @param first Index of the first file in the list of temporary files
+                    that is removed.
      */
     void
-    clean_temp_files( void );
+    clean_temp_files( size_t first = 0 );
 
     /**
        Invokes the adapters' pre-preprocess step on the current file.
@@ -211,6 +226,57 @@ private:
     std::string
     create_object_name( const std::string& sourceFile );
 
+    /**
+       Performs preprocessing, instrumentation, and compilation of a single
+       source file.
+       @param current_file The source file, with full path.
+       @param object_file  Filename for the object file.
+     */
+    void
+    process_source_file( std::string        current_file,
+                         const std::string& object_file );
+
+    /**
+       Returns the include flag for the directory of @a sourceFile, which is
+       needed if the source file gets modified, as local files may be
+       included.
+       @param sourceFile The source file, with full path.
+     */
+    std::string
+    get_opari2_include_search_path( const std::string& sourceFile );
+
+    /**
+       Returns the flags the compile step of @a sourceFile appends to the
+       compiler flags before, or after (@a afterPrecompile) the precompile
+       step. They are kept for all subsequent source files.
+       @param sourceFile      The source file, with full path.
+       @param afterPrecompile Whether the flags after the precompile step
+                              are requested.
+     */
+    std::string
+    get_compile_step_flags( const std::string& sourceFile,
+                            bool               afterPrecompile );
+
+    /**
+       Processes a source file in a child process. Waits beforehand until
+       less than @a jobs child processes are running and no child process
+       handles a source file with the same base name.
+       @param source_file The source file, with full path.
+       @param object_file Filename for the object file.
+       @param jobs        Maximal number of concurrent child processes.
+     */
+    void
+    start_source_file_job( const std::string& source_file,
+                           const std::string& object_file,
+                           int                jobs );
+
+    /**
+       Waits until at most @a maxRunning child processes are running.
+       Aborts if a child process failed.
+     */
+    void
+    wait_for_source_file_jobs( size_t maxRunning );
+
     /* ***************************************************** Private members */
 private:
 
@@ -242,6 +308,17 @@ private:
      */
     std::string m_compiler_flags;
 
+    /**
+       Outputs of the config tool, indexed by the config tool call.
+     */
+    std::map<std::string, std::string> m_config_cache;
+
+    /**
+       Running child processes, mapped to the base name of the processed
+       source file.
+     */
+    std::map<pid_t, std::string> m_jobs;
+
     SCOREP_Instrumenter_CompilerAdapter*   m_compiler_adapter;
     SCOREP_Instrumenter_CudaAdapter*       m_cuda_adapter;
     SCOREP_Instrumenter_OpariAdapter*      m_opari_adapter;
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2015, 2018-2020, 2023-2024,
+ * Copyright (c) 2009-2013, 2015, 2018-2020, 2023-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -47,6 +47,9 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include <UTILS_IO.h>
 
@@ -81,10 +84,12 @@ SCOREP_Instrumenter_CmdLine::SCOREP_Instrumenter_CmdLine( SCOREP_Instrumenter_In
 #endif  /* SCOREP_BACKEND_COMPILER_MIC */
 
     /* Instrumenter flags */
-    m_is_dry_run     = false;
-    m_keep_files     = false;
-    m_verbosity      = 0;
-    m_is_build_check = false;
+    m_is_dry_run       = false;
+    m_keep_files       = false;
+    m_jobs             = 1;
+    m_config_cache_dir = "";
+    m_verbosity        = 0;
+    m_is_build_check   = false;
 
 #if defined( SCOREP_SHARED_BUILD )
     m_no_as_needed = false;
@@ -265,6 +270,18 @@ SCOREP_Instrumenter_CmdLine::hasKeepFiles( void )
     return m_keep_files;
 }
 
+int
+SCOREP_Instrumenter_CmdLine::getJobs( void )
+{
+    return m_jobs;
+}
+
+std::string
+SCOREP_Instrumenter_CmdLine::getConfigCacheDir( void )
+{
+    return m_config_cache_dir;
+}
+
 int
 SCOREP_Instrumenter_CmdLine::getVerbosity( void )
 {
@@ -413,6 +430,43 @@ SCOREP_Instrumenter_CmdLine::parse_parameter( const std::string& arg )
         return scorep_parse_mode_param;
     }
 
+    else if ( arg.substr( 0, 7 ) == "--jobs=" )
+    {
+        char* end;
+        long  jobs = strtol( arg.substr( 7 ).c_str(), &end, 10 );
+        if ( arg.length() == 7 || *end != '\0' || jobs < 0 )
+        {
+            std::cerr << "[Score-P] ERROR: Invalid number of jobs: '"
+                      << arg.substr( 7 ) << "'" << std::endl;
+            exit( EXIT_FAILURE );
+        }
+        if ( jobs == 0 )
+        {
+            jobs = sysconf( _SC_NPROCESSORS_ONLN );
+        }
+        m_jobs = jobs > 0 ? jobs : 1;
+        return scorep_parse_mode_param;
+    }
+
+    else if ( arg.substr( 0, 15 ) == "--config-cache=" )
+    {
+        m_config_cache_dir = arg.substr( 15 );
+        if ( m_config_cache_dir == "" )
+        {
+            std::cerr << "[Score-P] ERROR: No config cache directory specified" << std::endl;
+            exit( EXIT_FAILURE );
+        }
+        if ( !UTILS_IO_DoesFileExist( m_config_cache_dir.c_str() )
+             && mkdir( m_config_cache_dir.c_str(), 0755 ) != 0
+             && errno != EEXIST )
+        {
+            std::cerr << "[Score-P] ERROR: Unable to create config cache directory: "
+                      << "'" << m_config_cache_dir << "'" << std::endl;
+            exit( EXIT_FAILURE );
+        }
+        return scorep_parse_mode_param;
+    }
+
     else if ( arg == "--help" || arg == "-h" )
     {
         print_help();
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2013, 2015, 2019-2020, 2024,
+ * Copyright (c) 2009-2013, 2015, 2019-2020, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2014,
@@ -192,6 +192,10 @@ public:
     bool
     hasKeepFiles( void );
     int
+    getJobs( void );
+    std::string
+    getConfigCacheDir( void );
+    int
     getVerbosity( void );
     bool
     isBuildCheck( void );
@@ -500,6 +504,18 @@ private:
      */
     bool m_keep_files;
 
+    /**
+       Maximal number of source files that are processed concurrently.
+       The default is 1.
+     */
+    int m_jobs;
+
+    /**
+       Directory for caching the output of the config tool. Caching is
+       disabled if empty, which is the default.
+     */
+    std::string m_config_cache_dir;
+
     /**
        The level of verbosity. Currently, we know the levels:
        <ul>
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2013,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2016, 2019-2021, 2023-2024,
+ * Copyright (c) 2009-2016, 2019-2021, 2023-2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2013, 2015,
@@ -49,6 +49,7 @@
 #include "SCOREP_Score_Types.hpp"
 #include <SCOREP_Filter.h>
 #include <scorep_tools_utils.hpp>
+#include <otf2/OTF2_EventSizeEstimator.h>
 #include <math.h>
 #include <fstream>
 #include <iomanip>
@@ -65,85 +66,155 @@ using namespace std;
 ****************************************************************************************/
 
 
-static bool
-is_writable_file_creatable( string filename )
+/* Event sizes by the name of the OTF2 event, as used by SCOREP_Score_Event. */
+#define SCOREP_SCORE_OTF2_EVENT( name ) \
+    { #name, OTF2_EventSizeEstimator_GetSizeOf ## name ## Event }
+
+static const struct
+{
+    const char* name;
+    size_t      ( * get_size )( OTF2_EventSizeEstimator* estimator );
+} otf2_event_sizes[] =
+{
+    SCOREP_SCORE_OTF2_EVENT( BufferFlush ),
+    SCOREP_SCORE_OTF2_EVENT( CallingContextEnter ),
+    SCOREP_SCORE_OTF2_EVENT( CallingContextLeave ),
+    SCOREP_SCORE_OTF2_EVENT( CallingContextSample ),
+    SCOREP_SCORE_OTF2_EVENT( CommCreate ),
+    SCOREP_SCORE_OTF2_EVENT( CommDestroy ),
+    SCOREP_SCORE_OTF2_EVENT( Enter ),
+    SCOREP_SCORE_OTF2_EVENT( IoAcquireLock ),
+    SCOREP_SCORE_OTF2_EVENT( IoCreateHandle ),
+    SCOREP_SCORE_OTF2_EVENT( IoDeleteFile ),
+    SCOREP_SCORE_OTF2_EVENT( IoDestroyHandle ),
+    SCOREP_SCORE_OTF2_EVENT( IoDuplicateHandle ),
+    SCOREP_SCORE_OTF2_EVENT( IoOperationBegin ),
+    SCOREP_SCORE_OTF2_EVENT( IoOperationCancelled ),
+    SCOREP_SCORE_OTF2_EVENT( IoOperationComplete ),
+    SCOREP_SCORE_OTF2_EVENT( IoOperationIssued ),
+    SCOREP_SCORE_OTF2_EVENT( IoOperationTest ),
+    SCOREP_SCORE_OTF2_EVENT( IoReleaseLock ),
+    SCOREP_SCORE_OTF2_EVENT( IoSeek ),
+    SCOREP_SCORE_OTF2_EVENT( IoTryLock ),
+    SCOREP_SCORE_OTF2_EVENT( Leave ),
+    SCOREP_SCORE_OTF2_EVENT( MeasurementOnOff ),
+    SCOREP_SCORE_OTF2_EVENT( MpiCollectiveBegin ),
+    SCOREP_SCORE_OTF2_EVENT( MpiCollectiveEnd ),
+    SCOREP_SCORE_OTF2_EVENT( MpiIrecv ),
+    SCOREP_SCORE_OTF2_EVENT( MpiIrecvRequest ),
+    SCOREP_SCORE_OTF2_EVENT( MpiIsend ),
+    SCOREP_SCORE_OTF2_EVENT( MpiIsendComplete ),
+    SCOREP_SCORE_OTF2_EVENT( MpiRecv ),
+    SCOREP_SCORE_OTF2_EVENT( MpiSend ),
+    SCOREP_SCORE_OTF2_EVENT( NonBlockingCollectiveComplete ),
+    SCOREP_SCORE_OTF2_EVENT( NonBlockingCollectiveRequest ),
+    SCOREP_SCORE_OTF2_EVENT( ParameterInt ),
+    SCOREP_SCORE_OTF2_EVENT( ParameterString ),
+    SCOREP_SCORE_OTF2_EVENT( ProgramEnd ),
+    SCOREP_SCORE_OTF2_EVENT( RmaAtomic ),
+    SCOREP_SCORE_OTF2_EVENT( RmaCollectiveBegin ),
+    SCOREP_SCORE_OTF2_EVENT( RmaCollectiveEnd ),
+    SCOREP_SCORE_OTF2_EVENT( RmaOpCompleteBlocking ),
+    SCOREP_SCORE_OTF2_EVENT( RmaOpCompleteRemote ),
+    SCOREP_SCORE_OTF2_EVENT( RmaPut ),
+    SCOREP_SCORE_OTF2_EVENT( RmaReleaseLock ),
+    SCOREP_SCORE_OTF2_EVENT( RmaRequestLock ),
+    SCOREP_SCORE_OTF2_EVENT( RmaWaitChange ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadAcquireLock ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadBegin ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadCreate ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadEnd ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadFork ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadJoin ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadReleaseLock ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadTaskComplete ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadTaskCreate ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadTaskSwitch ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadTeamBegin ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadTeamEnd ),
+    SCOREP_SCORE_OTF2_EVENT( ThreadWait )
+};
+
+#undef SCOREP_SCORE_OTF2_EVENT
+
+/* Setters for the number of definitions, by the name of the OTF2
+   definition, as recorded in the profile's definition counters. */
+#define SCOREP_SCORE_OTF2_DEFINITION( name ) \
+    { #name, OTF2_EventSizeEstimator_SetNumberOf ## name ## Definitions }
+
+static const struct
 {
-    fstream temp_file( filename.c_str(), ios_base::out );
-    if ( temp_file.good() )
+    const char*    name;
+    OTF2_ErrorCode ( * set_number )( OTF2_EventSizeEstimator* estimator,
+                                     uint32_t                 number );
+} otf2_definition_numbers[] =
+{
+    SCOREP_SCORE_OTF2_DEFINITION( CallingContext ),
+    SCOREP_SCORE_OTF2_DEFINITION( InterruptGenerator ),
+    SCOREP_SCORE_OTF2_DEFINITION( Metric ),
+    SCOREP_SCORE_OTF2_DEFINITION( Parameter ),
+    SCOREP_SCORE_OTF2_DEFINITION( Region )
+};
+
+#undef SCOREP_SCORE_OTF2_DEFINITION
+
+static void
+set_number_of_definitions( OTF2_EventSizeEstimator* estimator,
+                           const string&            name,
+                           uint64_t                 number )
+{
+    for ( size_t i = 0; i < sizeof( otf2_definition_numbers ) / sizeof( otf2_definition_numbers[ 0 ] ); i++ )
     {
-        temp_file.close();
-        remove( filename.c_str() );
-        return true;
+        if ( name == otf2_definition_numbers[ i ].name )
+        {
+            otf2_definition_numbers[ i ].set_number( estimator, ( uint32_t )number );
+            return;
+        }
     }
-    return false;
 }
 
-static string
-get_temp_filename( void )
+/* Returns false if the event is unknown, its size stays unchanged then. */
+static bool
+get_event_size( OTF2_EventSizeEstimator* estimator,
+                const string&            event,
+                uint64_t*                size )
 {
-    static string      temp_dir;
-    static bool        is_initialized = false;
-    static const char* username       = getenv( "USER" );
-    static uint32_t    sequence_no    = 0;
-
-    stringstream filename;
-    filename << "scorep-score_"; // Avoid clashes with other applications
-    if ( username != NULL )
+    /* Events with a variable number of members carry the number after
+       their name, e.g., 'Metric 3'. */
+    string   name   = event;
+    uint64_t number = 0;
+    size_t   pos    = event.find( ' ' );
+    if ( pos != string::npos )
     {
-        filename << username << "_"; // Avoid interference with other users
+        name   = event.substr( 0, pos );
+        number = strtoull( event.c_str() + pos + 1, NULL, 10 );
     }
-    filename << getpid() << "_"      // Avoid interference with other process of the same user
-             << sequence_no;         // Avoid interference of multiple calls in the one tool
-
-    sequence_no++;
 
-    if ( !is_initialized )
+    if ( name == "Timestamp" )
     {
-        static string slash = "/";
-        const char*   temp;
-        is_initialized = true;
-
-        temp = getenv( "TMPDIR" );
-        if ( ( temp != NULL ) &&
-             is_writable_file_creatable( temp + slash + filename.str() ) )
-        {
-            temp_dir = temp + slash;
-            return temp_dir + filename.str();
-        }
-
-        temp = getenv( "TMP" );
-        if ( ( temp != NULL ) &&
-             is_writable_file_creatable( temp + slash + filename.str() ) )
-        {
-            temp_dir = temp + slash;
-            return temp_dir + filename.str();
-        }
-
-        temp = getenv( "TEMP" );
-        if ( ( temp != NULL ) &&
-             is_writable_file_creatable( temp + slash + filename.str() ) )
-        {
-            temp_dir = temp + slash;
-            return temp_dir + filename.str();
-        }
-
-        temp_dir = "/tmp/";
-        if ( is_writable_file_creatable( temp_dir + filename.str() ) )
-        {
-            return temp_dir + filename.str();
-        }
+        *size = OTF2_EventSizeEstimator_GetSizeOfTimestamp( estimator );
+        return true;
+    }
+    if ( name == "Metric" )
+    {
+        *size = OTF2_EventSizeEstimator_GetSizeOfMetricEvent( estimator, ( uint8_t )number );
+        return true;
+    }
+    if ( name == "ProgramBegin" )
+    {
+        *size = OTF2_EventSizeEstimator_GetSizeOfProgramBeginEvent( estimator, ( uint32_t )number );
+        return true;
+    }
 
-        temp_dir = "";
-        if ( is_writable_file_creatable( filename.str() ) )
+    for ( size_t i = 0; i < sizeof( otf2_event_sizes ) / sizeof( otf2_event_sizes[ 0 ] ); i++ )
+    {
+        if ( name == otf2_event_sizes[ i ].name )
         {
-            return filename.str();
+            *size = otf2_event_sizes[ i ].get_size( estimator );
+            return true;
         }
-
-        cerr << "ERROR: Failed to find writable directory for temporary files" << endl;
-        exit( EXIT_FAILURE );
     }
-
-    return temp_dir + filename.str();
+    return false;
 }
 
 static string
@@ -1052,78 +1123,33 @@ SCOREP_Score_Estimator::dumpEventSizes( void )
 void
 SCOREP_Score_Estimator::calculate_event_sizes( void )
 {
-    /* Write otf2-estimator input */
-    string in_filename  = get_temp_filename();
-    string out_filename = get_temp_filename();
-
-    fstream estimator_in( in_filename.c_str(), ios_base::out );
-    if ( !estimator_in )
+    OTF2_EventSizeEstimator* estimator = OTF2_EventSizeEstimator_New();
+    if ( !estimator )
     {
-        cerr << "ERROR: Failed to open temporary file for 'otf2-estimator' input" << endl;
+        cerr << "ERROR: Failed to create the OTF2 event size estimator" << endl;
         exit( EXIT_FAILURE );
     }
 
-    estimator_in << "set Region " << m_region_num << "\n";
-    estimator_in << "set Metric " << m_profile->getNumberOfMetrics() << "\n";
+    set_number_of_definitions( estimator, "Region", m_region_num );
+    set_number_of_definitions( estimator, "Metric", m_profile->getNumberOfMetrics() );
     const map<string, uint64_t>& definition_counters =
         m_profile->getDefinitionCounters();
     for ( map<string, uint64_t>::const_iterator it = definition_counters.begin();
           it != definition_counters.end(); ++it )
     {
-        estimator_in << "set " << it->first << " " << it->second << "\n";
+        set_number_of_definitions( estimator, it->first, it->second );
     }
 
     for ( map<string, SCOREP_Score_Event*>::iterator i = m_events.begin(); i != m_events.end(); i++ )
     {
-        estimator_in << "get " << i->second->getName() << "\n";
-    }
-    estimator_in << "exit" << endl;
-    estimator_in.close();
-
-    string command = OTF2_ESTIMATOR_INSTALL " > \"" +
-                     out_filename + "\" < \"" + in_filename + "\"";
-    if ( system( command.c_str() ) != EXIT_SUCCESS )
-    {
-        cerr << "ERROR: Failed to call 'otf2-estimator'" << endl;
-        exit( EXIT_FAILURE );
-    }
-
-    /* Read output of otf2-estimator */
-    fstream estimator_out( out_filename.c_str(), ios_base::in );
-    if ( !estimator_out )
-    {
-        cerr << "ERROR: Failed to open temporary file for 'otf2-estimator' output" << endl;
-        exit( EXIT_FAILURE );
-    }
-
-    while ( estimator_out )
-    {
-        /* Decode next line. Has format <name><space><number of bytes>
-         * where <name> can have spaces too. */
-        string line;
-        getline( estimator_out, line );
-        size_t size_pos = line.find_last_of( " " );
-        if ( size_pos == string::npos )
+        uint64_t size;
+        if ( get_event_size( estimator, i->first, &size ) )
         {
-            continue;
+            i->second->setEventSize( size );
         }
-        string   event = line.substr( 0, size_pos );
-        string   number( line.substr( size_pos + 1 ) );
-        char*    end_pos;
-        uint64_t value = strtoul( number.c_str(), &end_pos, 0 );
-        if ( *end_pos )
-        {
-            continue;
-        }
-
-        /* Apply to event sizes */
-        setEventSize( event, value );
     }
 
-    /* Clean up */
-    estimator_out.close();
-    remove( in_filename.c_str() );
-    remove( out_filename.c_str() );
+    OTF2_EventSizeEstimator_Delete( estimator );
 
     //dumpEventSizes();
 }
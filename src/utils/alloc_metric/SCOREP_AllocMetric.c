@@ -4,7 +4,7 @@
  * Copyright (c) 2016-2018, 2020-2022,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016, 2022, 2024,
+ * Copyright (c) 2016, 2022, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -409,6 +409,12 @@ SCOREP_AllocMetric_AddrExists( SCOREP_AllocMetric* allocMetric,
     return allocation;
 }
 
+uint64_t
+SCOREP_AllocMetric_GetAllocationSize( void* allocation )
+{
+    return ( ( allocation_item* )allocation )->size;
+}
+
 void
 SCOREP_AllocMetric_HandleAlloc( SCOREP_AllocMetric* allocMetric,
                                 uint64_t            resultAddr,
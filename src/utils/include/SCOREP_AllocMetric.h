@@ -4,7 +4,7 @@
  * Copyright (c) 2016, 2022,
  * Technische Universitaet Dresden, Germany
  *
- * Copyright (c) 2016, 2024,
+ * Copyright (c) 2016, 2024, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -81,6 +81,16 @@ SCOREP_AllocMetric_AddrExists( SCOREP_AllocMetric* allocMetric,
                                uint64_t            addr );
 
 
+/**
+ *  Returns the size of an allocation acquired with
+ *  @a SCOREP_AllocMetric_AcquireAlloc.
+ *
+ *  @param allocation  The allocation.
+ */
+uint64_t
+SCOREP_AllocMetric_GetAllocationSize( void* allocation );
+
+
 /**
  *  Handles an allocation in this metric.
  *
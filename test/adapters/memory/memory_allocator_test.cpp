@@ -0,0 +1,52 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Allocates with an operator new that is served by mmap, see
+ * memory_allocator_test_new.cpp, and maps memory once directly. Only the
+ * direct mapping must be recorded as mmap. See run_memory_allocator_test.sh.
+ */
+
+#include <sys/mman.h>
+#include <cstring>
+
+#define ITERATIONS 4
+#define BLOCK_SIZE ( 64 * 1024 )
+
+struct block
+{
+    char data[ BLOCK_SIZE ];
+};
+
+int
+main( int argc, char** argv )
+{
+    for ( int i = 0; i < ITERATIONS; i++ )
+    {
+        block* b = new block;
+        memset( b->data, i, BLOCK_SIZE );
+        delete b;
+    }
+
+    void* mapping = mmap( NULL, BLOCK_SIZE, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( mapping == MAP_FAILED )
+    {
+        return 1;
+    }
+    memset( mapping, 1, BLOCK_SIZE );
+    munmap( mapping, BLOCK_SIZE );
+
+    return 0;
+}
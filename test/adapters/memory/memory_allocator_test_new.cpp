@@ -0,0 +1,64 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Replaces the global operator new and delete by an allocator that maps
+ * every allocation. This is a separate translation unit, thus the calls
+ * from memory_allocator_test.cpp are wrapped and reach these definitions
+ * as the original functions.
+ */
+
+#include <sys/mman.h>
+#include <cstddef>
+#include <new>
+
+/* Keeps the size of the mapping and the alignment of the allocation. */
+#define HEADER_SIZE 16
+
+#if __cplusplus >= 201103L
+#define NOEXCEPT noexcept
+#else
+#define NOEXCEPT throw( )
+#endif
+
+void*
+operator new( std::size_t size )
+{
+    std::size_t length  = size + HEADER_SIZE;
+    void*       mapping = mmap( NULL, length, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( mapping == MAP_FAILED )
+    {
+        throw std::bad_alloc();
+    }
+    *( std::size_t* )mapping = length;
+    return ( char* )mapping + HEADER_SIZE;
+}
+
+void
+operator delete( void* ptr ) NOEXCEPT
+{
+    if ( !ptr )
+    {
+        return;
+    }
+    void* mapping = ( char* )ptr - HEADER_SIZE;
+    munmap( mapping, *( std::size_t* )mapping );
+}
+
+void
+operator delete( void* ptr, std::size_t size ) NOEXCEPT
+{
+    operator delete( ptr );
+}
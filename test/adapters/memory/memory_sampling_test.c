@@ -0,0 +1,202 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks the sampling decision and the weighting of recorded allocations and
+ * reallocations of the memory adapter.
+ */
+
+#include <config.h>
+
+#include <CuTest.h>
+
+#include <SCOREP_RuntimeManagement.h>
+
+/* The sampling decision and the weighting are static. */
+#include "scorep_memory_sampling.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* Defined by the memory adapter management, which is not part of this test. */
+uint64_t            scorep_memory_sampling_interval;
+size_t              scorep_memory_subsystem_id;
+SCOREP_AllocMetric* scorep_memory_metric;
+
+
+#define INTERVAL 4096
+#define TRIALS   100000
+
+
+static void
+init_data( memory_sampling_data* data,
+           uint64_t              seed )
+{
+    data->random_state       = seed * UINT64_C( 0x9e3779b97f4a7c15 );
+    data->bytes_until_sample = next_sample_distance( data );
+    data->allocations        = 0;
+    data->allocated_bytes    = 0;
+    data->deallocations      = 0;
+}
+
+
+static void
+test_sample_decision( CuTest* tc )
+{
+    static const size_t sizes[] = { 64, 1024, INTERVAL, 4 * INTERVAL };
+
+    scorep_memory_sampling_interval = INTERVAL;
+    for ( size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[ 0 ] ); i++ )
+    {
+        memory_sampling_data data;
+        init_data( &data, i + 1 );
+
+        uint64_t recorded = 0;
+        for ( int j = 0; j < TRIALS; j++ )
+        {
+            recorded += sample( &data, sizes[ i ] );
+        }
+        CuAssertIntEquals( tc, TRIALS, ( int )data.allocations );
+        CuAssertTrue( tc, data.allocated_bytes == ( uint64_t )TRIALS * sizes[ i ] );
+
+        /* Each allocation contains a sample point with probability
+         * 1 - exp(-s/N), independent of the previous ones. */
+        double p     = -expm1( -( double )sizes[ i ] / INTERVAL );
+        double sigma = sqrt( p * ( 1 - p ) / TRIALS );
+        char   message[ 128 ];
+        snprintf( message, sizeof( message ),
+                  "size %zu: recorded fraction %f, expected %f",
+                  sizes[ i ], ( double )recorded / TRIALS, p );
+        CuAssertMsg( tc, message, fabs( ( double )recorded / TRIALS - p ) < 5 * sigma );
+    }
+}
+
+
+static void
+test_sample_weight( CuTest* tc )
+{
+    scorep_memory_sampling_interval = 0;
+    CuAssertIntEquals( tc, 100, ( int )sample_weight( 100 ) );
+
+    scorep_memory_sampling_interval = INTERVAL;
+    CuAssertIntEquals( tc, 0, ( int )sample_weight( 0 ) );
+    /* N / (1 - exp(-1)) */
+    CuAssertIntEquals( tc, 6480, ( int )sample_weight( INTERVAL ) );
+    /* Small allocations account for about N + s/2 bytes, large ones for their
+     * size. */
+    CuAssertIntEquals( tc, INTERVAL + 1, ( int )sample_weight( 2 ) );
+    CuAssertTrue( tc, sample_weight( 1 << 30 ) == 1 << 30 );
+
+    /* The recorded allocations estimate the allocated bytes without bias. */
+    memory_sampling_data data;
+    init_data( &data, 42 );
+    uint64_t random_state = 42;
+    double   estimate     = 0;
+    for ( int j = 0; j < 10 * TRIALS; j++ )
+    {
+        random_state ^= random_state << 13;
+        random_state ^= random_state >> 7;
+        random_state ^= random_state << 17;
+        size_t size = random_state % ( 4 * INTERVAL ) + 1;
+        if ( sample( &data, size ) )
+        {
+            estimate += sample_weight( size );
+        }
+    }
+    char message[ 128 ];
+    snprintf( message, sizeof( message ),
+              "estimated %.0f bytes, allocated %" PRIu64 " bytes",
+              estimate, data.allocated_bytes );
+    CuAssertMsg( tc, message,
+              fabs( estimate / data.allocated_bytes - 1 ) < 0.01 );
+}
+
+
+static void
+test_realloc_weight( CuTest* tc )
+{
+    scorep_memory_sampling_interval = INTERVAL;
+
+    uint64_t addr     = 0x10000;
+    uint64_t new_addr = 0x20000;
+    scorep_memory_handle_alloc( addr, 100 );
+    CuAssertTrue( tc, is_recorded( addr ) );
+
+    /* A reallocation to the same address accounts for its size only. */
+    void*    allocation = NULL;
+    uint64_t prev_size  = 0;
+    scorep_memory_acquire_alloc( addr, &allocation );
+    CuAssertPtrNotNull( tc, allocation );
+    CuAssertTrue( tc, SCOREP_AllocMetric_GetAllocationSize( allocation ) == sample_weight( 100 ) );
+    scorep_memory_handle_realloc( addr, 200, allocation, &prev_size );
+    CuAssertTrue( tc, prev_size == sample_weight( 100 ) );
+    CuAssertTrue( tc, is_recorded( addr ) );
+
+    /* As does a reallocation to a new address. */
+    scorep_memory_acquire_alloc( addr, &allocation );
+    CuAssertPtrNotNull( tc, allocation );
+    scorep_memory_handle_realloc( new_addr, 8 * INTERVAL, allocation, &prev_size );
+    CuAssertIntEquals( tc, 200, ( int )prev_size );
+    CuAssertTrue( tc, !is_recorded( addr ) );
+    CuAssertTrue( tc, is_recorded( new_addr ) );
+
+    uint64_t size = 0;
+    scorep_memory_acquire_alloc( new_addr, &allocation );
+    CuAssertPtrNotNull( tc, allocation );
+    SCOREP_AllocMetric_HandleFree( scorep_memory_metric, allocation, &size );
+    CuAssertIntEquals( tc, 8 * INTERVAL, ( int )size );
+    CuAssertTrue( tc, !is_recorded( new_addr ) );
+
+    /* An allocation which was not recorded is unknown. */
+    scorep_memory_acquire_alloc( addr, &allocation );
+    CuAssertPtrEquals( tc, NULL, allocation );
+}
+
+
+int
+main( void )
+{
+    CuUseColors();
+    CuString* output = CuStringNew();
+    CuSuite*  suite  = CuSuiteNew( "Memory sampling" );
+
+    SUITE_ADD_TEST_NAME( suite, test_sample_decision,
+                         "sampling decision" );
+    SUITE_ADD_TEST_NAME( suite, test_sample_weight,
+                         "weight of allocations" );
+    SUITE_ADD_TEST_NAME( suite, test_realloc_weight,
+                         "weight of reallocations" );
+
+    SCOREP_InitMeasurement();
+    SCOREP_AllocMetric_New( "Host Memory", &scorep_memory_metric );
+
+    CuSuiteRun( suite );
+
+    SCOREP_AllocMetric_Destroy( scorep_memory_metric );
+    SCOREP_FinalizeMeasurement();
+
+    CuSuiteSummary( suite, output );
+
+    int failCount = suite->failCount;
+    if ( failCount )
+    {
+        printf( "%s", output->buffer );
+    }
+
+    CuSuiteFree( suite );
+    CuStringFree( output );
+
+    return failCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -56,6 +56,9 @@ main( int argc, char** argv )
         SUITE_ADD_TEST_NAME( suite, test_reduce_scatter, "reduce_scatter" );
         SUITE_ADD_TEST_NAME( suite, test_scan, "scan" );
         SUITE_ADD_TEST_NAME( suite, test_exscan, "exscan" );
+        SUITE_ADD_TEST_NAME( suite, test_alltoallv_inplace_payload, "alltoallv inplace with payload" );
+        SUITE_ADD_TEST_NAME( suite, test_gather_intercomm, "gather on intercommunicator" );
+        SUITE_ADD_TEST_NAME( suite, test_allgather_intercomm, "allgather on intercommunicator" );
 
         CuSuiteRun( suite );
     }
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -14,6 +14,8 @@
 #include "collectives_byte_calc_test.h"
 #include <scorep_mpi_coll.h>
 
+#include <string.h>
+
 void
 test_barrier( CuTest* ct )
 {
@@ -21,7 +23,7 @@ test_barrier( CuTest* ct )
     ByteCounts bytes    = { bogus64, bogus64 };
     ByteCounts expected = { 0, 0 };
 
-    scorep_mpi_coll_bytes_barrier( testComm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_barrier( testComm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, bytes, expected );
 }
 
@@ -69,7 +71,7 @@ test_gather( CuTest* ct )
     }
     scorep_mpi_coll_bytes_gather( sendcount, sendtype,
                                   recvcount, recvtype,
-                                  root, inplace, testComm,
+                                  root, inplace, testComm, NULL,
                                   &bytes.send, &bytes.recv );
 
     ByteCounts expected = { 0, 0 };
@@ -127,7 +129,7 @@ test_gather_inplace( CuTest* ct )
     }
     scorep_mpi_coll_bytes_gather( sendcount, sendtype,
                                   recvcount, recvtype,
-                                  root, inplace, testComm,
+                                  root, inplace, testComm, NULL,
                                   &bytes.send, &bytes.recv );
 
     ByteCounts expected = { 0, 0 };
@@ -160,7 +162,7 @@ test_reduce( CuTest* ct )
     MPI_Datatype datatype = Int32x2;
 
     scorep_mpi_coll_bytes_reduce( count, datatype,
-                                  root, inplace, testComm,
+                                  root, inplace, testComm, NULL,
                                   &bytes.send, &bytes.recv );
 
     ByteCounts expected = { 0, 0 };
@@ -228,7 +230,7 @@ test_gatherv( CuTest* ct )
     }
     scorep_mpi_coll_bytes_gatherv( sendcount, sendtype,
                                    recvcounts, recvtype,
-                                   root, inplace, testComm,
+                                   root, inplace, testComm, NULL,
                                    &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -288,7 +290,7 @@ test_gatherv_inplace( CuTest* ct )
     }
     scorep_mpi_coll_bytes_gatherv( sendcount, sendtype,
                                    recvcounts, recvtype,
-                                   root, inplace, testComm,
+                                   root, inplace, testComm, NULL,
                                    &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -329,7 +331,7 @@ test_bcast( CuTest* ct )
             break;
     }
     scorep_mpi_coll_bytes_bcast( count, datatype,
-                                 root, testComm,
+                                 root, testComm, NULL,
                                  &bytes.send, &bytes.recv );
 
     ByteCounts expected = { 0, 0 };
@@ -388,7 +390,7 @@ test_scatter( CuTest* ct )
     }
     scorep_mpi_coll_bytes_scatter( sendcount, sendtype,
                                    recvcount, recvtype,
-                                   root, inplace, testComm,
+                                   root, inplace, testComm, NULL,
                                    &bytes.send, &bytes.recv );
 
     ByteCounts expected = { 0, 0 };
@@ -454,7 +456,7 @@ test_scatterv( CuTest* ct )
     }
     scorep_mpi_coll_bytes_scatterv( sendcounts, sendtype,
                                     recvcount, recvtype,
-                                    root, inplace, testComm,
+                                    root, inplace, testComm, NULL,
                                     &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -498,7 +500,7 @@ test_alltoall( CuTest* ct )
     }
     scorep_mpi_coll_bytes_alltoall( sendcount, sendtype,
                                     recvcount, recvtype,
-                                    inplace, testComm,
+                                    inplace, testComm, NULL,
                                     &bytes.send, &bytes.recv );
 
     ByteCounts expected = { .send = 4 * ( 4 * 100 ), .recv = 4 * ( 4 * 100 ) };
@@ -540,7 +542,7 @@ test_alltoall_inplace( CuTest* ct )
     /* wrong values for sendcount, sendtype are ignored */
     scorep_mpi_coll_bytes_alltoall( sendcount, sendtype,
                                     recvcount, recvtype,
-                                    inplace, testComm,
+                                    inplace, testComm, NULL,
                                     &bytes.send, &bytes.recv );
 
     ByteCounts expected = { .send = 3 * ( 4 * 100 ), .recv = 3 * ( 4 * 100 ) };
@@ -602,7 +604,7 @@ test_alltoallv( CuTest* ct )
     /* *INDENT-ON* */
     scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype,
                                      recvcounts, recvtype,
-                                     inplace, testComm,
+                                     inplace, testComm, NULL,
                                      &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -655,7 +657,7 @@ test_alltoallv_inplace( CuTest* ct )
     /* wrong values for sendcounts, sendtype are ignored */
     scorep_mpi_coll_bytes_alltoallv( sendcounts, sendtype,
                                      recvcounts, recvtype,
-                                     inplace, testComm,
+                                     inplace, testComm, NULL,
                                      &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -719,7 +721,7 @@ test_alltoallw( CuTest* ct )
     /* *INDENT-ON* */
     scorep_mpi_coll_bytes_alltoallw( sendcounts, sendtypes,
                                      recvcounts, recvtypes,
-                                     inplace, testComm,
+                                     inplace, testComm, NULL,
                                      &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -772,7 +774,7 @@ test_allgather( CuTest* ct )
     }
     scorep_mpi_coll_bytes_allgather( sendcount, sendtype,
                                      recvcount, recvtype,
-                                     inplace, testComm,
+                                     inplace, testComm, NULL,
                                      &bytes.send, &bytes.recv );
 
     ByteCounts expected = { .send = 4 * ( 4 * 100 ), .recv = 4 * ( 4 * 100 ) };
@@ -835,7 +837,7 @@ test_allgatherv( CuTest* ct )
     /* *INDENT-ON* */
     scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype,
                                       recvcounts, recvtype,
-                                      inplace, testComm,
+                                      inplace, testComm, NULL,
                                       &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -889,7 +891,7 @@ test_allgatherv_inplace( CuTest* ct )
     /* wrong values for sendcount, sendtype are ignored */
     scorep_mpi_coll_bytes_allgatherv( sendcount, sendtype,
                                       recvcounts, recvtype,
-                                      inplace, testComm,
+                                      inplace, testComm, NULL,
                                       &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
@@ -913,7 +915,7 @@ test_allreduce( CuTest* ct )
     MPI_Datatype datatype = Int32x4;
 
     scorep_mpi_coll_bytes_allreduce( count, datatype,
-                                     inplace, testComm,
+                                     inplace, testComm, NULL,
                                      &bytes.send, &bytes.recv );
 
     ByteCounts expected = { .send = 4 * 25 * ( 4 * 4 ), .recv = 4 * 25 * ( 4 * 4 ) };
@@ -938,7 +940,7 @@ test_reduce_scatter_block( CuTest* ct )
     MPI_Datatype datatype  = Int32x2;
 
     scorep_mpi_coll_bytes_reduce_scatter_block( recvcount, datatype,
-                                                inplace, testComm,
+                                                inplace, testComm, NULL,
                                                 &bytes.send, &bytes.recv );
 
     ByteCounts expected = { .send = 4 * 50 * ( 4 * 2 ), .recv = 4 * 50 * ( 4 * 2 ) };
@@ -981,7 +983,7 @@ test_reduce_scatter( CuTest* ct )
             break;
     }
     scorep_mpi_coll_bytes_reduce_scatter( recvcounts, datatype,
-                                          inplace, testComm,
+                                          inplace, testComm, NULL,
                                           &bytes.send, &bytes.recv );
 
 
@@ -1023,7 +1025,7 @@ test_scan( CuTest* ct )
             break;
     }
     scorep_mpi_coll_bytes_scan( count, datatype,
-                                inplace, testComm,
+                                inplace, testComm, NULL,
                                 &bytes.send, &bytes.recv );
 
 
@@ -1065,10 +1067,159 @@ test_exscan( CuTest* ct )
             break;
     }
     scorep_mpi_coll_bytes_exscan( count, datatype,
-                                  inplace, testComm,
+                                  inplace, testComm, NULL,
+                                  &bytes.send, &bytes.recv );
+
+
+
+    validate_byte_counts( ct, bytes, expected );
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Constructed definition payloads
+ *
+ * With a payload, the byte calculations must not query the communicator.
+ * The tests pass MPI_COMM_NULL together with the payload. Tests computing
+ * the counts also without payload check these only after the collective
+ * validate_byte_counts.
+ * -------------------------------------------------------------------------- */
+
+void
+test_alltoallv_inplace_payload( CuTest* ct )
+{
+    validate_comm_size( ct, 4 );
+
+    int rank;
+    MPI_Comm_rank( testComm, &rank );
+
+    scorep_mpi_comm_definition_payload payload = {
+        .comm_size  = 4,
+        .local_rank = rank,
+        .topology   = MPI_UNDEFINED
+    };
+
+    /* In place, the own block is neither sent nor received */
+    int        recvcounts[ 4 ] = { 10, 20, 30, 40 };
+    ByteCounts bytes           = { bogus64, bogus64 };
+    scorep_mpi_coll_bytes_alltoallv( NULL, BogusType,
+                                     recvcounts, Int32x1,
+                                     1, MPI_COMM_NULL, &payload,
+                                     &bytes.send, &bytes.recv );
+
+    const uint64_t exchanged = ( 100 - recvcounts[ rank ] ) * 4;
+    ByteCounts     expected  = { exchanged, exchanged };
+    validate_byte_counts( ct, bytes, expected );
+}
+
+/*
+ * Connects the ranks 0 and 1 of testComm, the low group, with the ranks 2
+ * and 3, the high group. Fills payload like the communicator management
+ * does, which encodes the group in the high bit of remote_comm_size.
+ */
+static MPI_Comm
+create_intercomm( scorep_mpi_comm_definition_payload* payload )
+{
+    int rank;
+    MPI_Comm_rank( testComm, &rank );
+    int high = rank >= 2;
+
+    MPI_Comm local_comm;
+    MPI_Comm intercomm;
+    MPI_Comm_split( testComm, high, rank, &local_comm );
+    MPI_Intercomm_create( local_comm, 0, testComm, high ? 0 : 2, 0, &intercomm );
+    MPI_Comm_free( &local_comm );
+
+    memset( payload, 0, sizeof( *payload ) );
+    payload->comm_size        = 2;
+    payload->local_rank       = rank % 2;
+    payload->remote_comm_size = 2 | ( ( uint32_t )high << 31 );
+    payload->is_intercomm     = true;
+    payload->topology         = MPI_UNDEFINED;
+    return intercomm;
+}
+
+void
+test_gather_intercomm( CuTest* ct )
+{
+    validate_comm_size( ct, 4 );
+
+    int rank;
+    MPI_Comm_rank( testComm, &rank );
+
+    scorep_mpi_comm_definition_payload payload;
+    MPI_Comm                           intercomm = create_intercomm( &payload );
+
+    /* Rank 0 of the low group is the root */
+    int          root      = bogus32;
+    int          sendcount = bogus32;
+    int          recvcount = bogus32;
+    MPI_Datatype sendtype  = BogusType;
+    MPI_Datatype recvtype  = BogusType;
+    ByteCounts   expected  = { 0, 0 };
+    switch ( rank )
+    {
+        case 0:
+            root      = MPI_ROOT;
+            recvcount = 50;
+            recvtype  = Int32x2;
+            expected  = ( ByteCounts ){.send = 0, .recv = 2 * ( 50 * 8 ) };
+            break;
+        case 1:
+            root = MPI_PROC_NULL;
+            break;
+        case 2:
+        case 3:
+            root      = 0;
+            sendcount = 100;
+            sendtype  = Int32x1;
+            expected  = ( ByteCounts ){.send = 100 * 4, .recv = 0 };
+            break;
+    }
+
+    ByteCounts queried = { bogus64, bogus64 };
+    scorep_mpi_coll_bytes_gather( sendcount, sendtype,
+                                  recvcount, recvtype,
+                                  root, 0, intercomm, NULL,
+                                  &queried.send, &queried.recv );
+    MPI_Comm_free( &intercomm );
+
+    ByteCounts bytes = { bogus64, bogus64 };
+    scorep_mpi_coll_bytes_gather( sendcount, sendtype,
+                                  recvcount, recvtype,
+                                  root, 0, MPI_COMM_NULL, &payload,
                                   &bytes.send, &bytes.recv );
 
+    validate_byte_counts( ct, bytes, expected );
+    CuAssertIntEqualsMsg( ct, "Sent bytes without payload", expected.send, queried.send );
+    CuAssertIntEqualsMsg( ct, "Received bytes without payload", expected.recv, queried.recv );
+}
+
+void
+test_allgather_intercomm( CuTest* ct )
+{
+    validate_comm_size( ct, 4 );
+
+    scorep_mpi_comm_definition_payload payload;
+    MPI_Comm                           intercomm = create_intercomm( &payload );
 
+    /* Every rank exchanges its block with the two ranks of the other group */
+    ByteCounts expected = { .send = 2 * ( 100 * 4 ), .recv = 2 * ( 50 * 8 ) };
+
+    ByteCounts queried = { bogus64, bogus64 };
+    scorep_mpi_coll_bytes_allgather( 100, Int32x1,
+                                     50, Int32x2,
+                                     0, intercomm, NULL,
+                                     &queried.send, &queried.recv );
+    MPI_Comm_free( &intercomm );
+
+    ByteCounts bytes = { bogus64, bogus64 };
+    scorep_mpi_coll_bytes_allgather( 100, Int32x1,
+                                     50, Int32x2,
+                                     0, MPI_COMM_NULL, &payload,
+                                     &bytes.send, &bytes.recv );
 
     validate_byte_counts( ct, bytes, expected );
+    CuAssertIntEqualsMsg( ct, "Sent bytes without payload", expected.send, queried.send );
+    CuAssertIntEqualsMsg( ct, "Received bytes without payload", expected.recv, queried.recv );
 }
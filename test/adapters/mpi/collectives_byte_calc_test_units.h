@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2022,
+ * Copyright (c) 2022, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -80,5 +80,14 @@ test_scan( CuTest* ct );
 void
 test_exscan( CuTest* ct );
 
+void
+test_alltoallv_inplace_payload( CuTest* ct );
+
+void
+test_gather_intercomm( CuTest* ct );
+
+void
+test_allgather_intercomm( CuTest* ct );
+
 
 #endif /* COLLECTIVES_BYTE_CALC_TEST_UNITS_H */
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2023,
+ * Copyright (c) 2023, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -43,6 +43,8 @@ main( int argc, char** argv )
         SUITE_ADD_TEST_NAME( suite_cart, test_cart_nb_alltoallw, "Alltoallw" );
         SUITE_ADD_TEST_NAME( suite_cart, test_cart_nb_allgather, "Allgather" );
         SUITE_ADD_TEST_NAME( suite_cart, test_cart_nb_allgatherv, "Allgatherv" );
+        SUITE_ADD_TEST_NAME( suite_cart, test_cart_nb_alltoall_payload, "Alltoall with payload" );
+        SUITE_ADD_TEST_NAME( suite_cart, test_cart_nb_alltoallv_payload, "Alltoallv with payload" );
 
         CuSuiteRun( suite_cart );
         failCount += finalize_suite( suite_cart );
@@ -80,6 +82,7 @@ main( int argc, char** argv )
         SUITE_ADD_TEST_NAME( suite_dist_graph, test_dist_graph_nb_alltoallw, "Alltoallw" );
         SUITE_ADD_TEST_NAME( suite_dist_graph, test_dist_graph_nb_allgather, "Allgather" );
         SUITE_ADD_TEST_NAME( suite_dist_graph, test_dist_graph_nb_allgatherv, "Allgatherv" );
+        SUITE_ADD_TEST_NAME( suite_dist_graph, test_dist_graph_nb_alltoall_payload, "Alltoall with payload" );
 
         CuSuiteRun(  suite_dist_graph );
         failCount += finalize_suite( suite_dist_graph );
@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2023,
+ * Copyright (c) 2023, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -14,6 +14,8 @@
 #include "neighborhood_collectives_byte_calc_test.h"
 #include <scorep_mpi_coll.h>
 
+#include <stdlib.h>
+
 
 /* -----------------------------------------------------------------------------
  * Cartesian topology
@@ -49,7 +51,7 @@ test_cart_nb_alltoall( CuTest* ct )
             recvtype  = Int32x2;
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -99,7 +101,7 @@ test_cart_nb_alltoallv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 1200, .recv = 1200 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -162,7 +164,7 @@ test_cart_nb_alltoallw( CuTest* ct )
             expected        = ( ByteCounts ){.send = 1200, .recv = 1200 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -198,7 +200,7 @@ test_cart_nb_allgather( CuTest* ct )
             recvtype  = Int32x2;
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -241,10 +243,93 @@ test_cart_nb_allgatherv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 3 * 800, .recv = 2 * 800 + 1 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
+    validate_byte_counts( ct, comm, bytes, expected );
+}
+
+/*
+ * Definition payload of testCommCart as created by the communicator
+ * management. Dimension 0 is periodic. In dimension 1, the ranks 0 and 2
+ * have no negative and the ranks 1 and 3 no positive neighbor.
+ */
+static scorep_mpi_comm_definition_payload*
+new_cart_payload( int rank )
+{
+    scorep_mpi_comm_definition_payload* payload = calloc( 1, sizeof( *payload ) + 4 * sizeof( int ) );
+    payload->comm_size  = 4;
+    payload->local_rank = rank;
+    payload->topology   = MPI_CART;
+    payload->indegree   = 4;
+    payload->outdegree  = 4;
+
+    payload->cart_neighbors[ payload->num_cart_neighbors++ ] = 0;
+    payload->cart_neighbors[ payload->num_cart_neighbors++ ] = 1;
+    payload->cart_neighbors[ payload->num_cart_neighbors++ ] = ( rank % 2 ) ? 2 : 3;
+    return payload;
+}
+
+
+/*
+ * With a payload, the byte calculations must not query the communicator,
+ * thus MPI_COMM_NULL is passed.
+ */
+void
+test_cart_nb_alltoall_payload( CuTest* ct )
+{
+    MPI_Comm   comm     = testCommCart;
+    ByteCounts bytes    = { bogus64, bogus64 };
+    ByteCounts expected = { 3 * 100 * 4, 3 * 100 * 4 };
+
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    scorep_mpi_comm_definition_payload* payload = new_cart_payload( rank );
+
+    /* PROC_NULL neighbors are part of the degrees, but exchange no data */
+    int indegree  = bogus32;
+    int outdegree = bogus32;
+    scorep_mpi_topo_num_neighbors( MPI_COMM_NULL, payload, &indegree, &outdegree );
+    CuAssertIntEquals( ct, 4, indegree );
+    CuAssertIntEquals( ct, 4, outdegree );
+
+    scorep_mpi_coll_bytes_neighbor_alltoall( 100, Int32x1, 50, Int32x2, MPI_COMM_NULL, payload, &bytes.send, &bytes.recv );
+    free( payload );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
+
+void
+test_cart_nb_alltoallv_payload( CuTest* ct )
+{
+    MPI_Comm   comm     = testCommCart;
+    ByteCounts bytes    = { bogus64, bogus64 };
+    ByteCounts expected = { bogus64, bogus64 };
+
+    int sendcounts[ 4 ] = { 100, 100, 200, 200 };
+    int recvcounts[ 4 ] = { 50, 50, 100, 100 };
+
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    scorep_mpi_comm_definition_payload* payload = new_cart_payload( rank );
+
+    /* The counts of the PROC_NULL neighbors are ignored */
+    if ( rank % 2 )
+    {
+        sendcounts[ 3 ] += bogus32;
+        recvcounts[ 3 ] += bogus32;
+    }
+    else
+    {
+        sendcounts[ 2 ] += bogus32;
+        recvcounts[ 2 ] += bogus32;
+    }
+    expected = ( ByteCounts ){.send = 400 * 4, .recv = 200 * 8 };
+
+    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, Int32x1, recvcounts, Int32x2, MPI_COMM_NULL, payload, &bytes.send, &bytes.recv );
+    free( payload );
+    validate_byte_counts( ct, comm, bytes, expected );
+}
+
+
 /* -----------------------------------------------------------------------------
  * Graph topology
  * -------------------------------------------------------------------------- */
@@ -293,7 +378,7 @@ test_graph_nb_alltoall( CuTest* ct )
             expected  = ( ByteCounts ){.send = 2 * 400, .recv = 2 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -347,7 +432,7 @@ test_graph_nb_alltoallv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 2 * 400, .recv = 2 * 800 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -406,7 +491,7 @@ test_graph_nb_alltoallw( CuTest* ct )
             expected        = ( ByteCounts ){.send = 2 * 400, .recv = 2 * 800 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -455,7 +540,7 @@ test_graph_nb_allgather( CuTest* ct )
             expected  = ( ByteCounts ){.send = 2 * 400, .recv = 2 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -507,7 +592,7 @@ test_graph_nb_allgatherv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 2 * 400, .recv = 2 * 800 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -559,7 +644,7 @@ test_dist_graph_nb_alltoall( CuTest* ct )
             expected  = ( ByteCounts ){.send = 1 * 400, .recv = 1 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoall( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -603,7 +688,7 @@ test_dist_graph_nb_alltoallv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 1 * 2000, .recv = 1 * 1200 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallv( sendcounts, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -648,7 +733,7 @@ test_dist_graph_nb_alltoallw( CuTest* ct )
             expected        = ( ByteCounts ){.send = 1 * 2000, .recv = 1 * 1200 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_alltoallw( sendcounts, sendtypes, recvcounts, recvtypes, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -698,7 +783,7 @@ test_dist_graph_nb_allgather( CuTest* ct )
             expected  = ( ByteCounts ){.send = 1 * 400, .recv = 1 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgather( sendcount, sendtype, recvcount, recvtype, comm, NULL, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
 
@@ -750,6 +835,33 @@ test_dist_graph_nb_allgatherv( CuTest* ct )
             expected        = ( ByteCounts ){.send = 1 * 1200, .recv = 1 * 400 };
             break;
     }
-    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, &bytes.send, &bytes.recv );
+    scorep_mpi_coll_bytes_neighbor_allgatherv( sendcount, sendtype, recvcounts, recvtype, comm, NULL, &bytes.send, &bytes.recv );
+    validate_byte_counts( ct, comm, bytes, expected );
+}
+
+
+void
+test_dist_graph_nb_alltoall_payload( CuTest* ct )
+{
+    MPI_Comm   comm     = testCommDistGraph;
+    ByteCounts bytes    = { bogus64, bogus64 };
+    ByteCounts expected = { bogus64, bogus64 };
+
+    /* Degrees of the adjacency matrix in create_comms */
+    const int indegrees[ 4 ]  = { 1, 2, 1, 1 };
+    const int outdegrees[ 4 ] = { 3, 0, 1, 1 };
+
+    int rank;
+    MPI_Comm_rank( comm, &rank );
+    scorep_mpi_comm_definition_payload payload = {
+        .comm_size  = 4,
+        .local_rank = rank,
+        .topology   = MPI_DIST_GRAPH,
+        .indegree   = indegrees[ rank ],
+        .outdegree  = outdegrees[ rank ]
+    };
+    expected = ( ByteCounts ){.send = outdegrees[ rank ] * 400, .recv = indegrees[ rank ] * 400 };
+
+    scorep_mpi_coll_bytes_neighbor_alltoall( 100, Int32x1, 10, Int32x10, MPI_COMM_NULL, &payload, &bytes.send, &bytes.recv );
     validate_byte_counts( ct, comm, bytes, expected );
 }
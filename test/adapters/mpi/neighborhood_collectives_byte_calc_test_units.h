@@ -1,7 +1,7 @@
 /*
  * This file is part of the Score-P software (http://www.score-p.org)
  *
- * Copyright (c) 2023,
+ * Copyright (c) 2023, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * This software may be modified and distributed under the terms of
@@ -32,6 +32,12 @@ test_cart_nb_allgather( CuTest* ct );
 void
 test_cart_nb_allgatherv( CuTest* ct );
 
+void
+test_cart_nb_alltoall_payload( CuTest* ct );
+
+void
+test_cart_nb_alltoallv_payload( CuTest* ct );
+
 
 /* -----------------------------------------------------------------------------
  * Graph topology
@@ -70,5 +76,8 @@ test_dist_graph_nb_allgather( CuTest* ct );
 void
 test_dist_graph_nb_allgatherv( CuTest* ct );
 
+void
+test_dist_graph_nb_alltoall_payload( CuTest* ct );
+
 
 #endif /* NEIGHBORHOOD_COLLECTIVES_BYTE_CALC_TEST_UNITS_H */
@@ -0,0 +1,48 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ */
+
+/*
+ * The inner calls of recurse() get throttled while the outer call is still
+ * active. The exit of the outer call must still be recorded, after callee().
+ */
+
+#define INNER_CALLS 100
+
+static volatile int sink;
+
+__attribute__( ( noinline ) ) void
+callee( void )
+{
+    sink++;
+}
+
+__attribute__( ( noinline ) ) void
+recurse( int depth )
+{
+    if ( depth == 0 )
+    {
+        sink++;
+        return;
+    }
+
+    for ( int i = 0; i < INNER_CALLS; i++ )
+    {
+        recurse( depth - 1 );
+    }
+    callee();
+}
+
+int
+main( void )
+{
+    recurse( 1 );
+    return 0;
+}
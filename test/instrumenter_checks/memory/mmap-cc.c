@@ -0,0 +1,48 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+#define _GNU_SOURCE
+
+#include <sys/mman.h>
+#include <string.h>
+
+#define ARRAY_SIZE ( 1024 * 1024 )
+
+int
+main( int ac, char* av[] )
+{
+    int  returnvalue = ARRAY_SIZE;
+    int* memory      = mmap( NULL, ARRAY_SIZE * sizeof( int ),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( memory == MAP_FAILED )
+    {
+        return 1;
+    }
+
+    memory = mremap( memory, ARRAY_SIZE * sizeof( int ),
+                     2 * ARRAY_SIZE * sizeof( int ), MREMAP_MAYMOVE );
+    if ( memory == MAP_FAILED )
+    {
+        return 1;
+    }
+    memset( memory, 1, ARRAY_SIZE * sizeof( int ) );
+
+    for ( int i = 0; i < ARRAY_SIZE; ++i )
+    {
+        returnvalue -= memory[ i ];
+    }
+
+    munmap( memory, 2 * ARRAY_SIZE * sizeof( int ) );
+
+    return returnvalue;
+}
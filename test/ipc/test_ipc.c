@@ -4,6 +4,9 @@
  * Copyright (c) 2012-2014,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license.  See the COPYING file in the package base
  * directory for details.
@@ -56,6 +59,9 @@ test_ipc( int           my_rank,
     SUITE_ADD_TEST_NAME( suite,
                          test_ipc_send_recive_all_to_all,
                          "Send and Recive: All to All" );
+    SUITE_ADD_TEST_NAME( suite,
+                         test_ipc_send_recive_pipelined,
+                         "Send and Recive: Pipelined" );
 
     SUITE_ADD_TEST_NAME( suite,
                          test_ipc_broadcast,
@@ -4,6 +4,9 @@
  * Copyright (c) 2012-2014,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license.  See the COPYING file in the package base
  * directory for details.
@@ -260,3 +263,70 @@ test_ipc_send_recive_all_to_all( CuTest* tc )
     free( recived_data );
     free( expected_data );
 } /* test_ipc_send_recive_all_to_all */
+
+
+/*
+ * Messages larger than the staging area of a point-to-point channel need
+ * several chunks, the last one only partially filled. Each pair of ranks
+ * exchanges two such messages back to back in both directions, so the chunk
+ * counts keep running across messages and directions.
+ */
+void
+test_ipc_send_recive_pipelined( CuTest* tc )
+{
+    int my_rank            = SCOREP_Ipc_GetRank();
+    int number_of_ranks    = SCOREP_Ipc_GetSize();
+    int number_of_elements = 45000;
+    int number_of_messages = 2;
+
+    int rank_is_even = !( my_rank % 2 );
+    int peer         = rank_is_even ? my_rank + 1 : my_rank - 1;
+    if ( peer >= number_of_ranks )
+    {
+        return;
+    }
+
+    int* data = calloc( number_of_elements, sizeof( int ) );
+    CuAssertPtrNotNull( tc, data );
+
+    for ( int round = 0; round < 2; ++round )
+    {
+        int sender = rank_is_even == ( round == 0 );
+        for ( int message = 0; message < number_of_messages; ++message )
+        {
+            int return_value;
+            if ( sender )
+            {
+                for ( int i = 0; i < number_of_elements; ++i )
+                {
+                    data[ i ] = i + message * number_of_elements + my_rank;
+                }
+                return_value = SCOREP_Ipc_Send( data,
+                                                number_of_elements,
+                                                SCOREP_IPC_INT,
+                                                peer );
+            }
+            else
+            {
+                memset( data, 0, number_of_elements * sizeof( int ) );
+                return_value = SCOREP_Ipc_Recv( data,
+                                                number_of_elements,
+                                                SCOREP_IPC_INT,
+                                                peer );
+            }
+            CuAssertIntEqualsMsg( tc, "return value", 0, return_value );
+
+            if ( !sender )
+            {
+                int mismatches = 0;
+                for ( int i = 0; i < number_of_elements; ++i )
+                {
+                    mismatches += data[ i ] != i + message * number_of_elements + peer;
+                }
+                CuAssertIntEqualsMsg( tc, "mismatching elements", 0, mismatches );
+            }
+        }
+    }
+
+    free( data );
+} /* test_ipc_send_recive_pipelined */
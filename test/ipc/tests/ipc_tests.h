@@ -4,6 +4,9 @@
  * Copyright (c) 2012-2014,
  * Technische Universitaet Dresden, Germany
  *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
  * This software may be modified and distributed under the terms of
  * a BSD-style license.  See the COPYING file in the package base
  * directory for details.
@@ -33,6 +36,9 @@ test_ipc_send_recive_one_to_all( CuTest* tc );
 void
 test_ipc_send_recive_all_to_all( CuTest* tc );
 
+void
+test_ipc_send_recive_pipelined( CuTest* tc );
+
 void
 test_ipc_broadcast( CuTest* tc );
 
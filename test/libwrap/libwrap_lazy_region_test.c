@@ -0,0 +1,131 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks that registering library wrappers creates no definitions, and that
+ * the region of a wrapper is defined from copies of the registered strings
+ * on first use.
+ */
+
+#include <config.h>
+
+#include <CuTest.h>
+
+#include <SCOREP_Libwrap_Internal.h>
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Definitions.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_WRAPPERS 3
+
+static const SCOREP_LibwrapAttributes lw_attr =
+{
+    SCOREP_LIBWRAP_VERSION,
+    "lazy",
+    "Lazy"
+};
+
+static SCOREP_LibwrapHandle*         lw;
+static SCOREP_Libwrap_OriginalHandle originals[ N_WRAPPERS ];
+static SCOREP_RegionHandle           regions[ N_WRAPPERS ];
+
+static void
+wrapper( void )
+{
+}
+
+static void
+test_register_defines_nothing( CuTest* tc )
+{
+    uint32_t regions_before = scorep_local_definition_manager.region.counter;
+    uint32_t strings_before = scorep_local_definition_manager.string.counter;
+
+    SCOREP_Libwrap_Create( &lw, &lw_attr );
+    CuAssertPtrNotNull( tc, lw );
+
+    /* The names are only valid during the registration */
+    char name[ 32 ];
+    char file[ 32 ];
+    for ( int i = 0; i < N_WRAPPERS; i++ )
+    {
+        snprintf( name, sizeof( name ), "lazy_function_%d", i );
+        snprintf( file, sizeof( file ), "lazy_%d.h", i );
+        SCOREP_Libwrap_RegisterWrapper( lw,
+                                        name,
+                                        name,
+                                        file,
+                                        i + 1,
+                                        SCOREP_PARADIGM_LIBWRAP,
+                                        SCOREP_REGION_WRAPPER,
+                                        ( void* )wrapper,
+                                        &originals[ i ],
+                                        &regions[ i ] );
+        CuAssertTrue( tc, regions[ i ] == SCOREP_INVALID_REGION );
+    }
+    memset( name, 0, sizeof( name ) );
+    memset( file, 0, sizeof( file ) );
+
+    CuAssertIntEquals( tc, regions_before, scorep_local_definition_manager.region.counter );
+    CuAssertIntEquals( tc, strings_before, scorep_local_definition_manager.string.counter );
+}
+
+static void
+test_define_on_first_use( CuTest* tc )
+{
+    uint32_t regions_before = scorep_local_definition_manager.region.counter;
+
+    SCOREP_RegionHandle region = SCOREP_LIBWRAP_REGION( regions[ 1 ] );
+    CuAssertTrue( tc, region != SCOREP_INVALID_REGION );
+    CuAssertTrue( tc, regions[ 1 ] == region );
+    CuAssertStrEquals( tc, "lazy_function_1", SCOREP_RegionHandle_GetName( region ) );
+    CuAssertIntEquals( tc, regions_before + 1, scorep_local_definition_manager.region.counter );
+
+    /* Defined only once, and only the used one */
+    CuAssertTrue( tc, SCOREP_LIBWRAP_REGION( regions[ 1 ] ) == region );
+    CuAssertTrue( tc, regions[ 0 ] == SCOREP_INVALID_REGION );
+    CuAssertTrue( tc, regions[ 2 ] == SCOREP_INVALID_REGION );
+    CuAssertIntEquals( tc, regions_before + 1, scorep_local_definition_manager.region.counter );
+}
+
+int
+main()
+{
+    CuUseColors();
+    CuString* output = CuStringNew();
+    CuSuite*  suite  = CuSuiteNew( "Libwrap lazy regions" );
+
+    SUITE_ADD_TEST_NAME( suite, test_register_defines_nothing, "register defines nothing" );
+    SUITE_ADD_TEST_NAME( suite, test_define_on_first_use, "define on first use" );
+
+    SCOREP_InitMeasurement();
+
+    CuSuiteRun( suite );
+
+    SCOREP_FinalizeMeasurement();
+
+    CuSuiteSummary( suite, output );
+    int failCount = suite->failCount;
+    if ( failCount )
+    {
+        printf( "%s", output->buffer );
+    }
+
+    CuSuiteFree( suite );
+    CuStringFree( output );
+
+    return failCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks the location-local interning of string parameter values, and the
+ * folding of values beyond SCOREP_STRING_PARAMETER_MAX_VALUES into `<other>`.
+ */
+
+#include <config.h>
+
+#include <CuTest.h>
+
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Location.h>
+
+#include "scorep_parameter_string_cache.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* More than the initial number of buckets of the value table. */
+#define MAX_VALUES 1000
+
+
+static void
+test_interning( CuTest* tc )
+{
+    SCOREP_Location*       location  = SCOREP_Location_GetCurrentCPULocation();
+    SCOREP_ParameterHandle parameter =
+        SCOREP_Definitions_NewParameter( "interning", SCOREP_PARAMETER_STRING );
+
+    char buffer[ 16 ];
+    strcpy( buffer, "foo" );
+    SCOREP_StringHandle foo = scorep_parameter_string_cache_get( location, parameter, buffer );
+    CuAssertStrEquals( tc, "foo", SCOREP_StringHandle_Get( foo ) );
+
+    /* Repeated by pointer and by content. */
+    uint32_t strings = scorep_local_definition_manager.string.counter;
+    CuAssertTrue( tc, scorep_parameter_string_cache_get( location, parameter, buffer ) == foo );
+    CuAssertTrue( tc, scorep_parameter_string_cache_get( location, parameter, "foo" ) == foo );
+    CuAssertIntEquals( tc, strings, scorep_local_definition_manager.string.counter );
+
+    /* The same pointer with a new content is a new value. */
+    strcpy( buffer, "bar" );
+    SCOREP_StringHandle bar = scorep_parameter_string_cache_get( location, parameter, buffer );
+    CuAssertTrue( tc, bar != foo );
+    CuAssertStrEquals( tc, "bar", SCOREP_StringHandle_Get( bar ) );
+    strcpy( buffer, "foo" );
+    CuAssertTrue( tc, scorep_parameter_string_cache_get( location, parameter, buffer ) == foo );
+}
+
+
+static void
+test_other( CuTest* tc )
+{
+    SCOREP_Location*       location = SCOREP_Location_GetCurrentCPULocation();
+    SCOREP_ParameterHandle limited  =
+        SCOREP_Definitions_NewParameter( "limited", SCOREP_PARAMETER_STRING );
+    SCOREP_ParameterHandle unlimited =
+        SCOREP_Definitions_NewParameter( "unlimited", SCOREP_PARAMETER_STRING );
+
+    static SCOREP_StringHandle values[ MAX_VALUES ];
+    char                       buffer[ 32 ];
+    for ( int i = 0; i < MAX_VALUES; i++ )
+    {
+        snprintf( buffer, sizeof( buffer ), "value %d", i );
+        values[ i ] = scorep_parameter_string_cache_get( location, limited, buffer );
+        CuAssertStrEquals( tc, buffer, SCOREP_StringHandle_Get( values[ i ] ) );
+    }
+
+    /* The known values are still resolved after the value table grew. */
+    for ( int i = 0; i < MAX_VALUES; i++ )
+    {
+        snprintf( buffer, sizeof( buffer ), "value %d", i );
+        CuAssertTrue( tc, scorep_parameter_string_cache_get( location, limited, buffer ) == values[ i ] );
+    }
+
+    /* All new values beyond the limit are folded into `<other>`. */
+    SCOREP_StringHandle other =
+        scorep_parameter_string_cache_get( location, limited, "new value" );
+    CuAssertStrEquals( tc, "<other>", SCOREP_StringHandle_Get( other ) );
+    CuAssertTrue( tc, scorep_parameter_string_cache_get( location, limited, "another new value" ) == other );
+    CuAssertTrue( tc, scorep_parameter_string_cache_get( location, limited, "value 0" ) == values[ 0 ] );
+
+    /* The limit is per parameter. */
+    SCOREP_StringHandle value =
+        scorep_parameter_string_cache_get( location, unlimited, "new value" );
+    CuAssertTrue( tc, value != other );
+    CuAssertStrEquals( tc, "new value", SCOREP_StringHandle_Get( value ) );
+}
+
+
+int
+main( void )
+{
+    char max_values[ 16 ];
+    snprintf( max_values, sizeof( max_values ), "%d", MAX_VALUES );
+    setenv( "SCOREP_STRING_PARAMETER_MAX_VALUES", max_values, 1 );
+
+    CuUseColors();
+    CuString* output = CuStringNew();
+    CuSuite*  suite  = CuSuiteNew( "Parameter string cache" );
+
+    SUITE_ADD_TEST_NAME( suite, test_interning, "interning" );
+    SUITE_ADD_TEST_NAME( suite, test_other, "folding into <other>" );
+
+    SCOREP_InitMeasurement();
+
+    CuSuiteRun( suite );
+
+    SCOREP_FinalizeMeasurement();
+
+    CuSuiteSummary( suite, output );
+    int failCount = suite->failCount;
+    if ( failCount )
+    {
+        printf( "%s", output->buffer );
+    }
+
+    CuSuiteFree( suite );
+    CuStringFree( output );
+
+    return failCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
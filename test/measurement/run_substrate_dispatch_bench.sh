@@ -0,0 +1,42 @@
+#!/bin/bash
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       run_substrate_dispatch_bench.sh
+
+RESULT_DIR=scorep-substrate-dispatch-bench-dir
+ITERATIONS=${SCOREP_BENCH_ITERATIONS:-1000000}
+
+run_bench()
+{
+    rm -rf $RESULT_DIR
+    env SCOREP_EXPERIMENT_DIRECTORY=$RESULT_DIR \
+        SCOREP_TOTAL_MEMORY=64M \
+        "$@" \
+        ./substrate_dispatch_bench $ITERATIONS || exit 1
+}
+
+for config in "false false" "true false" "false true" "true true"; do
+    set -- $config
+    echo "Profiling: $1, tracing: $2"
+    run_bench SCOREP_ENABLE_PROFILING=$1 SCOREP_ENABLE_TRACING=$2
+    echo "Profiling: $1, tracing: $2, metric: ru_utime"
+    run_bench SCOREP_ENABLE_PROFILING=$1 SCOREP_ENABLE_TRACING=$2 \
+        SCOREP_METRIC_RUSAGE=ru_utime
+done
+
+echo "Profiling: true, tracing: false, overhead estimation"
+run_bench SCOREP_ENABLE_PROFILING=true SCOREP_ENABLE_TRACING=false \
+    SCOREP_PROFILING_ESTIMATE_OVERHEAD=true
+
+rm -rf $RESULT_DIR
+exit 0
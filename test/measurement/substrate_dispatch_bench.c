@@ -0,0 +1,163 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Microbenchmark for the substrate dispatch of events. Reports the mean cost
+ * of an enter/exit pair, a parameter without its enclosing enter/exit pair,
+ * a user counter, and a wrapped enter/exit pair as done by the library
+ * wrappers, for the substrate configuration selected via
+ * SCOREP_ENABLE_PROFILING, SCOREP_ENABLE_TRACING, and the metric variables.
+ * See run_substrate_dispatch_bench.sh.
+ *
+ */
+
+#include <config.h>
+
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Events.h>
+#include <SCOREP_InMeasurement.h>
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DEFAULT_ITERATIONS 1000000
+
+static double
+get_seconds( void )
+{
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return ( double )ts.tv_sec + ( double )ts.tv_nsec * 1e-9;
+}
+
+/* Prints and returns the mean cost in ns, less the given cost of the
+ * surrounding operations. */
+static double
+report( const char* what,
+        long        iterations,
+        double      start,
+        double      subtract )
+{
+    double elapsed = get_seconds() - start;
+    double cost    = elapsed * 1e9 / ( double )iterations - subtract;
+    printf( "%-22s %.1f ns\n", what, cost );
+    return cost;
+}
+
+int
+main( int argc, char** argv )
+{
+    long iterations = DEFAULT_ITERATIONS;
+    if ( argc > 1 )
+    {
+        iterations = strtol( argv[ 1 ], NULL, 10 );
+        if ( iterations <= 0 )
+        {
+            fprintf( stderr, "Invalid number of iterations: %s\n", argv[ 1 ] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    SCOREP_InitMeasurement();
+
+    SCOREP_RegionHandle region = SCOREP_Definitions_NewRegion( "bench",
+                                                               "bench",
+                                                               SCOREP_INVALID_SOURCE_FILE,
+                                                               SCOREP_INVALID_LINE_NO,
+                                                               SCOREP_INVALID_LINE_NO,
+                                                               SCOREP_PARADIGM_USER,
+                                                               SCOREP_REGION_FUNCTION );
+    SCOREP_RegionHandle wrapped_region = SCOREP_Definitions_NewRegion( "bench_wrapped",
+                                                                       "bench_wrapped",
+                                                                       SCOREP_INVALID_SOURCE_FILE,
+                                                                       SCOREP_INVALID_LINE_NO,
+                                                                       SCOREP_INVALID_LINE_NO,
+                                                                       SCOREP_PARADIGM_LIBWRAP,
+                                                                       SCOREP_REGION_WRAPPER );
+    SCOREP_ParameterHandle parameter = SCOREP_Definitions_NewParameter( "bench",
+                                                                        SCOREP_PARAMETER_INT64 );
+    SCOREP_MetricHandle metric = SCOREP_Definitions_NewMetric( "bench",
+                                                               "",
+                                                               SCOREP_METRIC_SOURCE_TYPE_USER,
+                                                               SCOREP_METRIC_MODE_ABSOLUTE_POINT,
+                                                               SCOREP_METRIC_VALUE_INT64,
+                                                               SCOREP_METRIC_BASE_DECIMAL,
+                                                               0,
+                                                               "",
+                                                               SCOREP_METRIC_PROFILING_TYPE_EXCLUSIVE,
+                                                               SCOREP_INVALID_METRIC );
+    SCOREP_SamplingSetHandle counter = SCOREP_Definitions_NewSamplingSet( 1, &metric,
+                                                                          SCOREP_METRIC_OCCURRENCE_ASYNCHRONOUS,
+                                                                          SCOREP_SAMPLING_SET_CPU );
+
+    /* Warm up, e.g., to create the call-paths in the profile. */
+    SCOREP_EnterRegion( region );
+    SCOREP_TriggerParameterInt64( parameter, 0 );
+    SCOREP_TriggerCounterInt64( counter, 0 );
+    SCOREP_ExitRegion( region );
+    SCOREP_EnterWrappedRegion( wrapped_region );
+    SCOREP_ExitRegion( wrapped_region );
+
+    printf( "Mean cost per operation of %ld iterations:\n", iterations );
+
+    double start = get_seconds();
+    for ( long i = 0; i < iterations; i++ )
+    {
+        SCOREP_EnterRegion( region );
+        SCOREP_ExitRegion( region );
+    }
+    double pair = report( "enter/exit pair", iterations, start, 0.0 );
+
+    /* The profile nests parameters like regions, each one is thus recorded
+     * in its own region, as in instrumented code. */
+    start = get_seconds();
+    for ( long i = 0; i < iterations; i++ )
+    {
+        SCOREP_EnterRegion( region );
+        SCOREP_TriggerParameterInt64( parameter, i & 7 );
+        SCOREP_ExitRegion( region );
+    }
+    report( "parameter", iterations, start, pair );
+
+    /* Counters are recorded inside a region, as in instrumented code. */
+    SCOREP_EnterRegion( region );
+
+    start = get_seconds();
+    for ( long i = 0; i < iterations; i++ )
+    {
+        SCOREP_TriggerCounterInt64( counter, i );
+    }
+    report( "counter", iterations, start, 0.0 );
+
+    SCOREP_ExitRegion( region );
+
+    start = get_seconds();
+    for ( long i = 0; i < iterations; i++ )
+    {
+        SCOREP_IN_MEASUREMENT_INCREMENT();
+        SCOREP_EnterWrappedRegion( wrapped_region );
+        SCOREP_ENTER_WRAPPED_REGION();
+        SCOREP_EXIT_WRAPPED_REGION();
+        SCOREP_ExitRegion( wrapped_region );
+        SCOREP_IN_MEASUREMENT_DECREMENT();
+    }
+    report( "wrapped enter/exit pair", iterations, start, 0.0 );
+
+    SCOREP_FinalizeMeasurement();
+
+    return EXIT_SUCCESS;
+}
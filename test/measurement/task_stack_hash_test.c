@@ -0,0 +1,188 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks that the region stack hash maintained by SCOREP_Task_Enter and
+ * SCOREP_Task_Exit equals the hash recomputed from the whole stack, across
+ * several stack frames and with filtered regions on the stack.
+ */
+
+#include <config.h>
+
+#include <CuTest.h>
+
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Location.h>
+#include <SCOREP_Task.h>
+#include <SCOREP_Types.h>
+
+#include <jenkins_hash.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* More than three stack frames of a task */
+#define MAX_DEPTH 100
+
+static SCOREP_RegionHandle regions[ MAX_DEPTH ];
+static SCOREP_RegionHandle stack[ MAX_DEPTH ];
+static int                 depth;
+static uint32_t            base_hash;
+
+
+/* Hash of the bottom-up aggregation of all regions on the stack, ignoring
+ * filtered ones. */
+static uint32_t
+recompute_hash( void )
+{
+    uint32_t hash = base_hash;
+    for ( int i = 0; i < depth; i++ )
+    {
+        if ( stack[ i ] != SCOREP_FILTERED_REGION )
+        {
+            uint32_t region_hash = SCOREP_LOCAL_HANDLE_DEREF( stack[ i ], Region )->hash_value;
+            hash = jenkins_hash( &region_hash, sizeof( region_hash ), hash );
+        }
+    }
+    return hash;
+}
+
+
+static void
+push( CuTest*             tc,
+      SCOREP_RegionHandle region )
+{
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    SCOREP_Task_Enter( location, region );
+    stack[ depth++ ] = region;
+
+    char message[ 64 ];
+    snprintf( message, sizeof( message ), "hash after enter at depth %d", depth );
+    CuAssertMsg( tc, message,
+                 SCOREP_Task_GetRegionStackHash( SCOREP_Task_GetCurrentTask( location ) )
+                 == recompute_hash() );
+}
+
+
+static void
+pop( CuTest* tc )
+{
+    SCOREP_Location* location = SCOREP_Location_GetCurrentCPULocation();
+    SCOREP_Task_Exit( location );
+    depth--;
+
+    char message[ 64 ];
+    snprintf( message, sizeof( message ), "hash after exit at depth %d", depth );
+    CuAssertMsg( tc, message,
+                 SCOREP_Task_GetRegionStackHash( SCOREP_Task_GetCurrentTask( location ) )
+                 == recompute_hash() );
+}
+
+
+/* Every seventh region is filtered. */
+static SCOREP_RegionHandle
+region_at( int i )
+{
+    return i % 7 == 3 ? SCOREP_FILTERED_REGION : regions[ i ];
+}
+
+
+static void
+test_stack_hash( CuTest* tc )
+{
+    SCOREP_Location*  location = SCOREP_Location_GetCurrentCPULocation();
+    SCOREP_TaskHandle task     = SCOREP_Task_GetCurrentTask( location );
+
+    /* A filtered region does not change the hash, thus it exposes the hash
+     * the test stack starts from even for an empty stack. */
+    SCOREP_Task_Enter( location, SCOREP_FILTERED_REGION );
+    base_hash = SCOREP_Task_GetRegionStackHash( task );
+
+    for ( int i = 0; i < MAX_DEPTH; i++ )
+    {
+        push( tc, region_at( i ) );
+    }
+
+    /* Back into the first frame, then again over the frame boundaries. */
+    while ( depth > 10 )
+    {
+        pop( tc );
+    }
+    for ( int i = depth; i < MAX_DEPTH; i++ )
+    {
+        push( tc, regions[ MAX_DEPTH - 1 - i ] );
+    }
+
+    /* A filtered region on top */
+    while ( depth > 45 )
+    {
+        pop( tc );
+    }
+    uint32_t hash = SCOREP_Task_GetRegionStackHash( task );
+    push( tc, SCOREP_FILTERED_REGION );
+    CuAssertTrue( tc, SCOREP_Task_GetRegionStackHash( task ) == hash );
+    push( tc, SCOREP_FILTERED_REGION );
+    CuAssertTrue( tc, SCOREP_Task_GetRegionStackHash( task ) == hash );
+
+    while ( depth > 0 )
+    {
+        pop( tc );
+    }
+    CuAssertTrue( tc, SCOREP_Task_GetRegionStackHash( task ) == base_hash );
+    SCOREP_Task_Exit( location );
+}
+
+
+int
+main( void )
+{
+    CuUseColors();
+    CuString* output = CuStringNew();
+    CuSuite*  suite  = CuSuiteNew( "Task region stack hash" );
+
+    SUITE_ADD_TEST_NAME( suite, test_stack_hash, "incremental equals recomputed hash" );
+
+    SCOREP_InitMeasurement();
+
+    for ( int i = 0; i < MAX_DEPTH; i++ )
+    {
+        char name[ 32 ];
+        snprintf( name, sizeof( name ), "region_%d", i );
+        regions[ i ] = SCOREP_Definitions_NewRegion( name,
+                                                     NULL,
+                                                     SCOREP_INVALID_SOURCE_FILE,
+                                                     SCOREP_INVALID_LINE_NO,
+                                                     SCOREP_INVALID_LINE_NO,
+                                                     SCOREP_PARADIGM_USER,
+                                                     SCOREP_REGION_FUNCTION );
+    }
+
+    CuSuiteRun( suite );
+
+    SCOREP_FinalizeMeasurement();
+
+    CuSuiteSummary( suite, output );
+    int failCount = suite->failCount;
+    if ( failCount )
+    {
+        printf( "%s", output->buffer );
+    }
+
+    CuSuiteFree( suite );
+    CuStringFree( output );
+
+    return failCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+#!/bin/sh
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       check_tau_snapshot_files_test.sh
+
+## Checks the TAU snapshot profile written by run_tau_snapshot_files_test.sh.
+## Started by the MPI launcher once per rank like all MPI tests, each instance
+## only reads the profile, thus they do the same checks.
+
+DIR=scorep_tau_snapshot_files_test_dir/tau
+INDEX=$DIR/snapshot.index
+FILES=3
+
+fail()
+{
+    echo "ERROR: $*" >&2
+    exit 1
+}
+
+test -f $INDEX || fail "$INDEX missing"
+
+## One line per rank, the number of files is capped by the number of processes
+processes=`grep -v '^#' $INDEX | wc -l`
+test $processes -gt 0 || fail "empty index"
+test $FILES -le $processes || FILES=$processes
+
+## The snapshots of all ranks are in the aggregated files only
+for file in $DIR/snapshot.*.0.0; do
+    test -e $file && fail "unexpected per-process file $file"
+done
+
+## Ranks in order, each in file rank * FILES / processes, at the end of the
+## snapshots of the previous ranks in the same file. Prints the size each file
+## needs to have.
+sizes=`awk -v P=$processes -v N=$FILES '
+    /^#/ { next }
+    {
+        file = "snapshot.aggregated." int( rank * N / P )
+        if ( $1 != rank )                  error = "rank " $1 " in line of rank " rank
+        else if ( $2 != file )             error = "rank " rank " in " $2 " instead of " file
+        else if ( $3 != size[ file ] + 0 ) error = "rank " rank " at offset " $3 " instead of " size[ file ] + 0
+        else if ( $4 <= 0 )                error = "rank " rank " with length " $4
+        if ( error ) { print error; exit 1 }
+        size[ file ] += $4
+        rank++
+    }
+    END { if ( !error ) for ( file in size ) print file, size[ file ] }' $INDEX` || fail "$sizes"
+
+test `echo "$sizes" | wc -l` -eq $FILES || fail "snapshots not in $FILES files"
+echo "$sizes" | while read file size; do
+    test -f $DIR/$file || fail "$file missing"
+    test `wc -c < $DIR/$file` -eq $size || fail "size of $file differs from the sum of its snapshots"
+done || exit 1
+
+## Each slice is exactly the snapshot of its rank
+grep -v '^#' $INDEX | while read rank file offset length; do
+    slice=`tail -c +\`expr $offset + 1\` $DIR/$file | head -c $length`
+    test "`echo "$slice" | head -n 1`" = "<profile_xml>" \
+        || fail "snapshot of rank $rank does not start with <profile_xml>"
+    test "`echo "$slice" | tail -n 1`" = "</profile_xml>" \
+        || fail "snapshot of rank $rank does not end with </profile_xml>"
+    test `echo "$slice" | grep -c '<profile_xml>'` -eq 1 \
+        || fail "slice of rank $rank contains several snapshots"
+    echo "$slice" | grep -q "<thread id=\"$rank\\.0\\.0\\.0\" node=\"$rank\"" \
+        || fail "slice of rank $rank contains the snapshot of another rank"
+done || exit 1
+
+exit 0
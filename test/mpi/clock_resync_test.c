@@ -0,0 +1,86 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks that SCOREP_CLOCK_RESYNC_INTERVAL adds clock offset definitions
+ * while the program runs. Calls barriers on MPI_COMM_WORLD for a few
+ * intervals and compares the number of clock offsets before and after.
+ * Needs to be run with SCOREP_CLOCK_RESYNC_INTERVAL=1, see
+ * run_clock_resync_test.sh.
+ *
+ */
+
+#include <config.h>
+
+#include <SCOREP_Definitions.h>
+
+#include <mpi.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Three seconds of barriers, i.e., about three resynchronization intervals. */
+#define N_BARRIERS    30
+#define BARRIER_DELAY 100000
+
+static void
+count_clock_offset( SCOREP_ClockOffset* clockOffset,
+                    void*               userData )
+{
+    ( *( int* )userData )++;
+}
+
+static int
+count_clock_offsets( void )
+{
+    int count = 0;
+    SCOREP_ForAllClockOffsets( count_clock_offset, &count );
+    return count;
+}
+
+int
+main( int    argc,
+      char** argv )
+{
+    int rank;
+
+    MPI_Init( &argc, &argv );
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+
+    int before = count_clock_offsets();
+    for ( int i = 0; i < N_BARRIERS; i++ )
+    {
+        usleep( BARRIER_DELAY );
+        MPI_Barrier( MPI_COMM_WORLD );
+    }
+    int after = count_clock_offsets();
+
+    int failed = after <= before;
+    if ( failed )
+    {
+        fprintf( stderr, "[%d] No clock offsets added during the run: %d before, %d after\n",
+                 rank, before, after );
+    }
+
+    int any_failed;
+    MPI_Allreduce( &failed, &any_failed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD );
+    if ( rank == 0 && !any_failed )
+    {
+        printf( "Clock offsets added during the run: %d\n", after - before );
+    }
+
+    MPI_Finalize();
+    return any_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Microbenchmark for the tracking of outstanding MPI RMA operations. Every
+ * rank puts to all ranks and completes the operations with a fence, with
+ * per-target flushes, and with request-based operations. Reports the mean
+ * time per operation of the slowest rank. See run_rma_request_bench.sh.
+ *
+ */
+
+#include <config.h>
+
+#include <mpi.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_ITERATIONS 1000
+#define DEFAULT_OPERATIONS 16
+
+static int rank;
+static int size;
+
+static void
+report( const char* what,
+        long        operations,
+        double      start )
+{
+    double elapsed = MPI_Wtime() - start;
+    double max_elapsed;
+    MPI_Reduce( &elapsed, &max_elapsed, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+    if ( rank == 0 )
+    {
+        printf( "%-22s %.1f ns\n", what, max_elapsed * 1e9 / ( double )operations );
+    }
+}
+
+int
+main( int argc, char** argv )
+{
+    MPI_Init( &argc, &argv );
+    MPI_Comm_rank( MPI_COMM_WORLD, &rank );
+    MPI_Comm_size( MPI_COMM_WORLD, &size );
+
+    long iterations = DEFAULT_ITERATIONS;
+    int  operations = DEFAULT_OPERATIONS;
+    if ( argc > 1 )
+    {
+        iterations = strtol( argv[ 1 ], NULL, 10 );
+    }
+    if ( argc > 2 )
+    {
+        operations = ( int )strtol( argv[ 2 ], NULL, 10 );
+    }
+    if ( iterations <= 0 || operations <= 0 )
+    {
+        if ( rank == 0 )
+        {
+            fprintf( stderr, "Usage: %s [iterations [operations per target]]\n", argv[ 0 ] );
+        }
+        MPI_Abort( MPI_COMM_WORLD, EXIT_FAILURE );
+    }
+
+    /* Each rank owns one slot per origin and operation. */
+    double* base;
+    MPI_Win window;
+    MPI_Alloc_mem( ( MPI_Aint )size * operations * sizeof( double ), MPI_INFO_NULL, &base );
+    MPI_Win_create( base, ( MPI_Aint )size * operations * sizeof( double ), sizeof( double ),
+                    MPI_INFO_NULL, MPI_COMM_WORLD, &window );
+
+    double value     = rank;
+    long   total_ops = iterations * size * operations;
+    double start;
+
+    /* Active target: all operations complete at the closing fence. */
+    MPI_Barrier( MPI_COMM_WORLD );
+    start = MPI_Wtime();
+    MPI_Win_fence( 0, window );
+    for ( long i = 0; i < iterations; i++ )
+    {
+        for ( int target = 0; target < size; target++ )
+        {
+            for ( int op = 0; op < operations; op++ )
+            {
+                MPI_Put( &value, 1, MPI_DOUBLE, target, rank * operations + op,
+                         1, MPI_DOUBLE, window );
+            }
+        }
+        MPI_Win_fence( 0, window );
+    }
+    report( "put/fence", total_ops, start );
+
+#if MPI_VERSION >= 3
+    /* Passive target: the operations of one target complete at its flush. */
+    MPI_Barrier( MPI_COMM_WORLD );
+    start = MPI_Wtime();
+    MPI_Win_lock_all( 0, window );
+    for ( long i = 0; i < iterations; i++ )
+    {
+        for ( int target = 0; target < size; target++ )
+        {
+            for ( int op = 0; op < operations; op++ )
+            {
+                MPI_Put( &value, 1, MPI_DOUBLE, target, rank * operations + op,
+                         1, MPI_DOUBLE, window );
+            }
+            MPI_Win_flush( target, window );
+        }
+    }
+    MPI_Win_unlock_all( window );
+    report( "put/flush", total_ops, start );
+
+    /* Request-based operations, each completed on its own. */
+    MPI_Request* requests = malloc( operations * sizeof( *requests ) );
+    MPI_Barrier( MPI_COMM_WORLD );
+    start = MPI_Wtime();
+    MPI_Win_lock_all( 0, window );
+    for ( long i = 0; i < iterations; i++ )
+    {
+        for ( int target = 0; target < size; target++ )
+        {
+            for ( int op = 0; op < operations; op++ )
+            {
+                MPI_Rput( &value, 1, MPI_DOUBLE, target, rank * operations + op,
+                          1, MPI_DOUBLE, window, &requests[ op ] );
+            }
+            MPI_Waitall( operations, requests, MPI_STATUSES_IGNORE );
+        }
+    }
+    MPI_Win_unlock_all( window );
+    report( "rput/waitall", total_ops, start );
+    free( requests );
+#endif
+
+    MPI_Win_free( &window );
+    MPI_Free_mem( base );
+
+    MPI_Finalize();
+    return EXIT_SUCCESS;
+}
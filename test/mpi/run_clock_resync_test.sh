@@ -0,0 +1,21 @@
+#!/bin/sh
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       run_clock_resync_test.sh
+
+## Started by the MPI launcher once per rank, sets the resynchronization
+## interval in seconds for clock_resync_test.
+
+SCOREP_CLOCK_RESYNC_INTERVAL=1
+export SCOREP_CLOCK_RESYNC_INTERVAL
+exec ./clock_resync_test
@@ -0,0 +1,36 @@
+#!/bin/bash
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       run_rma_request_bench.sh
+
+RESULT_DIR=scorep-rma-request-bench-dir
+ITERATIONS=${SCOREP_BENCH_ITERATIONS:-1000}
+MPIEXEC=${MPIEXEC:-mpiexec -np 4}
+
+run_bench()
+{
+    rm -rf $RESULT_DIR
+    env SCOREP_EXPERIMENT_DIRECTORY=$RESULT_DIR \
+        SCOREP_TOTAL_MEMORY=64M \
+        "$@" \
+        $MPIEXEC ./rma_request_bench $ITERATIONS || exit 1
+}
+
+for config in "false false" "true false" "false true"; do
+    set -- $config
+    echo "Profiling: $1, tracing: $2"
+    run_bench SCOREP_ENABLE_PROFILING=$1 SCOREP_ENABLE_TRACING=$2
+done
+
+rm -rf $RESULT_DIR
+exit 0
@@ -0,0 +1,27 @@
+#!/bin/sh
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       run_tau_snapshot_files_test.sh
+
+## Started by the MPI launcher once per rank, writes the TAU snapshot profile
+## of jacobi_mpi_c into three shared files. The result is checked by
+## check_tau_snapshot_files_test.sh.
+
+SCOREP_EXPERIMENT_DIRECTORY=scorep_tau_snapshot_files_test_dir
+SCOREP_ENABLE_PROFILING=true
+SCOREP_ENABLE_TRACING=false
+SCOREP_PROFILING_FORMAT=TAU_SNAPSHOT
+SCOREP_PROFILING_TAU_SNAPSHOT_FILES=3
+export SCOREP_EXPERIMENT_DIRECTORY SCOREP_ENABLE_PROFILING SCOREP_ENABLE_TRACING \
+    SCOREP_PROFILING_FORMAT SCOREP_PROFILING_TAU_SNAPSHOT_FILES
+exec ./jacobi_mpi_c
@@ -0,0 +1,153 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+
+
+/**
+ * @file       lock_stress.c
+ *
+ * Stresses the OPARI2 OpenMP lock management with many threads operating on
+ * many locks, including concurrent initialization and destruction of locks.
+ */
+
+
+#include <config.h>
+
+#include <omp.h>
+#include <opari2/pomp2_lib.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#define POMP_TPD_MANGLED F77_FUNC_( pomp_tpd, POMP_TPD )
+#define SCOREP_PRAGMA_STR_( str ) #str
+#define SCOREP_PRAGMA_STR( str ) SCOREP_PRAGMA_STR_( str )
+#define PRAGMA_OP( x ) _Pragma( x )
+#define SCOREP_PRAGMA( pragma ) PRAGMA_OP( SCOREP_PRAGMA_STR( pragma ) )
+#define SCOREP_PRAGMA_OMP( omp_pragma ) SCOREP_PRAGMA( omp omp_pragma )
+
+extern int64_t FORTRAN_ALIGNED POMP_TPD_MANGLED;
+SCOREP_PRAGMA_OMP( threadprivate( POMP_TPD_MANGLED ) )
+
+#define POMP_DLIST_00001 shared( pomp_region_1 )
+static POMP2_Region_handle pomp_region_1;
+
+#define pomp2_ctc "76*regionType=parallel*sscl=lock_stress.c:76:76*escl=lock_stress.c:135:135**"
+
+void
+POMP2_Init_reg_4k6lsdctlab37_1()
+{
+    POMP2_Assign_handle( &pomp_region_1, pomp2_ctc );
+}
+
+
+#define NUM_SHARED_LOCKS  4096
+#define NUM_PRIVATE_LOCKS 32
+#define NUM_ROUNDS        64
+#define NUM_ITERATIONS    20000
+
+static omp_lock_t      shared_locks[ NUM_SHARED_LOCKS ];
+static uint64_t        counters[ NUM_SHARED_LOCKS ];
+static omp_nest_lock_t nest_lock;
+static uint64_t        nest_counter;
+
+
+int
+main()
+{
+    for ( int i = 0; i < NUM_SHARED_LOCKS; i++ )
+    {
+        POMP2_Init_lock( &shared_locks[ i ] );
+    }
+    POMP2_Init_nest_lock( &nest_lock );
+
+    int               pomp_num_threads = omp_get_max_threads();
+    int               num_threads      = 0;
+    POMP2_Task_handle pomp2_old_task;
+    POMP2_Parallel_fork( &pomp_region_1, 1, pomp_num_threads, &pomp2_old_task,  pomp2_ctc );
+    SCOREP_PRAGMA_OMP( parallel POMP_DLIST_00001 firstprivate( pomp2_old_task ) num_threads( pomp_num_threads ) copyin( F77_FUNC_( pomp_tpd, POMP_TPD ) ) )
+    {
+        POMP2_Parallel_begin( &pomp_region_1 );
+
+        uint32_t tid = omp_get_thread_num();
+        if ( tid == 0 )
+        {
+            num_threads = omp_get_num_threads();
+        }
+
+        /* Locks initialized and destroyed concurrently to the lookups of
+         * the other threads. */
+        omp_lock_t private_locks[ NUM_PRIVATE_LOCKS ];
+        for ( int round = 0; round < NUM_ROUNDS; round++ )
+        {
+            for ( int i = 0; i < NUM_PRIVATE_LOCKS; i++ )
+            {
+                POMP2_Init_lock( &private_locks[ i ] );
+            }
+            for ( int i = 0; i < NUM_PRIVATE_LOCKS; i++ )
+            {
+                POMP2_Set_lock( &private_locks[ i ] );
+                POMP2_Unset_lock( &private_locks[ i ] );
+            }
+            for ( int i = 0; i < NUM_PRIVATE_LOCKS; i++ )
+            {
+                POMP2_Destroy_lock( &private_locks[ i ] );
+            }
+        }
+
+        uint32_t state = 2654435761u * ( tid + 1 );
+        for ( int i = 0; i < NUM_ITERATIONS; i++ )
+        {
+            state = state * 1664525u + 1013904223u;
+            uint32_t index = ( state >> 8 ) % NUM_SHARED_LOCKS;
+            if ( i % 16 == 0 )
+            {
+                while ( !POMP2_Test_lock( &shared_locks[ index ] ) )
+                {
+                }
+            }
+            else
+            {
+                POMP2_Set_lock( &shared_locks[ index ] );
+            }
+            counters[ index ]++;
+            POMP2_Unset_lock( &shared_locks[ index ] );
+
+            if ( i % 64 == 0 )
+            {
+                POMP2_Set_nest_lock( &nest_lock );
+                POMP2_Set_nest_lock( &nest_lock );
+                nest_counter++;
+                POMP2_Unset_nest_lock( &nest_lock );
+                POMP2_Unset_nest_lock( &nest_lock );
+            }
+        }
+
+        POMP2_Parallel_end( &pomp_region_1 );
+    }
+    POMP2_Parallel_join( &pomp_region_1, pomp2_old_task );
+
+    uint64_t sum = 0;
+    for ( int i = 0; i < NUM_SHARED_LOCKS; i++ )
+    {
+        sum += counters[ i ];
+        POMP2_Destroy_lock( &shared_locks[ i ] );
+    }
+    POMP2_Destroy_nest_lock( &nest_lock );
+
+    uint64_t expected      = ( uint64_t )num_threads * NUM_ITERATIONS;
+    uint64_t expected_nest = ( uint64_t )num_threads * ( ( NUM_ITERATIONS + 63 ) / 64 );
+    printf( "%d threads, %" PRIu64 " lock acquisitions (expected %" PRIu64 "), "
+            "%" PRIu64 " nested lock acquisitions (expected %" PRIu64 ")\n",
+            num_threads, sum, expected, nest_counter, expected_nest );
+
+    return ( sum == expected && nest_counter == expected_nest ) ? 0 : 1;
+}
@@ -0,0 +1,29 @@
+#!/bin/bash
+
+##
+## This file is part of the Score-P software (http://www.score-p.org)
+##
+## Copyright (c) 2026,
+## Forschungszentrum Juelich GmbH, Germany
+##
+## This software may be modified and distributed under the terms of
+## a BSD-style license. See the COPYING file in the package base
+## directory for details.
+##
+
+## file       run_lock_stress.sh
+
+RESULT_DIR=scorep-lock-stress-dir
+
+for mode in "SCOREP_ENABLE_PROFILING=true SCOREP_ENABLE_TRACING=false" \
+            "SCOREP_ENABLE_PROFILING=false SCOREP_ENABLE_TRACING=true"; do
+    rm -rf $RESULT_DIR
+    env SCOREP_EXPERIMENT_DIRECTORY=$RESULT_DIR $mode ./lock_stress
+    if [ $? -ne 0 ]; then
+        rm -rf scorep-measurement-tmp $RESULT_DIR
+        exit 1
+    fi
+done
+
+rm -rf $RESULT_DIR
+exit 0
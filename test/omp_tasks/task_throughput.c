@@ -0,0 +1,66 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Task-creation throughput benchmark. One thread creates N empty tasks
+ * which are executed by all threads of the team, i.e., tasks are created
+ * and completed on different threads. Reports the number of created tasks
+ * per second. See run_task_throughput.sh for a comparison of
+ * uninstrumented and instrumented runs.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <omp.h>
+
+int
+main( int argc, char** argv )
+{
+    uint64_t N;
+
+    if ( argc < 2 )
+    {
+        printf( "Creates N empty tasks in a single loop and reports the task-creation throughput.\n"
+                "Usage: %s N\n", argv[ 0 ] );
+        exit( EXIT_FAILURE );
+    }
+    N = strtoull( argv[ 1 ], NULL, 10 );
+
+    int    threads = 0;
+    double start   = omp_get_wtime();
+  #pragma omp parallel
+    {
+  #pragma omp single
+        {
+            threads = omp_get_num_threads();
+            for ( uint64_t i = 0; i < N; i++ )
+            {
+      #pragma omp task firstprivate( i )
+                {
+                    if ( i > N )
+                    {
+                        exit( EXIT_FAILURE );
+                    }
+                }
+            }
+        }
+    }
+    double elapsed = omp_get_wtime() - start;
+
+    printf( "%" PRIu64 " tasks on %d threads: %.3f s, %.0f tasks/s\n",
+            N, threads, elapsed, ( double )N / elapsed );
+    return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license. See the COPYING file in the package base
+ * directory for details.
+ *
+ */
+
+/**
+ * @file
+ *
+ * Checks the parsing of SCOREP_PROFILING_PARAMETER_INTEGER_BUCKETS and the
+ * assignment of integer parameter values to buckets.
+ */
+
+#include <config.h>
+
+#include <CuTest.h>
+
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Definitions.h>
+#include <scorep_profile_definition.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* Defined by the profiling configuration variables. */
+extern char* scorep_profile_parameter_integer_buckets;
+
+static SCOREP_ParameterHandle signed_param;
+static SCOREP_ParameterHandle unsigned_param;
+
+
+static void
+set_buckets( const char* config )
+{
+    scorep_profile_parameter_integer_buckets = ( char* )config;
+    scorep_profile_init_parameter_buckets();
+}
+
+
+static int64_t
+bucket_signed( int64_t value )
+{
+    return ( int64_t )scorep_profile_bucket_parameter_value( signed_param, ( uint64_t )value );
+}
+
+
+static uint64_t
+bucket_unsigned( uint64_t value )
+{
+    return scorep_profile_bucket_parameter_value( unsigned_param, value );
+}
+
+
+static void
+test_none( CuTest* tc )
+{
+    static const char* configs[] = { "", "none" };
+
+    for ( size_t i = 0; i < sizeof( configs ) / sizeof( configs[ 0 ] ); i++ )
+    {
+        set_buckets( configs[ i ] );
+        CuAssertTrue( tc, bucket_signed( -1000 ) == -1000 );
+        CuAssertTrue( tc, bucket_signed( 0 ) == 0 );
+        CuAssertTrue( tc, bucket_unsigned( 1000 ) == 1000 );
+        CuAssertTrue( tc, bucket_unsigned( UINT64_MAX ) == UINT64_MAX );
+    }
+}
+
+
+static void
+test_log2( CuTest* tc )
+{
+    set_buckets( "log2" );
+
+    CuAssertTrue( tc, bucket_unsigned( 0 ) == 0 );
+    CuAssertTrue( tc, bucket_unsigned( 1 ) == 1 );
+    CuAssertTrue( tc, bucket_unsigned( 2 ) == 2 );
+    CuAssertTrue( tc, bucket_unsigned( 3 ) == 2 );
+    CuAssertTrue( tc, bucket_unsigned( 1023 ) == 512 );
+    CuAssertTrue( tc, bucket_unsigned( 1024 ) == 1024 );
+    CuAssertTrue( tc, bucket_unsigned( UINT64_MAX ) == UINT64_C( 1 ) << 63 );
+
+    /* Negative values by their magnitude, keeping the sign. */
+    CuAssertTrue( tc, bucket_signed( 5 ) == 4 );
+    CuAssertTrue( tc, bucket_signed( -1 ) == -1 );
+    CuAssertTrue( tc, bucket_signed( -5 ) == -4 );
+    CuAssertTrue( tc, bucket_signed( -1024 ) == -1024 );
+    CuAssertTrue( tc, bucket_signed( INT64_MIN ) == INT64_MIN );
+    CuAssertTrue( tc, bucket_signed( INT64_MAX ) == INT64_C( 1 ) << 62 );
+}
+
+
+static void
+test_list( CuTest* tc )
+{
+    set_buckets( "0,64,1024,65536" );
+
+    CuAssertTrue( tc, bucket_unsigned( 0 ) == 0 );
+    CuAssertTrue( tc, bucket_unsigned( 63 ) == 0 );
+    CuAssertTrue( tc, bucket_unsigned( 64 ) == 64 );
+    CuAssertTrue( tc, bucket_unsigned( 1023 ) == 64 );
+    CuAssertTrue( tc, bucket_unsigned( 1024 ) == 1024 );
+    CuAssertTrue( tc, bucket_unsigned( 65535 ) == 1024 );
+    CuAssertTrue( tc, bucket_unsigned( 65536 ) == 65536 );
+
+    /* Values above the last bound belong to the last bucket, those below the
+     * first bound to the first one. */
+    CuAssertTrue( tc, bucket_unsigned( UINT64_MAX ) == 65536 );
+    CuAssertTrue( tc, bucket_signed( INT64_MAX ) == 65536 );
+    CuAssertTrue( tc, bucket_signed( -1 ) == 0 );
+    CuAssertTrue( tc, bucket_signed( INT64_MIN ) == 0 );
+
+    /* Negative and hexadecimal bounds, and spaces. */
+    set_buckets( "-100, 0x10 ,100" );
+
+    CuAssertTrue( tc, bucket_signed( -1000 ) == -100 );
+    CuAssertTrue( tc, bucket_signed( -100 ) == -100 );
+    CuAssertTrue( tc, bucket_signed( 15 ) == -100 );
+    CuAssertTrue( tc, bucket_signed( 16 ) == 16 );
+    CuAssertTrue( tc, bucket_signed( 99 ) == 16 );
+    CuAssertTrue( tc, bucket_signed( 100 ) == 100 );
+    CuAssertTrue( tc, bucket_unsigned( 0 ) == ( uint64_t )-100 );
+    CuAssertTrue( tc, bucket_unsigned( ( uint64_t )INT64_MAX + 1 ) == 100 );
+
+    /* A single bound maps all values to it. */
+    set_buckets( "10" );
+
+    CuAssertTrue( tc, bucket_signed( -10 ) == 10 );
+    CuAssertTrue( tc, bucket_signed( 10 ) == 10 );
+    CuAssertTrue( tc, bucket_unsigned( UINT64_MAX ) == 10 );
+}
+
+
+static void
+test_invalid( CuTest* tc )
+{
+    static const char* configs[] =
+    {
+        "1,1", "5,3", "1,a", "1,,2", "1,", ",1", "log10", "99999999999999999999"
+    };
+
+    for ( size_t i = 0; i < sizeof( configs ) / sizeof( configs[ 0 ] ); i++ )
+    {
+        set_buckets( configs[ i ] );
+        char message[ 64 ];
+        snprintf( message, sizeof( message ), "config '%s'", configs[ i ] );
+        CuAssertMsg( tc, message, bucket_signed( -1000 ) == -1000 );
+        CuAssertMsg( tc, message, bucket_unsigned( 1000 ) == 1000 );
+    }
+}
+
+
+static void
+test_instance( CuTest* tc )
+{
+    set_buckets( "log2" );
+    CuAssertTrue( tc, scorep_profile_bucket_parameter_value( scorep_profile_param_instance, 1000 ) == 1000 );
+}
+
+
+int
+main( void )
+{
+    CuUseColors();
+    CuString* output = CuStringNew();
+    CuSuite*  suite  = CuSuiteNew( "Profiling parameter buckets" );
+
+    SUITE_ADD_TEST_NAME( suite, test_none, "no buckets" );
+    SUITE_ADD_TEST_NAME( suite, test_log2, "power-of-two buckets" );
+    SUITE_ADD_TEST_NAME( suite, test_list, "list of bounds" );
+    SUITE_ADD_TEST_NAME( suite, test_invalid, "invalid configurations" );
+    SUITE_ADD_TEST_NAME( suite, test_instance, "instance parameter" );
+
+    SCOREP_InitMeasurement();
+    signed_param   = SCOREP_Definitions_NewParameter( "signed", SCOREP_PARAMETER_INT64 );
+    unsigned_param = SCOREP_Definitions_NewParameter( "unsigned", SCOREP_PARAMETER_UINT64 );
+    char* config = scorep_profile_parameter_integer_buckets;
+
+    CuSuiteRun( suite );
+
+    set_buckets( config );
+    SCOREP_FinalizeMeasurement();
+
+    CuSuiteSummary( suite, output );
+    int failCount = suite->failCount;
+    if ( failCount )
+    {
+        printf( "%s", output->buffer );
+    }
+
+    CuSuiteFree( suite );
+    CuStringFree( output );
+
+    return failCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the Score-P software (http://www.score-p.org)
+ *
+ * Copyright (c) 2026,
+ * Forschungszentrum Juelich GmbH, Germany
+ *
+ * This software may be modified and distributed under the terms of
+ * a BSD-style license.  See the COPYING file in the package base
+ * directory for details.
+ */
+
+/*
+ * Takes a fixed number of samples, some while recording is disabled, some
+ * around events with explicit timestamps, and some after the last event of
+ * the program. The number and the order of the samples in the trace must not
+ * depend on the sample buffer size given as first argument.
+ */
+
+#include <config.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <SCOREP_InMeasurement.h>
+#include <SCOREP_RuntimeManagement.h>
+#include <SCOREP_Definitions.h>
+#include <SCOREP_Events.h>
+#include <SCOREP_Location.h>
+#include <SCOREP_Timer_Ticks.h>
+
+static SCOREP_RegionHandle user_region;
+static SCOREP_RegionHandle explicit_region;
+
+#if HAVE( SAMPLING_SUPPORT )
+
+static SCOREP_InterruptGeneratorHandle raise_irq_handle;
+
+static void
+handler_SIGUSR1( int        signalNumber,
+                 siginfo_t* signalInfo,
+                 void*      contextPtr )
+{
+    ( void )signalNumber;
+    ( void )signalInfo;
+    bool outside = SCOREP_IN_MEASUREMENT_TEST_AND_INCREMENT();
+    SCOREP_ENTER_SIGNAL_CONTEXT();
+
+    if ( outside )
+    {
+        SCOREP_Sample( raise_irq_handle, contextPtr );
+    }
+
+    SCOREP_EXIT_SIGNAL_CONTEXT();
+    SCOREP_IN_MEASUREMENT_DECREMENT();
+}
+
+#else
+
+#define raise( signal ) do { } while ( 0 )
+
+#endif
+
+static void
+take_samples( int n )
+{
+    while ( n-- )
+    {
+        raise( SIGUSR1 );
+    }
+}
+
+int
+main( int ac, char* av[] )
+{
+    if ( SCOREP_IS_MEASUREMENT_PHASE( PRE ) )
+    {
+        SCOREP_InitMeasurement();
+    }
+
+    user_region = SCOREP_Definitions_NewRegion( "USER",
+                                                "USER",
+                                                SCOREP_INVALID_SOURCE_FILE,
+                                                SCOREP_INVALID_LINE_NO,
+                                                SCOREP_INVALID_LINE_NO,
+                                                SCOREP_PARADIGM_USER,
+                                                SCOREP_REGION_FUNCTION );
+    explicit_region = SCOREP_Definitions_NewRegion( "EXPLICIT",
+                                                    "EXPLICIT",
+                                                    SCOREP_INVALID_SOURCE_FILE,
+                                                    SCOREP_INVALID_LINE_NO,
+                                                    SCOREP_INVALID_LINE_NO,
+                                                    SCOREP_PARADIGM_USER,
+                                                    SCOREP_REGION_FUNCTION );
+
+#if HAVE( SAMPLING_SUPPORT )
+
+    raise_irq_handle = SCOREP_Definitions_NewInterruptGenerator(
+        "manually",
+        SCOREP_INTERRUPT_GENERATOR_MODE_COUNT,
+        SCOREP_METRIC_BASE_DECIMAL,
+        0,
+        1 );
+
+    struct sigaction signal_action;
+    memset( &signal_action, 0, sizeof( signal_action ) );
+    signal_action.sa_sigaction = handler_SIGUSR1;
+    signal_action.sa_flags     = SA_SIGINFO | SA_RESTART;
+    sigfillset( &signal_action.sa_mask );
+    if ( 0 != sigaction( SIGUSR1, &signal_action, NULL ) )
+    {
+        UTILS_WARNING( "Failed to install signal handler for sampling." );
+    }
+
+#endif
+
+    SCOREP_Location* location    = SCOREP_Location_GetCurrentCPULocation();
+    uint32_t         buffer_size = ac > 1 ? atoi( av[ 1 ] ) : 0;
+    SCOREP_SetSampleBufferSize( location, buffer_size );
+
+    take_samples( 2 );
+
+    /* More samples than a small buffer can hold */
+    SCOREP_EnterRegion( user_region );
+    take_samples( 5 );
+    SCOREP_ExitRegion( user_region );
+
+    /* Not recorded */
+    SCOREP_DisableRecording();
+    take_samples( 3 );
+    SCOREP_EnableRecording();
+
+    /* Samples before, inside, and after a region with explicit timestamps */
+    take_samples( 2 );
+    SCOREP_Location_EnterRegion( location, SCOREP_Timer_GetClockTicks(), explicit_region );
+    take_samples( 3 );
+    SCOREP_Location_ExitRegion( location, SCOREP_Timer_GetClockTicks(), explicit_region );
+    take_samples( 1 );
+
+    /* No further event follows these samples */
+    take_samples( 2 );
+
+    return 0;
+}
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  * University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011, 2016-2017,
+ * Copyright (c) 2009-2011, 2016-2017, 2026,
  * Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011, 2014,
@@ -127,6 +127,7 @@ SCOREP::Wrapgen::handler::mpi::_initialize
     func_handlers[ "group:new" ]          = handler::mpi::group_new;
     func_handlers[ "mpi:sendrecvbytes" ]  = handler::mpi::sendrecvbytes;
     func_handlers[ "root" ]               = handler::mpi::root;
+    func_handlers[ "mpi:resync" ]         = handler::mpi::resync;
 
     /** - Fortran<->C conversion types */
     f2c_types[ "MPI_Status" ]   = "PMPI_Status";
@@ -1328,7 +1329,7 @@ SCOREP::Wrapgen::handler::mpi::sendrecvbytes
         coll_bytes_args = coll_bytes_args + ", ";
     }
 
-    coll_bytes_args = coll_bytes_args + "comm, &sendbytes, &recvbytes";
+    coll_bytes_args = coll_bytes_args + "comm, scorep_mpi_comm_payload( comm_handle ), &sendbytes, &recvbytes";
 
     string call = "scorep_mpi_coll_bytes_" + coll_bytes_fun + "(" + coll_bytes_args + ");";
 
@@ -1351,3 +1352,26 @@ SCOREP::Wrapgen::handler::mpi::root
         return "SCOREP_INVALID_ROOT_RANK";
     }
 }
+
+string
+SCOREP::Wrapgen::handler::mpi::resync
+(
+    const Func& func
+)
+{
+    // Neighborhood collectives need a topology communicator, they are
+    // never called on MPI_COMM_WORLD
+    string name = func.get_name();
+    if ( name.compare( 0, 13, "MPI_Neighbor_" ) == 0 )
+    {
+        return "";
+    }
+
+    toupper( name );
+    return "/* Outside of the collective region, the resynchronization must not be\n"
+           "     attributed to the application's collective */\n"
+           "  if (comm == MPI_COMM_WORLD && return_val == MPI_SUCCESS)\n"
+           "    {\n"
+           "      SCOREP_ResynchronizeClocks(SCOREP_MPI_COLLECTIVE__" + name + ");\n"
+           "    }\n";
+}
@@ -13,7 +13,7 @@
  * Copyright (c) 2009-2011,
  *    University of Oregon, Eugene, USA
  *
- * Copyright (c) 2009-2011, 2016-2017,
+ * Copyright (c) 2009-2011, 2016-2017, 2026,
  *    Forschungszentrum Juelich GmbH, Germany
  *
  * Copyright (c) 2009-2011,
@@ -406,6 +406,12 @@ root
     const SCOREP::Wrapgen::Func& func
 );
 
+std::string
+resync
+(
+    const SCOREP::Wrapgen::Func& func
+);
+
 /**
  * @}
  */
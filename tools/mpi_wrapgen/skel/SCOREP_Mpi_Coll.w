@@ -22,11 +22,14 @@ ${proto:c}
 
   uint64_t sendbytes = 0, recvbytes = 0;
 
+  SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
   if (event_gen_active)
     {
       SCOREP_MPI_EVENT_GEN_OFF();
       if (event_gen_active_for_group)
         {
+          comm_handle = SCOREP_MPI_COMM_HANDLE(comm);
           ${mpi:sendrecvbytes}
 
           SCOREP_EnterWrappedRegion(scorep_mpi_regions[SCOREP_MPI_REGION__${name|uppercase}]);
@@ -46,7 +49,7 @@ ${proto:c}
     {
       if (event_gen_active_for_group)
         {
-          SCOREP_MpiCollectiveEnd(SCOREP_MPI_COMM_HANDLE(comm),
+          SCOREP_MpiCollectiveEnd(comm_handle,
                                   ${root},
                                   SCOREP_MPI_COLLECTIVE__${name|uppercase},
                                   sendbytes,
@@ -61,6 +64,7 @@ ${proto:c}
       SCOREP_MPI_EVENT_GEN_ON();
     }
 
+  ${mpi:resync}
   SCOREP_IN_MEASUREMENT_DECREMENT();
   return return_val;
 }
@@ -23,12 +23,15 @@ ${proto:c}
 
   uint64_t sendbytes = 0, recvbytes = 0;
 
+  SCOREP_InterimCommunicatorHandle comm_handle = SCOREP_INVALID_INTERIM_COMMUNICATOR;
+
   if (event_gen_active)
     {
       reqid = scorep_mpi_get_request_id();
       SCOREP_MPI_EVENT_GEN_OFF();
       if (event_gen_active_for_group)
         {
+          comm_handle = SCOREP_MPI_COMM_HANDLE(comm);
           ${mpi:sendrecvbytes}
 
           SCOREP_EnterWrappedRegion(scorep_mpi_regions[SCOREP_MPI_REGION__${name|uppercase}]);
@@ -51,7 +54,7 @@ ${proto:c}
           if (return_val == MPI_SUCCESS)
           {
             scorep_mpi_request_icoll_create(*request, SCOREP_MPI_REQUEST_FLAG_NONE, SCOREP_MPI_COLLECTIVE__${name|uppercase},
-                                ${root}, sendbytes, recvbytes, comm, reqid);
+                                ${root}, sendbytes, recvbytes, comm_handle, reqid);
           }
           SCOREP_ExitRegion(scorep_mpi_regions[SCOREP_MPI_REGION__${name|uppercase}]);
         }